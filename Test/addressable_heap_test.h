@@ -0,0 +1,263 @@
+#ifndef TINYSTL_ADDRESSABLE_HEAP_TEST_H_
+#define TINYSTL_ADDRESSABLE_HEAP_TEST_H_
+
+// addressable_heap test : 测试 addressable_heap 的接口，以及 Dijkstra 中与重复 push 的 priority_queue 的性能对比
+
+#include <stdexcept>
+#include <string>
+
+#include "../TinySTL/addressable_heap.h"
+#include "../TinySTL/queue.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace addressable_heap_test
+{
+
+typedef tinystl::pair<int, int>                      dist_node;  // (距离, 节点)
+typedef tinystl::greater<dist_node>                  by_dist;
+
+// 随机有向图，每个节点有 degree 条出边，边存放为 (终点, 权值)
+struct graph
+{
+  size_t n;
+  size_t degree;
+  tinystl::vector<dist_node> edges;
+
+  graph(size_t count, size_t d) : n(count), degree(d)
+  {
+    edges.reserve(count * d);
+    for (size_t i = 0; i < count * d; ++i)
+      edges.push_back(dist_node(static_cast<int>(rand() % count), rand() % 1000));
+  }
+};
+
+// 重复 push，pop 时跳过过期的元素，返回距离之和
+size_t dijkstra_lazy(const graph& g, size_t* max_size)
+{
+  tinystl::vector<int> dist(g.n, -1);
+  tinystl::vector<char> done(g.n, 0);
+  tinystl::priority_queue<dist_node, tinystl::vector<dist_node>, by_dist> q;
+  dist[0] = 0;
+  q.push(dist_node(0, 0));
+  size_t sum = 0;
+  while (!q.empty())
+  {
+    if (q.size() > *max_size) *max_size = q.size();
+    dist_node top = q.top();
+    q.pop();
+    const int u = top.second;
+    if (done[u]) continue;
+    done[u] = 1;
+    sum += top.first;
+    for (size_t e = u * g.degree; e < (u + 1) * g.degree; ++e)
+    {
+      const int v = g.edges[e].first;
+      const int d = top.first + g.edges[e].second;
+      if (!done[v] && (dist[v] < 0 || d < dist[v]))
+      {
+        dist[v] = d;
+        q.push(dist_node(d, v));
+      }
+    }
+  }
+  return sum;
+}
+
+// 每个节点在堆中至多一份，距离变小时 decrease_key；距离与句柄放在一起，松弛时只访问一次
+struct node_state
+{
+  int    dist;
+  size_t handle;
+};
+
+size_t dijkstra_addressable(const graph& g, size_t* max_size)
+{
+  const size_t none = static_cast<size_t>(-1);
+  tinystl::vector<node_state> state(g.n, node_state{ -1, none });
+  tinystl::addressable_heap<dist_node, by_dist> q;
+  state[0].dist = 0;
+  state[0].handle = q.push(dist_node(0, 0));
+  size_t sum = 0;
+  while (!q.empty())
+  {
+    if (q.size() > *max_size) *max_size = q.size();
+    dist_node top = q.top();
+    q.pop();
+    state[top.second].handle = none;
+    sum += top.first;
+    for (size_t e = top.second * g.degree; e < (top.second + 1) * g.degree; ++e)
+    {
+      node_state& s = state[g.edges[e].first];
+      const int d = top.first + g.edges[e].second;
+      if (s.dist < 0)
+      {
+        s.dist = d;
+        s.handle = q.push(dist_node(d, g.edges[e].first));
+      }
+      else if (s.handle != none && d < s.dist)
+      {
+        s.dist = d;
+        q.decrease_key(s.handle, dist_node(d, g.edges[e].first));
+      }
+    }
+  }
+  return sum;
+}
+
+template <size_t (*Dijkstra)(const graph&, size_t*)>
+void dijkstra_test(size_t count)
+{
+  srand((int)time(0));
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  size_t max_size = 0;
+  graph g(count, 32);
+  test_time([&]() {
+    sink = sink + Dijkstra(g, &max_size);
+  });
+}
+
+#define ADDRESSABLE_HEAP_TEST(len1, len2, len3)                   \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "| lazy priority_queue |";                         \
+  dijkstra_test<dijkstra_lazy>(len1);                             \
+  dijkstra_test<dijkstra_lazy>(len2);                             \
+  dijkstra_test<dijkstra_lazy>(len3);                             \
+  std::cout << "\n|  addressable_heap   |";                       \
+  dijkstra_test<dijkstra_addressable>(len1);                      \
+  dijkstra_test<dijkstra_addressable>(len2);                      \
+  dijkstra_test<dijkstra_addressable>(len3);
+
+// 复制构造时按需抛出异常的元素
+struct throw_on_copy
+{
+  static bool armed;
+  int value;
+  explicit throw_on_copy(int v) : value(v) {}
+  throw_on_copy(const throw_on_copy& rhs) : value(rhs.value)
+  {
+    if (armed) throw std::runtime_error("throw_on_copy");
+  }
+  throw_on_copy& operator=(const throw_on_copy& rhs)
+  {
+    value = rhs.value;
+    return *this;
+  }
+  bool operator<(const throw_on_copy& rhs) const { return value < rhs.value; }
+};
+bool throw_on_copy::armed = false;
+
+// 依次弹出堆中的元素并输出
+template <class Heap>
+void heap_print(Heap h)
+{
+  while (!h.empty())
+  {
+    std::cout << " " << h.top();
+    h.pop();
+  }
+  std::cout << std::endl;
+}
+
+#define HEAP_COUT(h) do {                        \
+  std::string h_name = #h;                       \
+  std::cout << " " << h_name << " :";            \
+  heap_print(h);                                 \
+} while(0)
+
+#define HEAP_FUN_AFTER(con, fun) do {            \
+  std::string fun_name = #fun;                   \
+  std::cout << " After " << fun_name << " :\n";  \
+  fun;                                           \
+  HEAP_COUT(con);                                \
+} while(0)
+
+void addressable_heap_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[------------ Run container test : addressable_heap -------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  tinystl::addressable_heap<int> h1;
+  tinystl::addressable_heap<int, tinystl::greater<int>, 2> h2;
+  size_t a[8];
+  for (int i = 0; i < 8; ++i)
+    a[i] = h1.push(i * 10);
+
+  HEAP_COUT(h1);                                              // 70 60 50 40 30 20 10 0
+  FUN_VALUE(h1.top());                                        // 70
+  FUN_VALUE(h1.top_handle());                                 // 7
+  FUN_VALUE(h1[a[3]]);                                        // 30
+  HEAP_FUN_AFTER(h1, h1.increase(a[2], 65));                  // 70 65 60 50 40 30 10 0
+  HEAP_FUN_AFTER(h1, h1.decrease(a[7], 5));                   // 65 60 50 40 30 10 5 0
+  HEAP_FUN_AFTER(h1, h1.update(a[0], 45));                    // 65 60 50 45 40 30 10 5
+  HEAP_FUN_AFTER(h1, h1.erase(a[5]));                         // 65 60 45 40 30 10 5
+  HEAP_FUN_AFTER(h1, h1.pop());                               // 60 45 40 30 10 5
+  std::cout << std::boolalpha;
+  FUN_VALUE(h1.contains(a[2]));                               // false
+  FUN_VALUE(h1.contains(a[6]));                               // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(h1.size());                                       // 6
+  // 被删除的句柄在之后的 push 中复用
+  FUN_VALUE(h1.push(100));                                    // 2
+  FUN_VALUE(h1.top_handle());                                 // 2
+  for (int i = 0; i < 8; ++i)
+    a[i] = h2.push(10 - i);
+  HEAP_COUT(h2);                                              // 3 4 5 6 7 8 9 10
+  HEAP_FUN_AFTER(h2, h2.increase(a[0], 1));                   // 1 3 4 5 6 7 8 9
+  HEAP_FUN_AFTER(h2, h2.decrease(a[7], 11));                  // 1 4 5 6 7 8 9 11
+  // decrease_key / increase_key 按键的大小而言，在小顶堆中 decrease_key 向堆顶移动
+  HEAP_FUN_AFTER(h2, h2.decrease_key(a[6], 2));               // 1 2 5 6 7 8 9 11
+  HEAP_FUN_AFTER(h2, h2.increase_key(a[0], 20));              // 2 5 6 7 8 9 11 20
+  HEAP_FUN_AFTER(h1, h1.decrease_key(h1.top_handle(), 0));   // 60 45 40 30 10 5 0
+  tinystl::addressable_heap<int, tinystl::greater<int>, 2> h3;
+  HEAP_FUN_AFTER(h3, h3.swap(h2));                            // 2 5 6 7 8 9 11 20
+  HEAP_FUN_AFTER(h3, h3.clear());                             //
+  // 构造元素时抛出异常，选定的句柄不会丢失
+  tinystl::addressable_heap<throw_on_copy> h4;
+  throw_on_copy x(1);
+  h4.push(x);
+  h4.push(x);
+  h4.erase(0);
+  throw_on_copy::armed = true;
+  try { h4.push(x); } catch (const std::runtime_error&) {}
+  throw_on_copy::armed = false;
+  FUN_VALUE(h4.push(x));                                      // 0
+  throw_on_copy::armed = true;
+  try { h4.push(x); } catch (const std::runtime_error&) {}
+  throw_on_copy::armed = false;
+  FUN_VALUE(h4.push(x));                                      // 2
+  FUN_VALUE(h4.size());                                       // 3
+  // 与重复 push 的 Dijkstra 结果相同，而堆的峰值更小
+  graph g(2000, 8);
+  size_t max1 = 0, max2 = 0;
+  std::cout << std::boolalpha;
+  FUN_VALUE((dijkstra_lazy(g, &max1) == dijkstra_addressable(g, &max2)));  // true
+  FUN_VALUE((max2 < max1));                                   // true
+  std::cout << std::noboolalpha;
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "| dijkstra (32 edges) |";
+#if LARGER_TEST_DATA_ON
+  ADDRESSABLE_HEAP_TEST(SCALE_SS(LEN1), SCALE_SS(LEN2), SCALE_SS(LEN3));
+#else
+  ADDRESSABLE_HEAP_TEST(SCALE_SSS(LEN1), SCALE_SSS(LEN2), SCALE_SSS(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[------------ End container test : addressable_heap -------------]\n";
+
+}
+
+} // namespace addressable_heap_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_ADDRESSABLE_HEAP_TEST_H_
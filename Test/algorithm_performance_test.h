@@ -1,11 +1,13 @@
 #ifndef TINYSTL_ALGORITHM_PERFORMANCE_TEST_H_
 #define TINYSTL_ALGORITHM_PERFORMANCE_TEST_H_
 
-// 仅仅针对 sort, binary_search 做了性能测试
+// 仅仅针对 sort, binary_search, lower_bound 做了性能测试
 
 #include <algorithm>
+#include <vector>
 
 #include "../TinySTL/algorithm.h"
+#include "../TinySTL/eytzinger.h"
 #include "test.h"
 
 namespace tinystl
@@ -95,6 +97,52 @@ namespace algorithm_performance_test
   std::cout << std::setw(WIDE) << t;                            \
 } while (0)
 
+#define TEST_LOWER_BOUND(mode, len, count) do {                 \
+  srand((int)time(0));                                          \
+  std::vector<int> v(len);                                      \
+  for (size_t i = 0; i < len; ++i)  v[i] = rand();              \
+  std::sort(v.begin(), v.end());                                \
+  volatile size_t sink = 0;                                     \
+  test_time([&]() {                                             \
+    for (size_t i = 0; i < count; ++i) {                        \
+      const int* first = v.data();                              \
+      sink = sink + (mode::lower_bound(first, first + len, rand()) \
+                     - first);                                  \
+    }                                                           \
+  });                                                           \
+} while (0)
+
+// 以 lambda 作为比较函数，不满足无分支版本的条件，用于对照原有的有分支二分查找
+#define TEST_LOWER_BOUND_BRANCHY(len, count) do {               \
+  srand((int)time(0));                                          \
+  std::vector<int> v(len);                                      \
+  for (size_t i = 0; i < len; ++i)  v[i] = rand();              \
+  std::sort(v.begin(), v.end());                                \
+  auto comp = [](int a, int b) { return a < b; };               \
+  volatile size_t sink = 0;                                     \
+  test_time([&]() {                                             \
+    for (size_t i = 0; i < count; ++i) {                        \
+      const int* first = v.data();                              \
+      sink = sink + (tinystl::lower_bound(first, first + len,   \
+                     rand(), comp) - first);                    \
+    }                                                           \
+  });                                                           \
+} while (0)
+
+#define TEST_EYTZINGER(len, count) do {                         \
+  srand((int)time(0));                                          \
+  std::vector<int> v(len);                                      \
+  for (size_t i = 0; i < len; ++i)  v[i] = rand();              \
+  std::sort(v.begin(), v.end());                                \
+  tinystl::eytzinger_index<int> index(v.data(), v.data() + len); \
+  volatile size_t sink = 0;                                     \
+  test_time([&]() {                                             \
+    for (size_t i = 0; i < count; ++i) {                        \
+      sink = sink + index.lower_bound(rand());                  \
+    }                                                           \
+  });                                                           \
+} while (0)
+
 void sort_test()
 {
   std::cout << "[----------------------- function : sort -----------------------]" << std::endl;
@@ -143,6 +191,30 @@ void equal_range_test()
   std::cout << std::endl;
 }
 
+void lower_bound_test()
+{
+  std::cout << "[-------------------- function : lower_bound -------------------]" << std::endl;
+  std::cout << "| orders of magnitude |";
+  TEST_LEN(LEN1, LEN2, LEN3, WIDE);
+  std::cout << "|         std         |";
+  TEST_LOWER_BOUND(std, LEN1, LEN1);
+  TEST_LOWER_BOUND(std, LEN2, LEN2);
+  TEST_LOWER_BOUND(std, LEN3, LEN3);
+  std::cout << std::endl << "|   tinystl branchy   |";
+  TEST_LOWER_BOUND_BRANCHY(LEN1, LEN1);
+  TEST_LOWER_BOUND_BRANCHY(LEN2, LEN2);
+  TEST_LOWER_BOUND_BRANCHY(LEN3, LEN3);
+  std::cout << std::endl << "|       tinystl       |";
+  TEST_LOWER_BOUND(tinystl, LEN1, LEN1);
+  TEST_LOWER_BOUND(tinystl, LEN2, LEN2);
+  TEST_LOWER_BOUND(tinystl, LEN3, LEN3);
+  std::cout << std::endl << "|   eytzinger_index   |";
+  TEST_EYTZINGER(LEN1, LEN1);
+  TEST_EYTZINGER(LEN2, LEN2);
+  TEST_EYTZINGER(LEN3, LEN3);
+  std::cout << std::endl;
+}
+
 void rotate_test()
 {
   std::cout << "[---------------------- function : rotate ----------------------]" << std::endl;
@@ -168,6 +240,7 @@ void algorithm_performance_test()
   sort_test();
   binary_search_test();
   equal_range_test();
+  lower_bound_test();
   rotate_test();
   std::cout << "[--------------- End algorithm performance test ----------------]" << std::endl;
   std::cout << "[===============================================================]" << std::endl;
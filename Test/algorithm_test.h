@@ -6,6 +6,8 @@
 #include <numeric>
 
 #include "../TinySTL/algorithm.h"
+#include "../TinySTL/deque.h"
+#include "../TinySTL/eytzinger.h"
 #include "../TinySTL/vector.h"
 #include "test.h"
 
@@ -149,6 +151,39 @@ TEST(fill_n_test) {
     EXPECT_CON_EQ(arr1, arr2);
 }
 
+// deque_iterator 的分段版本：区间跨越多个缓冲区
+TEST(deque_segment_test) {
+    std::vector<int> exp(30);
+    std::iota(exp.begin(), exp.end(), 0);
+    tinystl::deque<int, tinystl::allocator<int>, 4> d1(exp.data(), exp.data() + 30);
+    tinystl::deque<int, tinystl::allocator<int>, 7> d2(33, 0);
+    int act[30];
+    tinystl::copy(d1.begin(), d1.end(), act);
+    EXPECT_CON_EQ(exp, act);
+    tinystl::copy(exp.data() + 3, exp.data() + 30, d2.begin() + 1);
+    EXPECT_EQ(d2[1], 3);
+    EXPECT_EQ(d2[27], 29);
+    EXPECT_TRUE(tinystl::equal(d1.begin() + 3, d1.end(), d2.begin() + 1));
+    EXPECT_TRUE(tinystl::equal(d1.begin() + 3, d1.end(), exp.data() + 3));
+    EXPECT_FALSE(tinystl::equal(d1.begin(), d1.end(), d2.begin()));
+    tinystl::copy(d1.begin() + 1, d1.begin() + 25, d2.begin() + 2);
+    EXPECT_EQ(d2[2], 1);
+    EXPECT_EQ(d2[25], 24);
+    tinystl::move(d1.begin(), d1.end(), act);
+    EXPECT_CON_EQ(exp, act);
+    EXPECT_EQ(*tinystl::find(d1.begin() + 2, d1.end(), 17), 17);
+    EXPECT_TRUE(tinystl::find(d1.begin(), d1.begin() + 17, 17) == d1.begin() + 17);
+    int sum = 0;
+    tinystl::for_each(d1.begin() + 5, d1.end() - 5, [&sum](int x) { sum += x; });
+    EXPECT_EQ(sum, std::accumulate(exp.begin() + 5, exp.end() - 5, 0));
+    std::fill(exp.begin() + 2, exp.end() - 3, 9);
+    tinystl::fill(d1.begin() + 2, d1.end() - 3, 9);
+    EXPECT_CON_EQ(exp, d1);
+    std::fill_n(exp.begin() + 6, 13, 4);
+    tinystl::fill_n(d1.begin() + 6, 13, 4);
+    EXPECT_CON_EQ(exp, d1);
+}
+
 TEST(iter_swap_test) {
     int a = 1;
     int b = 2;
@@ -294,6 +329,39 @@ TEST(sort_heap_test) {
     EXPECT_CON_EQ(arr3, arr4);
 }
 
+TEST(dary_heap_test) {
+    int arr1[] = { 2,1,6,5,4,9,8,7,6,3,0,5,1 };
+    int arr2[] = { 2,1,6,5,4,9,8,7,6,3,0,5,1 };
+    int arr3[] = { 2,1,6,5,4,9,8,7,6,3,0,5,1 };
+    int arr4[] = { 2,1,6,5,4,9,8,7,6,3,0,5,1 };
+    tinystl::make_dary_heap<4>(arr1, arr1 + 13);
+    tinystl::make_dary_heap<8>(arr2, arr2 + 13, std::greater<int>());
+    EXPECT_TRUE(tinystl::is_dary_heap<4>(arr1, arr1 + 13));
+    EXPECT_TRUE(tinystl::is_dary_heap<8>(arr2, arr2 + 13, std::greater<int>()));
+    EXPECT_FALSE(tinystl::is_dary_heap<4>(arr3, arr3 + 13));
+    // 2 叉与二叉堆的布局相同
+    tinystl::make_dary_heap<2>(arr3, arr3 + 13);
+    EXPECT_TRUE(std::is_heap(arr3, arr3 + 13));
+    for (int i = 13; i > 1; --i)
+    {
+        tinystl::pop_dary_heap<4>(arr1, arr1 + i);
+        EXPECT_TRUE(tinystl::is_dary_heap<4>(arr1, arr1 + i - 1));
+    }
+    std::sort(arr4, arr4 + 13);
+    EXPECT_CON_EQ(arr1, arr4);
+    tinystl::sort_dary_heap<8>(arr2, arr2 + 13, std::greater<int>());
+    std::sort(arr4, arr4 + 13, std::greater<int>());
+    EXPECT_CON_EQ(arr2, arr4);
+    int arr5[13];
+    for (int i = 0; i < 13; ++i)
+    {
+        arr5[i] = arr3[12 - i];
+        tinystl::push_dary_heap<4>(arr5, arr5 + i + 1);
+        EXPECT_TRUE(tinystl::is_dary_heap<4>(arr5, arr5 + i + 1));
+    }
+    EXPECT_EQ(9, arr5[0]);
+}
+
 // =============================== set_algo_test ============================== //
 
 TEST(set_difference_test) {
@@ -614,6 +682,20 @@ TEST(is_sorted_test) {
                 tinystl::is_sorted(arr4, arr4 + 5, std::less<int>()));
 }
 
+TEST(eytzinger_index_test) {
+    int arr1[] = { 1,2,3,3,3,4,5,7,8,8 };
+    tinystl::eytzinger_index<int> index(arr1, arr1 + 10);
+    for (int i = 0; i <= 9; ++i) {
+        EXPECT_EQ(std::lower_bound(arr1, arr1 + 10, i) - arr1,
+                  static_cast<ptrdiff_t>(index.lower_bound(i)));
+        EXPECT_EQ(std::upper_bound(arr1, arr1 + 10, i) - arr1,
+                  static_cast<ptrdiff_t>(index.upper_bound(i)));
+        EXPECT_EQ(std::binary_search(arr1, arr1 + 10, i), index.binary_search(i));
+    }
+    EXPECT_EQ(3, *index.find_lower(3));
+    EXPECT_TRUE(index.find_lower(9) == nullptr);
+}
+
 TEST(lower_bound_test) {
     int arr1[] = { 1,2,3,3,3,4,5 };
     EXPECT_EQ(std::lower_bound(arr1, arr1 + 7, 1),
@@ -624,6 +706,14 @@ TEST(lower_bound_test) {
                 tinystl::lower_bound(arr1, arr1 + 7, 3));
     EXPECT_EQ(std::lower_bound(arr1, arr1 + 7, 5, std::less<int>()),
                 tinystl::lower_bound(arr1, arr1 + 7, 5, std::less<int>()));
+    // 以下走无分支版本
+    EXPECT_EQ(std::lower_bound(arr1, arr1 + 7, 2.5),
+                tinystl::lower_bound(arr1, arr1 + 7, 2.5));
+    EXPECT_EQ(std::lower_bound(arr1, arr1 + 7, 6),
+                tinystl::lower_bound(arr1, arr1 + 7, 6, tinystl::less<int>()));
+    EXPECT_EQ(std::upper_bound(arr1, arr1 + 7, 3),
+                tinystl::upper_bound(arr1, arr1 + 7, 3, tinystl::less<int>()));
+    EXPECT_EQ(arr1, tinystl::lower_bound(arr1, arr1, 3));
 }
 
 TEST(max_elememt_test) {
@@ -1019,6 +1109,23 @@ TEST(sort_test) {
     EXPECT_CON_EQ(arr5, arr6);
 }
 
+TEST(stable_sort_test) {
+    // 按十位排序，个位记录原来的次序，相等元素的相对次序应保持不变
+    int arr1[40], arr2[40];
+    for (int i = 0; i < 40; ++i) {
+        arr1[i] = arr2[i] = (rand() % 5) * 10 + i % 10;
+    }
+    auto by_tens = [](int a, int b) { return a / 10 < b / 10; };
+    std::stable_sort(arr1, arr1 + 40, by_tens);
+    tinystl::stable_sort(arr2, arr2 + 40, by_tens);
+    EXPECT_CON_EQ(arr1, arr2);
+    int arr3[] = { 80,30,51,65,12,10,24,87,62,51,32,45,1,33,66,20,35,84,62,14 };
+    int arr4[] = { 80,30,51,65,12,10,24,87,62,51,32,45,1,33,66,20,35,84,62,14 };
+    std::stable_sort(arr3, arr3 + 20);
+    tinystl::stable_sort(arr4, arr4 + 20);
+    EXPECT_CON_EQ(arr3, arr4);
+}
+
 TEST(swap_ranges_test) {
     int arr1[] = { 4,5,6,1,2,3 };
     int arr2[] = { 4,5,6,1,2,3 };
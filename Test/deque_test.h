@@ -2,6 +2,8 @@
 #define TINYSTL_DEQUE_TEST_H
 
 #include <deque>
+#include <vector>
+#include <algorithm>
 
 #include "../TinySTL/deque.h"
 #include "test.h"
@@ -12,6 +14,68 @@ namespace test {
 
 namespace deque_test {
 
+    // 以 deque 作为 FIFO 队列：保持 window 个元素，push_back 与 pop_front 交替进行 count 次
+    template <class Con>
+    void fifo_test(size_t count, size_t window) {
+        volatile size_t sink = 0;  // 防止操作被优化掉
+        Con c;
+        for (size_t i = 0; i < window; ++i)
+            c.push_back(static_cast<int>(i));
+        test_time([&]() {
+            for (size_t i = 0; i < count; ++i) {
+                c.push_back(static_cast<int>(i));
+                sink = sink + c.front();
+                c.pop_front();
+            }
+        });
+    }
+
+    #define DEQUE_FIFO_TEST(len1, len2, len3)                           \
+        TEST_LEN(len1, len2, len3, WIDE);                               \
+        std::cout << "|         std         |";                         \
+        fifo_test<std::deque<int>>(len1, 100);                          \
+        fifo_test<std::deque<int>>(len2, 100);                          \
+        fifo_test<std::deque<int>>(len3, 100);                          \
+        std::cout << "\n|       tinystl       |";                       \
+        fifo_test<tinystl::deque<int>>(len1, 100);                      \
+        fifo_test<tinystl::deque<int>>(len2, 100);                      \
+        fifo_test<tinystl::deque<int>>(len3, 100);
+
+    // 把 len 个元素的 deque 复制到数组中，再在其中查找不存在的元素，重复 10 次
+    template <class Con, class Copy, class Find>
+    void copy_find_test(size_t len, Copy copy, Find find) {
+        volatile size_t sink = 0;
+        Con c(len, 1);
+        std::vector<int> out(len);
+        test_time([&]() {
+            for (int t = 0; t < 10; ++t) {
+                copy(c.begin(), c.end(), out.data());
+                sink = sink + (find(c.begin(), c.end(), 2) - c.begin());
+            }
+        });
+    }
+
+    #define STD_DEQUE_COPY_FIND(len)                                    \
+        copy_find_test<std::deque<int>>(len,                            \
+            [](std::deque<int>::iterator f, std::deque<int>::iterator l, int* r) { std::copy(f, l, r); }, \
+            [](std::deque<int>::iterator f, std::deque<int>::iterator l, int v) { return std::find(f, l, v); })
+
+    #define TINYSTL_DEQUE_COPY_FIND(len)                                \
+        copy_find_test<tinystl::deque<int>>(len,                        \
+            [](tinystl::deque<int>::iterator f, tinystl::deque<int>::iterator l, int* r) { tinystl::copy(f, l, r); }, \
+            [](tinystl::deque<int>::iterator f, tinystl::deque<int>::iterator l, int v) { return tinystl::find(f, l, v); })
+
+    #define DEQUE_COPY_FIND_TEST(len1, len2, len3)                      \
+        TEST_LEN(len1, len2, len3, WIDE);                               \
+        std::cout << "|         std         |";                         \
+        STD_DEQUE_COPY_FIND(len1);                                      \
+        STD_DEQUE_COPY_FIND(len2);                                      \
+        STD_DEQUE_COPY_FIND(len3);                                      \
+        std::cout << "\n|       tinystl       |";                       \
+        TINYSTL_DEQUE_COPY_FIND(len1);                                  \
+        TINYSTL_DEQUE_COPY_FIND(len2);                                  \
+        TINYSTL_DEQUE_COPY_FIND(len3);
+
     void deque_test() {
         std::cout << "[===============================================================]" << std::endl;
         std::cout << "[----------------- Run container test : deque ------------------]" << std::endl;
@@ -69,6 +133,20 @@ namespace deque_test {
         std::cout << std::noboolalpha;
         FUN_VALUE(d1.size());                                      // 5
         FUN_VALUE(d1.max_size());                                  // 18446744073709551615
+        tinystl::deque<int, tinystl::allocator<int>, 4> d11(a, a + 5);
+        FUN_VALUE(d11.buffer_size);                                // 4
+        FUN_AFTER(d11, d11.push_back(6));                          // 1 2 3 4 5 6
+        FUN_AFTER(d11, d11.pop_front());                           // 2 3 4 5 6
+        FUN_AFTER(d11, d11.push_front(0));                         // 0 2 3 4 5 6
+        FUN_AFTER(d11, d11.erase(d11.begin() + 1, d11.end() - 1)); // 0 6
+        for (int i = 0; i < 20; ++i) {
+            d11.push_back(i);
+            d11.pop_front();
+        }
+        FUN_VALUE(d11.size());                                     // 2
+        FUN_AFTER(d11, d11.insert(d11.begin(), a, a + 5));         // 1 2 3 4 5 18 19
+        FUN_VALUE(d11[5]);                                         // 18
+        FUN_VALUE((d11.end() - d11.begin()));                      // 7
         PASSED;
         #if PERFORMANCE_TEST_ON
         std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
@@ -89,6 +167,22 @@ namespace deque_test {
         #endif
         std::cout << std::endl;
         std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+        std::cout << "| push_back+pop_front |";
+        #if LARGER_TEST_DATA_ON
+        DEQUE_FIFO_TEST(SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+        #else
+        DEQUE_FIFO_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+        #endif
+        std::cout << std::endl;
+        std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+        std::cout << "|     copy + find     |";
+        #if LARGER_TEST_DATA_ON
+        DEQUE_COPY_FIND_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+        #else
+        DEQUE_COPY_FIND_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+        #endif
+        std::cout << std::endl;
+        std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
         PASSED;
         #endif
         std::cout << "[----------------- End container test : deque ------------------]" << std::endl;
@@ -0,0 +1,152 @@
+#ifndef TINYSTL_DYNAMIC_BITSET_TEST_H_
+#define TINYSTL_DYNAMIC_BITSET_TEST_H_
+
+// dynamic_bitset test : 测试 dynamic_bitset 与 bitset_rank_index 的接口，以及与 vector<char> 的扫描性能对比
+
+#include <string>
+
+#include "../TinySTL/dynamic_bitset.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace dynamic_bitset_test
+{
+
+// 在长度为 len、约 1/16 的位为 1 的位图上统计个数并遍历全部为 1 的位，重复 times 次
+void char_scan_test(size_t len, size_t times)
+{
+  srand((int)time(0));
+  tinystl::vector<char> v(len, 0);
+  for (size_t i = 0; i < len; ++i)
+    v[i] = (rand() & 15) == 0;
+  volatile size_t sink = 0;
+  test_time([&]() {
+    for (size_t t = 0; t < times; ++t)
+    {
+      size_t n = 0;
+      for (size_t i = 0; i < len; ++i)
+        n += v[i] != 0;
+      for (size_t i = 0; i < len; ++i)
+        if (v[i]) n += i;
+      sink = sink + n;
+    }
+  });
+}
+
+void bitset_scan_test(size_t len, size_t times)
+{
+  srand((int)time(0));
+  tinystl::dynamic_bitset<> b(len);
+  for (size_t i = 0; i < len; ++i)
+    b[i] = (rand() & 15) == 0;
+  volatile size_t sink = 0;
+  test_time([&]() {
+    for (size_t t = 0; t < times; ++t)
+    {
+      size_t n = b.count();
+      for (size_t i = b.find_first(); i != b.npos; i = b.find_next(i))
+        n += i;
+      sink = sink + n;
+    }
+  });
+}
+
+#define BITSET_SCAN_TEST(len1, len2, len3, times)                 \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|    vector<char>     |";                         \
+  char_scan_test(len1, times);                                    \
+  char_scan_test(len2, times);                                    \
+  char_scan_test(len3, times);                                    \
+  std::cout << "\n|   dynamic_bitset    |";                       \
+  bitset_scan_test(len1, times);                                  \
+  bitset_scan_test(len2, times);                                  \
+  bitset_scan_test(len3, times);
+
+void dynamic_bitset_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[------------- Run container test : dynamic_bitset -------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  tinystl::dynamic_bitset<> b1;
+  tinystl::dynamic_bitset<> b2(10);
+  tinystl::dynamic_bitset<> b3(70, true);
+  tinystl::dynamic_bitset<> b4{ true, false, true, true };
+  tinystl::dynamic_bitset<> b5(std::string("10110010"));
+  tinystl::dynamic_bitset<> b6(b5);
+  tinystl::dynamic_bitset<> b7(std::move(b6));
+
+  STR_COUT(b2.to_string());                                   // 0000000000
+  STR_COUT(b4.to_string());                                   // 1101
+  STR_COUT(b5.to_string());                                   // 10110010
+  FUN_VALUE(b3.count());                                      // 70
+  FUN_VALUE(b3.num_blocks());                                 // 2
+  std::cout << std::boolalpha;
+  FUN_VALUE(b3.all());                                        // true
+  FUN_VALUE(b2.none());                                       // true
+  FUN_VALUE(b5[1]);                                           // true
+  FUN_VALUE(b5.test(0));                                      // false
+  FUN_VALUE((b5 == b7));                                      // true
+  std::cout << std::noboolalpha;
+  STR_FUN_AFTER(b1.to_string(), b1.push_back(true));          // 1
+  STR_FUN_AFTER(b1.to_string(), b1.push_back(false));         // 01
+  STR_FUN_AFTER(b1.to_string(), b1.resize(6, true));          // 111101
+  STR_FUN_AFTER(b1.to_string(), b1.pop_back());               // 11101
+  STR_FUN_AFTER(b1.to_string(), b1.set(1));                   // 11111
+  STR_FUN_AFTER(b1.to_string(), b1.reset(4));                 // 01111
+  STR_FUN_AFTER(b1.to_string(), b1.flip());                   // 10000
+  STR_FUN_AFTER(b1.to_string(), b1[0] = true);                // 10001
+  STR_FUN_AFTER(b1.to_string(), b1.set());                    // 11111
+  STR_FUN_AFTER(b1.to_string(), b1.reset());                  // 00000
+  tinystl::dynamic_bitset<> b8(std::string("11001100"));
+  STR_COUT((b5 & b8).to_string());                            // 10000000
+  STR_COUT((b5 | b8).to_string());                            // 11111110
+  STR_COUT((b5 ^ b8).to_string());                            // 01111110
+  STR_COUT((b5 - b8).to_string());                            // 00110010
+  STR_COUT((~b5).to_string());                                // 01001101
+  STR_COUT((b5 << 3).to_string());                            // 10010000
+  STR_COUT((b5 >> 3).to_string());                            // 00010110
+  FUN_VALUE(b5.find_first());                                 // 1
+  FUN_VALUE(b5.find_next(1));                                 // 4
+  std::cout << std::boolalpha;
+  FUN_VALUE((b5.find_next(7) == b5.npos));                    // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(b5.rank(5));                                      // 2
+  FUN_VALUE(b5.select(2));                                    // 5
+  tinystl::dynamic_bitset<> b9(2000);
+  for (size_t i = 0; i < 2000; i += 3)
+    b9[i] = true;
+  tinystl::bitset_rank_index<> idx(b9);
+  FUN_VALUE(idx.count());                                     // 667
+  FUN_VALUE(idx.rank(1000));                                  // 334
+  FUN_VALUE(b9.rank(1000));                                   // 334
+  FUN_VALUE(idx.select(500));                                 // 1500
+  FUN_VALUE(b9.select(500));                                  // 1500
+  FUN_VALUE((b9 << 700).find_first());                        // 700
+  FUN_VALUE((b9 >> 700).find_first());                        // 2
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|  count + find_next  |";
+#if LARGER_TEST_DATA_ON
+  BITSET_SCAN_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3), 10);
+#else
+  BITSET_SCAN_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3), 10);
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[------------- End container test : dynamic_bitset -------------]\n";
+
+}
+
+} // namespace dynamic_bitset_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_DYNAMIC_BITSET_TEST_H_
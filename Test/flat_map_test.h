@@ -0,0 +1,168 @@
+#ifndef TINYSTL_FLAT_MAP_TEST_H
+#define TINYSTL_FLAT_MAP_TEST_H
+
+// flat_map test : 测试 flat_map, flat_multimap 的接口
+
+#include "../TinySTL/flat_map.h"
+#include "../TinySTL/vector.h"
+#include "map_test.h"  // PAIR, MAP_COUT, MAP_FUN_AFTER, MAP_VALUE
+#include "test.h"
+
+namespace tinystl {
+
+namespace test {
+
+namespace flat_map_test {
+
+void flat_map_test()
+{
+  std::cout << "[===============================================================]" << std::endl;
+  std::cout << "[---------------- Run container test : flat_map ----------------]" << std::endl;
+  std::cout << "[-------------------------- API test ---------------------------]" << std::endl;
+  tinystl::vector<PAIR> v;
+  for (int i = 0; i < 5; ++i)
+    v.push_back(PAIR(i, i));
+  tinystl::flat_map<int, int> m1;
+  tinystl::flat_map<int, int, tinystl::greater<int>> m2;
+  tinystl::flat_map<int, int> m3(v.begin(), v.end());
+  tinystl::flat_map<int, int> m4(v.begin(), v.end());
+  tinystl::flat_map<int, int> m5(m3);
+  tinystl::flat_map<int, int> m6(std::move(m3));
+  tinystl::flat_map<int, int> m7;
+  m7 = m4;
+  tinystl::flat_map<int, int> m8;
+  m8 = std::move(m4);
+  tinystl::flat_map<int, int> m9{ PAIR(1,1),PAIR(3,2),PAIR(2,3) };
+  tinystl::flat_map<int, int> m10;
+  m10 = { PAIR(1,1),PAIR(3,2),PAIR(2,3) };
+
+  for (int i = 5; i > 0; --i)
+  {
+    MAP_FUN_AFTER(m1, m1.emplace(i, i));
+  }
+  MAP_FUN_AFTER(m1, m1.emplace_hint(m1.begin(), 0, 0));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin()));
+  MAP_FUN_AFTER(m1, m1.erase(0));
+  MAP_FUN_AFTER(m1, m1.erase(1));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin(), m1.end()));
+  for (int i = 0; i < 5; ++i)
+  {
+    MAP_FUN_AFTER(m1, m1.insert(PAIR(i, i)));
+  }
+  MAP_FUN_AFTER(m1, m1.insert(v.begin(), v.end()));
+  MAP_FUN_AFTER(m1, m1.insert(m1.end(), PAIR(5, 5)));
+  FUN_VALUE(m1.count(1));
+  // 批量插入的区间内键值重复（且多于插入排序的阈值）时，与 map 一样保留每个键第一次出现的元素
+  tinystl::vector<PAIR> dup;
+  for (int i = 0; i < 40; ++i)
+    dup.push_back(PAIR(10 + i % 4, i));
+  tinystl::flat_map<int, int> m11;
+  MAP_FUN_AFTER(m11, m11.insert(dup.begin(), dup.end()));    // <10,0> <11,1> <12,2> <13,3>
+  MAP_VALUE(*m1.find(3));
+  MAP_VALUE(*m1.lower_bound(3));
+  MAP_VALUE(*m1.upper_bound(2));
+  auto first = *m1.equal_range(2).first;
+  auto second = *m1.equal_range(2).second;
+  std::cout << " m1.equal_range(2) : from <" << first.first << ", " << first.second
+    << "> to <" << second.first << ", " << second.second << ">" << std::endl;
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin()));
+  MAP_FUN_AFTER(m1, m1.erase(1));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin(), m1.find(3)));
+  MAP_FUN_AFTER(m1, m1.clear());
+  MAP_FUN_AFTER(m1, m1.swap(m9));
+  MAP_VALUE(*m1.begin());
+  MAP_VALUE(*m1.rbegin());
+  FUN_VALUE(m1[1]);
+  MAP_FUN_AFTER(m1, m1[1] = 3);
+  FUN_VALUE(m1.at(1));
+  MAP_FUN_AFTER(m1, m1.reserve(64));
+  FUN_VALUE(m1.capacity());
+  std::cout << std::boolalpha;
+  FUN_VALUE(m1.empty());
+  std::cout << std::noboolalpha;
+  FUN_VALUE(m1.size());
+  FUN_VALUE(m1.max_size());
+  PASSED;
+  std::cout << "[---------------- End container test : flat_map ----------------]" << std::endl;
+}
+
+void flat_multimap_test()
+{
+  std::cout << "[===============================================================]" << std::endl;
+  std::cout << "[------------- Run container test : flat_multimap --------------]" << std::endl;
+  std::cout << "[-------------------------- API test ---------------------------]" << std::endl;
+  tinystl::vector<PAIR> v;
+  for (int i = 0; i < 5; ++i)
+    v.push_back(PAIR(i, i));
+  tinystl::flat_multimap<int, int> m1;
+  tinystl::flat_multimap<int, int, tinystl::greater<int>> m2;
+  tinystl::flat_multimap<int, int> m3(v.begin(), v.end());
+  tinystl::flat_multimap<int, int> m4(v.begin(), v.end());
+  tinystl::flat_multimap<int, int> m5(m3);
+  tinystl::flat_multimap<int, int> m6(std::move(m3));
+  tinystl::flat_multimap<int, int> m7;
+  m7 = m4;
+  tinystl::flat_multimap<int, int> m8;
+  m8 = std::move(m4);
+  tinystl::flat_multimap<int, int> m9{ PAIR(1,1),PAIR(3,2),PAIR(2,3) };
+  tinystl::flat_multimap<int, int> m10;
+  m10 = { PAIR(1,1),PAIR(3,2),PAIR(2,3) };
+
+  for (int i = 5; i > 0; --i)
+  {
+    MAP_FUN_AFTER(m1, m1.emplace(i, i));
+  }
+  MAP_FUN_AFTER(m1, m1.emplace_hint(m1.begin(), 0, 0));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin()));
+  MAP_FUN_AFTER(m1, m1.erase(0));
+  MAP_FUN_AFTER(m1, m1.erase(1));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin(), m1.end()));
+  for (int i = 0; i < 5; ++i)
+  {
+    MAP_FUN_AFTER(m1, m1.insert(tinystl::make_pair(i, i)));
+  }
+  MAP_FUN_AFTER(m1, m1.insert(v.begin(), v.end()));
+  MAP_FUN_AFTER(m1, m1.insert(PAIR(5, 5)));
+  MAP_FUN_AFTER(m1, m1.insert(m1.end(), PAIR(5, 5)));
+  FUN_VALUE(m1.count(3));
+  // 批量插入的区间内键值相同的元素保持输入中的次序
+  tinystl::vector<PAIR> dup;
+  for (int i = 0; i < 40; ++i)
+    dup.push_back(PAIR(10 + i % 4, i));
+  tinystl::flat_multimap<int, int> m11;
+  m11.insert(dup.begin(), dup.end());
+  std::cout << " m11.equal_range(10) :";
+  for (auto it = m11.lower_bound(10); it != m11.upper_bound(10); ++it)
+    std::cout << " <" << it->first << "," << it->second << ">";      // <10,0> <10,4> ... <10,36>
+  std::cout << std::endl;
+  MAP_VALUE(*m1.find(3));
+  MAP_VALUE(*m1.lower_bound(3));
+  MAP_VALUE(*m1.upper_bound(2));
+  auto first = *m1.equal_range(2).first;
+  auto second = *m1.equal_range(2).second;
+  std::cout << " m1.equal_range(2) : from <" << first.first << ", " << first.second
+    << "> to <" << second.first << ", " << second.second << ">" << std::endl;
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin()));
+  MAP_FUN_AFTER(m1, m1.erase(1));
+  MAP_FUN_AFTER(m1, m1.erase(m1.begin(), m1.find(3)));
+  MAP_FUN_AFTER(m1, m1.clear());
+  MAP_FUN_AFTER(m1, m1.swap(m9));
+  MAP_FUN_AFTER(m1, m1.insert(PAIR(3, 3)));
+  MAP_VALUE(*m1.begin());
+  MAP_VALUE(*m1.rbegin());
+  std::cout << std::boolalpha;
+  FUN_VALUE(m1.empty());
+  std::cout << std::noboolalpha;
+  FUN_VALUE(m1.size());
+  FUN_VALUE(m1.max_size());
+  PASSED;
+  std::cout << "[------------- End container test : flat_multimap --------------]" << std::endl;
+}
+
+}  // namespace flat_map_test
+
+}  // namespace test
+
+}  // namespace tinystl
+
+#endif  // TINYSTL_FLAT_MAP_TEST_H
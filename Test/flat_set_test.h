@@ -0,0 +1,195 @@
+#ifndef TINYSTL_FLAT_SET_TEST_H
+#define TINYSTL_FLAT_SET_TEST_H
+
+// flat_set test : 测试 flat_set, flat_multiset 的接口与它们 find 的性能
+
+#include <set>
+#include <vector>
+
+#include "../TinySTL/flat_set.h"
+#include "test.h"
+
+namespace tinystl {
+
+namespace test {
+
+namespace flat_set_test {
+
+// 先批量插入 count 个随机数，再查找 count 次，统计查找耗时
+template <class Con>
+void find_test(size_t count) {
+    srand((int)time(0));
+    std::vector<int> v;
+    v.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        v.push_back(rand());
+    Con c(v.begin(), v.end());
+    volatile size_t hit = 0;  // 防止查找被优化掉
+    test_time([&]() {
+        for (size_t i = 0; i < count; ++i)
+            hit = hit + c.count(v[(i * 7) % count]);
+    });
+}
+
+#define FLAT_FIND_TEST(std_con, tiny_con, len1, len2, len3) \
+  TEST_LEN(len1, len2, len3, WIDE);                          \
+  std::cout << "|         std         |";                    \
+  find_test<std_con>(len1);                                  \
+  find_test<std_con>(len2);                                  \
+  find_test<std_con>(len3);                                  \
+  std::cout << "\n|       tinystl       |";                  \
+  find_test<tiny_con>(len1);                                 \
+  find_test<tiny_con>(len2);                                 \
+  find_test<tiny_con>(len3);
+
+void flat_set_test() {
+    std::cout << "[===============================================================]" << std::endl;
+    std::cout << "[---------------- Run container test : flat_set ----------------]" << std::endl;
+    std::cout << "[-------------------------- API test ---------------------------]" << std::endl;
+    int a[] = { 5,4,3,2,1 };
+    tinystl::flat_set<int> s1;
+    tinystl::flat_set<int, tinystl::greater<int>> s2;
+    tinystl::flat_set<int> s3(a, a + 5);
+    tinystl::flat_set<int> s4(a, a + 5);
+    tinystl::flat_set<int> s5(s3);
+    tinystl::flat_set<int> s6(std::move(s3));
+    tinystl::flat_set<int> s7;
+    s7 = s4;
+    tinystl::flat_set<int> s8;
+    s8 = std::move(s4);
+    tinystl::flat_set<int> s9{ 1,2,3,4,5 };
+    tinystl::flat_set<int> s10;
+    s10 = { 1,2,3,4,5 };
+
+    for (int i = 5; i > 0; --i) {
+        FUN_AFTER(s1, s1.emplace(i));
+    }
+    FUN_AFTER(s1, s1.emplace_hint(s1.begin(), 0));
+    FUN_AFTER(s1, s1.erase(s1.begin()));
+    FUN_AFTER(s1, s1.erase(0));
+    FUN_AFTER(s1, s1.erase(1));
+    FUN_AFTER(s1, s1.erase(s1.begin(), s1.end()));
+    for (int i = 0; i < 5; ++i) {
+        FUN_AFTER(s1, s1.insert(i));
+    }
+    FUN_AFTER(s1, s1.insert(a, a + 5));
+    FUN_AFTER(s1, s1.insert(5));
+    FUN_AFTER(s1, s1.insert(s1.end(), 6));
+    FUN_AFTER(s2, s2.insert(a, a + 5));
+    FUN_VALUE(s1.count(5));
+    FUN_VALUE(*s1.find(3));
+    FUN_VALUE(*s1.lower_bound(3));
+    FUN_VALUE(*s1.upper_bound(3));
+    auto first = *s1.equal_range(3).first;
+    auto second = *s1.equal_range(3).second;
+    std::cout << " s1.equal_range(3) : from " << first << " to " << second << std::endl;
+    FUN_AFTER(s1, s1.erase(s1.begin()));
+    FUN_AFTER(s1, s1.erase(1));
+    FUN_AFTER(s1, s1.erase(s1.begin(), s1.find(3)));
+    FUN_AFTER(s1, s1.clear());
+    FUN_AFTER(s1, s1.swap(s5));
+    FUN_AFTER(s1, s1.reserve(64));
+    FUN_VALUE(s1.capacity());
+    FUN_AFTER(s1, s1.shrink_to_fit());
+    FUN_VALUE(s1.capacity());
+    FUN_VALUE(*s1.begin());
+    FUN_VALUE(*s1.rbegin());
+    std::cout << std::boolalpha;
+    FUN_VALUE(s1.empty());
+    FUN_VALUE((s1 == s6));
+    std::cout << std::noboolalpha;
+    FUN_VALUE(s1.size());
+    FUN_VALUE(s1.max_size());
+    PASSED;
+    #if PERFORMANCE_TEST_ON
+    std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "|        find         |";
+    #if LARGER_TEST_DATA_ON
+    FLAT_FIND_TEST(std::set<int>, tinystl::flat_set<int>, SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+    #else
+    FLAT_FIND_TEST(std::set<int>, tinystl::flat_set<int>, SCALE_SS(LEN1), SCALE_SS(LEN2), SCALE_SS(LEN3));
+    #endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    PASSED;
+    #endif
+    std::cout << "[---------------- End container test : flat_set ----------------]" << std::endl;
+}
+
+void flat_multiset_test() {
+    std::cout << "[===============================================================]" << std::endl;
+    std::cout << "[------------- Run container test : flat_multiset --------------]" << std::endl;
+    std::cout << "[-------------------------- API test ---------------------------]" << std::endl;
+    int a[] = { 5,4,3,2,1 };
+    tinystl::flat_multiset<int> s1;
+    tinystl::flat_multiset<int, tinystl::greater<int>> s2;
+    tinystl::flat_multiset<int> s3(a, a + 5);
+    tinystl::flat_multiset<int> s4(a, a + 5);
+    tinystl::flat_multiset<int> s5(s3);
+    tinystl::flat_multiset<int> s6(std::move(s3));
+    tinystl::flat_multiset<int> s7;
+    s7 = s4;
+    tinystl::flat_multiset<int> s8;
+    s8 = std::move(s4);
+    tinystl::flat_multiset<int> s9{ 1,2,3,4,5 };
+    tinystl::flat_multiset<int> s10;
+    s10 = { 1,2,3,4,5 };
+
+    for (int i = 5; i > 0; --i) {
+        FUN_AFTER(s1, s1.emplace(i));
+    }
+    FUN_AFTER(s1, s1.emplace_hint(s1.begin(), 0));
+    FUN_AFTER(s1, s1.erase(s1.begin()));
+    FUN_AFTER(s1, s1.erase(0));
+    FUN_AFTER(s1, s1.erase(1));
+    FUN_AFTER(s1, s1.erase(s1.begin(), s1.end()));
+    for (int i = 0; i < 5; ++i) {
+        FUN_AFTER(s1, s1.insert(i));
+    }
+    FUN_AFTER(s1, s1.insert(a, a + 5));
+    FUN_AFTER(s1, s1.insert(5));
+    FUN_AFTER(s1, s1.insert(s1.end(), 5));
+    FUN_VALUE(s1.count(5));
+    FUN_VALUE(*s1.find(3));
+    FUN_VALUE(*s1.lower_bound(3));
+    FUN_VALUE(*s1.upper_bound(3));
+    auto first = *s1.equal_range(3).first;
+    auto second = *s1.equal_range(3).second;
+    std::cout << " s1.equal_range(3) : from " << first << " to " << second << std::endl;
+    FUN_AFTER(s1, s1.erase(s1.begin()));
+    FUN_AFTER(s1, s1.erase(1));
+    FUN_AFTER(s1, s1.erase(s1.begin(), s1.find(3)));
+    FUN_AFTER(s1, s1.clear());
+    FUN_AFTER(s1, s1.swap(s5));
+    FUN_VALUE(*s1.begin());
+    FUN_VALUE(*s1.rbegin());
+    std::cout << std::boolalpha;
+    FUN_VALUE(s1.empty());
+    std::cout << std::noboolalpha;
+    FUN_VALUE(s1.size());
+    FUN_VALUE(s1.max_size());
+    PASSED;
+  #if PERFORMANCE_TEST_ON
+    std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "|        find         |";
+  #if LARGER_TEST_DATA_ON
+    FLAT_FIND_TEST(std::multiset<int>, tinystl::flat_multiset<int>, SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+  #else
+    FLAT_FIND_TEST(std::multiset<int>, tinystl::flat_multiset<int>, SCALE_SS(LEN1), SCALE_SS(LEN2), SCALE_SS(LEN3));
+  #endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    PASSED;
+  #endif
+    std::cout << "[------------- End container test : flat_multiset --------------]" << std::endl;
+}
+
+}  // namespace flat_set_test
+
+}  // namespace test
+
+}  // namespace tinystl
+
+#endif  // TINYSTL_FLAT_SET_TEST_H
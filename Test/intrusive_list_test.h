@@ -0,0 +1,148 @@
+#ifndef TINYSTL_INTRUSIVE_LIST_TEST_H_
+#define TINYSTL_INTRUSIVE_LIST_TEST_H_
+
+// intrusive_list test : 测试 intrusive_list 的接口、一个元素同时位于两个链表中，以及与 list 的插入删除性能对比
+
+#include <string>
+
+#include "../TinySTL/intrusive_list.h"
+#include "../TinySTL/list.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace intrusive_list_test
+{
+
+struct lru_tag {};
+
+// 同时带有两个钩子的元素
+struct item : public tinystl::list_hook<>, public tinystl::list_hook<lru_tag>
+{
+  int value;
+  item(int v = 0) : value(v) {}
+};
+
+std::ostream& operator<<(std::ostream& os, const item& x)
+{
+  return os << x.value;
+}
+
+typedef tinystl::intrusive_list<item>          item_list;
+typedef tinystl::intrusive_list<item, lru_tag> lru_list;
+
+// 依次 push_back count 个元素，再全部 pop_front，统计耗时
+void list_push_pop_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  test_time([&]() {
+    tinystl::list<int> l;
+    for (size_t i = 0; i < count; ++i)
+      l.push_back(static_cast<int>(i));
+    while (!l.empty())
+    {
+      sink = sink + l.front();
+      l.pop_front();
+    }
+  });
+}
+
+// 元素预先放在 vector 中，计时部分不分配内存
+void intrusive_push_pop_test(size_t count)
+{
+  volatile size_t sink = 0;
+  tinystl::vector<item> v(count);
+  for (size_t i = 0; i < count; ++i)
+    v[i].value = static_cast<int>(i);
+  test_time([&]() {
+    item_list l;
+    for (size_t i = 0; i < count; ++i)
+      l.push_back(v[i]);
+    while (!l.empty())
+    {
+      sink = sink + l.front().value;
+      l.pop_front();
+    }
+  });
+}
+
+#define INTRUSIVE_LIST_PUSH_POP_TEST(len1, len2, len3)            \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|    tinystl list     |";                         \
+  list_push_pop_test(len1);                                       \
+  list_push_pop_test(len2);                                       \
+  list_push_pop_test(len3);                                       \
+  std::cout << "\n|   intrusive_list    |";                       \
+  intrusive_push_pop_test(len1);                                  \
+  intrusive_push_pop_test(len2);                                  \
+  intrusive_push_pop_test(len3);
+
+bool is_odd(const item& x) { return x.value % 2 == 1; }
+
+void intrusive_list_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[------------- Run container test : intrusive_list -------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  item a[8];
+  for (int i = 0; i < 8; ++i)
+    a[i].value = i + 1;
+  item_list l1(a, a + 5);
+  lru_list l2;
+  for (int i = 0; i < 8; ++i)
+    l2.push_back(a[i]);
+
+  FUN_AFTER(l1, l1.push_front(a[5]));                         // 6 1 2 3 4 5
+  FUN_AFTER(l1, l1.push_back(a[6]));                          // 6 1 2 3 4 5 7
+  FUN_AFTER(l1, l1.pop_front());                              // 1 2 3 4 5 7
+  FUN_AFTER(l1, l1.erase(l1.iterator_to(a[2])));              // 1 2 4 5 7
+  FUN_AFTER(l1, l1.insert(l1.iterator_to(a[4]), a[2]));       // 1 2 4 3 5 7
+  FUN_AFTER(l1, l1.reverse());                                // 7 5 3 4 2 1
+  FUN_VALUE(l1.front());                                      // 7
+  FUN_VALUE(l1.back());                                       // 1
+  FUN_VALUE(*l1.rbegin());                                    // 1
+  FUN_VALUE(l1.size());                                       // 6
+  // 同一批元素同时位于 l2 中，互不影响
+  FUN_AFTER(l2, l2.splice(l2.begin(), l2, l2.iterator_to(a[7])));  // 8 1 2 3 4 5 6 7
+  FUN_AFTER(l2, l2.splice(l2.end(), l2, l2.begin(), l2.iterator_to(a[1])));  // 2 3 4 5 6 7 8 1
+  FUN_VALUE(l2.size());                                       // 8
+  FUN_AFTER(l1, l1.remove_if(is_odd));                        // 4 2
+  item_list l3;
+  FUN_AFTER(l3, l3.splice(l3.end(), l1));                     // 4 2
+  FUN_VALUE(l1.size());                                       // 0
+  item_list l4(std::move(l3));
+  FUN_AFTER(l4, l4.push_back(a[0]));                          // 4 2 1
+  FUN_VALUE(l3.size());                                       // 0
+  FUN_AFTER(l3, l3.swap(l4));                                 // 4 2 1
+  FUN_AFTER(l4, l4 = std::move(l3));                          // 4 2 1
+  FUN_AFTER(l4, l4.clear());                                  //
+  std::cout << std::boolalpha;
+  FUN_VALUE(l4.empty());                                      // true
+  std::cout << std::noboolalpha;
+  FUN_AFTER(l2, l2.pop_back());                               // 2 3 4 5 6 7 8
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "| push_back+pop_front |";
+#if LARGER_TEST_DATA_ON
+  INTRUSIVE_LIST_PUSH_POP_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+  INTRUSIVE_LIST_PUSH_POP_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[------------- End container test : intrusive_list -------------]\n";
+
+}
+
+} // namespace intrusive_list_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_INTRUSIVE_LIST_TEST_H_
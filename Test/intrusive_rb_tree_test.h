@@ -0,0 +1,190 @@
+#ifndef TINYSTL_INTRUSIVE_RB_TREE_TEST_H_
+#define TINYSTL_INTRUSIVE_RB_TREE_TEST_H_
+
+// intrusive_rb_tree test : 测试 intrusive_rb_tree 的接口、一个元素同时位于两棵树中，以及与 multiset 的插入删除性能对比
+
+#include <string>
+
+#include "../TinySTL/intrusive_rb_tree.h"
+#include "../TinySTL/intrusive_list.h"
+#include "../TinySTL/set.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace intrusive_rb_tree_test
+{
+
+struct timer_tag {};
+
+// 连接对象：按 id 索引，按 deadline 排序，同时位于一个链表中
+struct conn : public tinystl::rb_tree_hook<>, public tinystl::rb_tree_hook<timer_tag>,
+              public tinystl::list_hook<>
+{
+  int id;
+  int deadline;
+  conn(int i = 0, int d = 0) : id(i), deadline(d) {}
+};
+
+struct conn_id
+{
+  const int& operator()(const conn& c) const { return c.id; }
+};
+
+struct conn_deadline
+{
+  const int& operator()(const conn& c) const { return c.deadline; }
+};
+
+std::ostream& operator<<(std::ostream& os, const conn& c)
+{
+  return os << c.id;
+}
+
+typedef tinystl::intrusive_rb_tree<conn, conn_id>                                      id_index;
+typedef tinystl::intrusive_rb_tree<conn, conn_deadline, tinystl::less<int>, timer_tag> timer_queue;
+
+// 性能测试用的元素，大小与 multiset<int> 的节点相同
+struct key_node : public tinystl::rb_tree_hook<>
+{
+  int key;
+};
+
+struct node_key
+{
+  const int& operator()(const key_node& x) const { return x.key; }
+};
+
+// 插入 count 个随机键值，再从最小的元素开始全部删除，统计耗时
+void multiset_test(size_t count)
+{
+  srand((int)time(0));
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  tinystl::vector<int> keys(count);
+  for (size_t i = 0; i < count; ++i)
+    keys[i] = rand();
+  test_time([&]() {
+    tinystl::multiset<int> s;
+    for (size_t i = 0; i < count; ++i)
+      s.insert(keys[i]);
+    while (!s.empty())
+    {
+      sink = sink + *s.begin();
+      s.erase(s.begin());
+    }
+  });
+}
+
+// 元素预先放在 vector 中，计时部分不分配内存
+void intrusive_test(size_t count)
+{
+  srand((int)time(0));
+  volatile size_t sink = 0;
+  tinystl::vector<key_node> v(count);
+  for (size_t i = 0; i < count; ++i)
+    v[i].key = rand();
+  test_time([&]() {
+    tinystl::intrusive_rb_tree<key_node, node_key> t;
+    for (size_t i = 0; i < count; ++i)
+      t.insert_multi(v[i]);
+    while (!t.empty())
+    {
+      sink = sink + t.begin()->key;
+      t.erase(t.begin());
+    }
+  });
+}
+
+#define INTRUSIVE_RB_TREE_TEST(len1, len2, len3)                  \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|  tinystl multiset   |";                         \
+  multiset_test(len1);                                            \
+  multiset_test(len2);                                            \
+  multiset_test(len3);                                            \
+  std::cout << "\n|  intrusive_rb_tree  |";                       \
+  intrusive_test(len1);                                           \
+  intrusive_test(len2);                                           \
+  intrusive_test(len3);
+
+void intrusive_rb_tree_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[----------- Run container test : intrusive_rb_tree ------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  conn c[6] = { conn(5, 30), conn(3, 10), conn(8, 20), conn(1, 10), conn(4, 50), conn(7, 40) };
+  conn dup(5, 0);
+  id_index t1;
+  timer_queue t2;
+  tinystl::intrusive_list<conn> l1;
+  for (int i = 0; i < 6; ++i)
+  {
+    t1.insert_unique(c[i]);
+    t2.insert_multi(c[i]);
+    l1.push_back(c[i]);
+  }
+
+  COUT(t1);                                                   // 1 3 4 5 7 8
+  COUT(t2);                                                   // 3 1 8 5 7 4  按 deadline 排序
+  std::cout << std::boolalpha;
+  FUN_VALUE(t1.insert_unique(dup).second);                    // false
+  FUN_VALUE((t1.upper_bound(8) == t1.end()));                 // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(t1.size());                                       // 6
+  FUN_VALUE(t1.find(4)->deadline);                            // 50
+  FUN_VALUE(t1.lower_bound(6)->id);                           // 7
+  FUN_VALUE(t1.rbegin()->id);                                 // 8
+  FUN_VALUE(t2.count_multi(10));                              // 2
+  FUN_VALUE(t2.begin()->id);                                  // 3
+  FUN_AFTER(t1, t1.erase(t1.iterator_to(c[0])));              // 1 3 4 7 8
+  FUN_AFTER(t1, t1.erase_unique(8));                          // 1 3 4 7
+  FUN_AFTER(t2, t2.erase_multi(10));                          // 8 5 7 4
+  FUN_AFTER(t2, t2.erase(t2.iterator_to(c[4])));              // 8 5 7
+  FUN_VALUE(l1.size());                                       // 6
+  timer_queue t3(std::move(t2));
+  COUT(t3);                                                   // 8 5 7
+  FUN_VALUE(t2.size());                                       // 0
+  FUN_AFTER(t2, t2.insert_multi(c[1]));                       // 3
+  FUN_AFTER(t2, t2.swap(t3));                                 // 8 5 7
+  FUN_AFTER(t3, t3 = std::move(t2));                          // 8 5 7
+  FUN_AFTER(t1, t1.clear());                                  //
+  // 随机插入、交错删除后仍然有序
+  tinystl::vector<conn> v(1000);
+  for (int i = 0; i < 1000; ++i)
+    v[i].id = (i * 7919) % 1000;
+  for (int i = 0; i < 1000; ++i)
+    t1.insert_multi(v[i]);
+  for (int i = 0; i < 1000; i += 2)
+    t1.erase(t1.iterator_to(v[i]));
+  bool sorted = true;
+  for (auto it = t1.begin(), prev = it++; it != t1.end(); prev = it++)
+    sorted = sorted && prev->id < it->id;
+  std::cout << std::boolalpha;
+  FUN_VALUE(sorted);                                          // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(t1.size());                                       // 500
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|   insert + erase    |";
+#if LARGER_TEST_DATA_ON
+  INTRUSIVE_RB_TREE_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#else
+  INTRUSIVE_RB_TREE_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[----------- End container test : intrusive_rb_tree ------------]\n";
+
+}
+
+} // namespace intrusive_rb_tree_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_INTRUSIVE_RB_TREE_TEST_H_
@@ -1,10 +1,11 @@
 #ifndef TINYSTL_LIST_TEST_H_
 #define TINYSTL_LIST_TEST_H_
 
-// list test : 测试 list 的接口与 insert, sort 的性能
+// list test : 测试 list 的接口与 insert, sort, 空 list 构造的性能
 
 #include <list>
 #include "../TinySTL/list.h"
+#include "../TinySTL/node_pool.h"
 #include "test.h"
 
 namespace tinystl {
@@ -16,6 +17,68 @@ namespace list_test {
 // 一个辅助测试函数
 bool is_odd(int x) { return x & 1; }
 
+// 只比较 first，用于检查 sort 的稳定性
+struct first_less {
+  bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+    return a.first < b.first;
+  }
+};
+
+// 对 count 个长度为 8 的 list 排序，统计耗时
+template <class Con>
+void small_sort_test(size_t count)
+{
+  srand((int)time(0));
+  volatile int sink = 0;
+  test_time([&]() {
+    for (size_t i = 0; i < count; ++i)
+    {
+      Con l;
+      for (int j = 0; j < 8; ++j)
+        l.push_back(rand());
+      l.sort();
+      sink = sink + l.front();
+    }
+  });
+}
+
+#define LIST_SMALL_SORT_TEST(len1, len2, len3)                    \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|         std         |";                         \
+  small_sort_test<std::list<int>>(len1);                          \
+  small_sort_test<std::list<int>>(len2);                          \
+  small_sort_test<std::list<int>>(len3);                          \
+  std::cout << "\n|       tinystl       |";                       \
+  small_sort_test<tinystl::list<int>>(len1);                      \
+  small_sort_test<tinystl::list<int>>(len2);                      \
+  small_sort_test<tinystl::list<int>>(len3);
+
+// 构造、移动并析构 count 对空 list，统计耗时
+template <class Con>
+void empty_con_test(size_t count)
+{
+  volatile size_t sink = 0;
+  test_time([&]() {
+    for (size_t i = 0; i < count; ++i)
+    {
+      Con a;
+      Con b(std::move(a));
+      sink = sink + b.size();
+    }
+  });
+}
+
+#define LIST_EMPTY_TEST(len1, len2, len3)                         \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|         std         |";                         \
+  empty_con_test<std::list<int>>(len1);                           \
+  empty_con_test<std::list<int>>(len2);                           \
+  empty_con_test<std::list<int>>(len3);                           \
+  std::cout << "\n|       tinystl       |";                       \
+  empty_con_test<tinystl::list<int>>(len1);                       \
+  empty_con_test<tinystl::list<int>>(len2);                       \
+  empty_con_test<tinystl::list<int>>(len3);
+
 void list_test() {
   std::cout << "[===============================================================]" << std::endl;
   std::cout << "[------------------ Run container test : list ------------------]" << std::endl;
@@ -83,6 +146,34 @@ void list_test() {
   std::cout << std::noboolalpha;
   FUN_VALUE(l1.size());                                                  // 5
   FUN_VALUE(l1.max_size());                                              // 18446744073709551615
+  tinystl::list<int, tinystl::pool_alloc> l11{ 5,3,1 };                  // 节点从 node_pool 中分配
+  FUN_AFTER(l11, l11.push_back(4));                                      // 5 3 1 4
+  FUN_AFTER(l11, l11.sort());                                            // 1 3 4 5
+  FUN_AFTER(l11, l11.pop_front());                                       // 3 4 5
+  FUN_VALUE((tinystl::node_pool<sizeof(tinystl::list_node<int>),
+             alignof(tinystl::list_node<int>)>::slab_count()));          // 1
+  tinystl::list<std::pair<int, int>> l12;
+  for (int i = 0; i < 1000; ++i)
+    l12.push_back(std::make_pair((i * 7919) % 10, i));
+  l12.sort(first_less());                                                // 超过 LIST_SORT_STACK_NODES，使用堆上的缓冲区
+  int unstable = 0;
+  for (auto i = l12.begin(), j = ++l12.begin(); j != l12.end(); ++i, ++j)
+    unstable += i->first > j->first || (i->first == j->first && i->second > j->second);
+  FUN_VALUE(unstable);                                                   // 0
+  FUN_VALUE(l12.front().second);                                         // 0
+  FUN_VALUE(l12.back().second);                                          // 991
+  FUN_VALUE(l12.size());                                                 // 1000
+  std::cout << std::boolalpha;
+  FUN_VALUE(std::is_nothrow_default_constructible<tinystl::list<int>>::value);  // true
+  std::cout << std::noboolalpha;
+  tinystl::list<tinystl::pair<int, int>> l13;                            // 哨兵不再构造 T，元素类型可以没有默认构造函数
+  l13.push_back(tinystl::make_pair(1, 2));
+  FUN_VALUE(l13.front().second);                                         // 2
+  tinystl::list<int> l14{ 1,2,3 };
+  tinystl::list<int> l15(std::move(l14));
+  FUN_AFTER(l14, l14.push_back(4));                                      // 4  被移动的 list 仍然可用
+  FUN_AFTER(l15, l15.swap(l14));                                         // 4
+  FUN_AFTER(l14, l14 = std::move(l15));                                  // 4
   PASSED;
 #if PERFORMANCE_TEST_ON
   std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
@@ -100,6 +191,22 @@ void list_test() {
   LIST_SORT_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
 #else
   LIST_SORT_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+#endif
+  std::cout << std::endl;
+  std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+  std::cout << "|   sort 8-node lists |";
+#if LARGER_TEST_DATA_ON
+  LIST_SMALL_SORT_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#else
+  LIST_SMALL_SORT_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+#endif
+  std::cout << std::endl;
+  std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+  std::cout << "|  empty list + move  |";
+#if LARGER_TEST_DATA_ON
+  LIST_EMPTY_TEST(SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+#else
+  LIST_EMPTY_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
 #endif
   std::cout << std::endl;
   std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
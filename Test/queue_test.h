@@ -22,7 +22,8 @@ void queue_print(tinystl::queue<int> q) {
     std::cout << std::endl;
 }
 
-void p_queue_print(tinystl::priority_queue<int> p) {
+template <class PQueue>
+void p_queue_print(PQueue p) {
     while (!p.empty()) {
         std::cout << " " << p.top();
         p.pop();
@@ -37,6 +38,111 @@ void p_queue_print(tinystl::priority_queue<int> p) {
     queue_print(q);                              \
 } while(0)
 
+// 先 push count 个随机数，再全部 pop，统计耗时
+template <class PQueue>
+void push_pop_test(size_t count) {
+    srand((int)time(0));
+    volatile size_t sink = 0;  // 防止操作被优化掉
+    tinystl::vector<int> v(count);
+    for (size_t i = 0; i < count; ++i)
+        v[i] = rand();
+    test_time([&]() {
+        PQueue p;
+        for (size_t i = 0; i < count; ++i)
+            p.push(v[i]);
+        while (!p.empty()) {
+            sink = sink + p.top();
+            p.pop();
+        }
+    });
+}
+
+// 以 1000 个元素为一批加入 count 个递增的值并随后全部取出，Batch 为 true 时使用 push_range，否则逐个 push
+template <bool Batch>
+void batch_push_test(size_t count) {
+    volatile size_t sink = 0;
+    const size_t batch = 1000;
+    tinystl::vector<int> v(count);
+    for (size_t i = 0; i < count; ++i)
+        v[i] = static_cast<int>(i);
+    test_time([&]() {
+        tinystl::priority_queue<int> p;
+        for (size_t i = 0; i < count; i += batch) {
+            const size_t n = count - i < batch ? count - i : batch;
+            if (Batch) {
+                p.push_range(v.begin() + i, v.begin() + i + n);
+            }
+            else {
+                for (size_t j = i; j < i + n; ++j)
+                    p.push(v[j]);
+            }
+            while (!p.empty()) {
+                sink = sink + p.top();
+                p.pop();
+            }
+        }
+    });
+}
+
+// 在 count / 10 个元素的堆上反复取出堆顶并放回一个更小的值，共 count 次
+template <bool Replace>
+void replace_top_test(size_t count) {
+    srand((int)time(0));
+    volatile size_t sink = 0;
+    tinystl::vector<int> v(count / 10);
+    for (size_t i = 0; i < v.size(); ++i)
+        v[i] = rand();
+    tinystl::priority_queue<int> p(v.begin(), v.end());
+    test_time([&]() {
+        for (size_t i = 0; i < count; ++i) {
+            const int top = p.top();
+            sink = sink + top;
+            if (Replace) {
+                p.replace_top(top - rand() % 1000);
+            }
+            else {
+                p.pop();
+                p.push(top - rand() % 1000);
+            }
+        }
+    });
+}
+
+#define P_QUEUE_BATCH_TEST(fun, name1, name2, len1, len2, len3)  \
+    TEST_LEN(len1, len2, len3, WIDE);                            \
+    std::cout << name1;                                          \
+    fun<false>(len1);                                            \
+    fun<false>(len2);                                            \
+    fun<false>(len3);                                            \
+    std::cout << "\n" << name2;                                  \
+    fun<true>(len1);                                             \
+    fun<true>(len2);                                             \
+    fun<true>(len3);
+
+typedef tinystl::priority_queue<int, tinystl::vector<int>, tinystl::less<int>,
+                                tinystl::dary_heap_policy<4>> quaternary_queue;
+typedef tinystl::priority_queue<int, tinystl::vector<int>, tinystl::less<int>,
+                                tinystl::dary_heap_policy<8>> octonary_queue;
+
+#define P_QUEUE_PUSH_POP_TEST(len1, len2, len3)                  \
+    TEST_LEN(len1, len2, len3, WIDE);                            \
+    std::cout << "|         std         |";                      \
+    push_pop_test<std::priority_queue<int>>(len1);               \
+    push_pop_test<std::priority_queue<int>>(len2);               \
+    push_pop_test<std::priority_queue<int>>(len3);               \
+    std::cout << "\n|   tinystl binary    |";                    \
+    push_pop_test<tinystl::priority_queue<int>>(len1);           \
+    push_pop_test<tinystl::priority_queue<int>>(len2);           \
+    push_pop_test<tinystl::priority_queue<int>>(len3);           \
+    std::cout << "\n|   tinystl 4-ary     |";                    \
+    push_pop_test<quaternary_queue>(len1);                       \
+    push_pop_test<quaternary_queue>(len2);                       \
+    push_pop_test<quaternary_queue>(len3);                       \
+    std::cout << "\n|   tinystl 8-ary     |";                    \
+    push_pop_test<octonary_queue>(len1);                         \
+    push_pop_test<octonary_queue>(len2);                         \
+    push_pop_test<octonary_queue>(len3);
+
 // priority_queue 的遍历输出
 #define P_QUEUE_COUT(p) do {                     \
     std::string p_name = #p;                     \
@@ -153,6 +259,17 @@ void priority_test() {
     }
     P_QUEUE_FUN_AFTER(p1, p1.swap(p4));           // 5 4 3 2 1
     P_QUEUE_FUN_AFTER(p1, p1.clear());            //
+    quaternary_queue p13(a, a + 5);
+    octonary_queue p14{ 3,9,1,7,5,8,2,6,4,0 };
+    P_QUEUE_COUT(p13);                            // 5 4 3 2 1
+    P_QUEUE_FUN_AFTER(p14, p14.push(10));         // 10 9 8 7 6 5 4 3 2 1 0
+    P_QUEUE_FUN_AFTER(p14, p14.pop());            // 9 8 7 6 5 4 3 2 1 0
+    P_QUEUE_FUN_AFTER(p13, p13.push_range(a, a + 3));    // 5 4 3 3 2 2 1 1
+    P_QUEUE_FUN_AFTER(p14, p14.push_range({ 12,11 }));   // 12 11 9 8 7 6 5 4 3 2 1 0
+    P_QUEUE_FUN_AFTER(p14, p14.replace_top(-1));         // 11 9 8 7 6 5 4 3 2 1 0 -1
+    P_QUEUE_FUN_AFTER(p11, p11.replace_top(3));          // 4 3 3 2 1
+    octonary_queue p15(p14);
+    P_QUEUE_FUN_AFTER(p15, p15.push(20));                // 20 11 9 8 7 6 5 4 3 2 1 0 -1
     PASSED;
 #if PERFORMANCE_TEST_ON
     std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
@@ -162,6 +279,34 @@ void priority_test() {
     CON_TEST_P1(priority_queue<int>, push, rand(), SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
 #else
     CON_TEST_P1(priority_queue<int>, push, rand(), SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "|     push + pop      |";
+#if LARGER_TEST_DATA_ON
+    P_QUEUE_PUSH_POP_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+    P_QUEUE_PUSH_POP_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "| batch push + drain  |";
+#if LARGER_TEST_DATA_ON
+    P_QUEUE_BATCH_TEST(batch_push_test, "|     push x 1000     |", "|     push_range      |",
+                       SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+    P_QUEUE_BATCH_TEST(batch_push_test, "|     push x 1000     |", "|     push_range      |",
+                       SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "|   top + pop + push  |";
+#if LARGER_TEST_DATA_ON
+    P_QUEUE_BATCH_TEST(replace_top_test, "|     pop + push      |", "|     replace_top     |",
+                       SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+    P_QUEUE_BATCH_TEST(replace_top_test, "|     pop + push      |", "|     replace_top     |",
+                       SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
 #endif
     std::cout << std::endl;
     std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
@@ -0,0 +1,152 @@
+#ifndef TINYSTL_RADIX_HEAP_TEST_H_
+#define TINYSTL_RADIX_HEAP_TEST_H_
+
+// radix_heap test : 测试 radix_heap 的接口，以及模拟事件调度时与 priority_queue 的性能对比
+
+#include <string>
+
+#include "../TinySTL/radix_heap.h"
+#include "../TinySTL/queue.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace radix_heap_test
+{
+
+typedef tinystl::pair<unsigned long long, int> event;  // (时间戳, 事件编号)
+
+// 依次弹出堆中的元素并输出键
+template <class Heap>
+void heap_print(Heap h)
+{
+  while (!h.empty())
+  {
+    std::cout << " " << h.top().first;
+    h.pop();
+  }
+  std::cout << std::endl;
+}
+
+#define HEAP_COUT(h) do {                        \
+  std::string h_name = #h;                       \
+  std::cout << " " << h_name << " :";            \
+  heap_print(h);                                 \
+} while(0)
+
+#define HEAP_FUN_AFTER(con, fun) do {            \
+  std::string fun_name = #fun;                   \
+  std::cout << " After " << fun_name << " :\n";  \
+  fun;                                           \
+  HEAP_COUT(con);                                \
+} while(0)
+
+// 预先放入 count / 10 个事件，之后每次取出最早的事件并安排一个稍后的新事件，共 count 次
+void priority_queue_test(size_t count)
+{
+  srand((int)time(0));
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  test_time([&]() {
+    tinystl::priority_queue<event, tinystl::vector<event>, tinystl::greater<event>> q;
+    for (size_t i = 0; i < count / 10; ++i)
+      q.push(event(rand() % 100000, static_cast<int>(i)));
+    for (size_t i = 0; i < count; ++i)
+    {
+      event e = q.top();
+      q.pop();
+      sink = sink + e.second;
+      q.push(event(e.first + rand() % 100000, e.second));
+    }
+  });
+}
+
+void radix_test(size_t count)
+{
+  srand((int)time(0));
+  volatile size_t sink = 0;
+  test_time([&]() {
+    tinystl::radix_heap<unsigned long long, int> q;
+    for (size_t i = 0; i < count / 10; ++i)
+      q.push(rand() % 100000, static_cast<int>(i));
+    for (size_t i = 0; i < count; ++i)
+    {
+      event e = q.top();
+      q.pop();
+      sink = sink + e.second;
+      q.push(e.first + rand() % 100000, e.second);
+    }
+  });
+}
+
+#define RADIX_HEAP_TEST(len1, len2, len3)                         \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|   priority_queue    |";                         \
+  priority_queue_test(len1);                                      \
+  priority_queue_test(len2);                                      \
+  priority_queue_test(len3);                                      \
+  std::cout << "\n|     radix_heap      |";                       \
+  radix_test(len1);                                               \
+  radix_test(len2);                                               \
+  radix_test(len3);
+
+void radix_heap_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[--------------- Run container test : radix_heap ---------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  tinystl::radix_heap<unsigned, int> h1;
+  tinystl::radix_heap<int, std::string> h2;
+  unsigned k[] = { 9, 3, 7, 3, 12, 100, 64 };
+  for (int i = 0; i < 7; ++i)
+    h1.push(k[i], i);
+
+  HEAP_COUT(h1);                                              // 3 3 7 9 12 64 100
+  FUN_VALUE(h1.top_key());                                    // 3
+  FUN_VALUE(h1.size());                                       // 7
+  HEAP_FUN_AFTER(h1, h1.pop());                               // 3 7 9 12 64 100
+  HEAP_FUN_AFTER(h1, h1.pop());                               // 7 9 12 64 100
+  // 新键不小于最后一次弹出的键 3 即可，可以小于当前的堆顶
+  HEAP_FUN_AFTER(h1, h1.push(4, 7));                          // 4 7 9 12 64 100
+  FUN_VALUE(h1.top().second);                                 // 7
+  HEAP_FUN_AFTER(h1, h1.push(tinystl::pair<unsigned, int>(1000, 8)));  // 4 7 9 12 64 100 1000
+  // 有符号的键
+  h2.push(-5, "a");
+  h2.push(3, "b");
+  h2.emplace(-20, 2, 'c');
+  h2.push(0, "d");
+  HEAP_COUT(h2);                                              // -20 -5 0 3
+  FUN_VALUE(h2.top().second);                                 // cc
+  HEAP_FUN_AFTER(h2, h2.pop());                               // -5 0 3
+  tinystl::radix_heap<int, std::string> h3(std::move(h2));
+  HEAP_COUT(h3);                                              // -5 0 3
+  FUN_VALUE(h2.size());                                       // 0
+  HEAP_FUN_AFTER(h2, h2.swap(h3));                            // -5 0 3
+  HEAP_FUN_AFTER(h2, h2.clear());                             //
+  std::cout << std::boolalpha;
+  FUN_VALUE(h2.empty());                                      // true
+  std::cout << std::noboolalpha;
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|   event scheduling  |";
+#if LARGER_TEST_DATA_ON
+  RADIX_HEAP_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+  RADIX_HEAP_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[--------------- End container test : radix_heap ---------------]\n";
+
+}
+
+} // namespace radix_heap_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_RADIX_HEAP_TEST_H_
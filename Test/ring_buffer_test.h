@@ -0,0 +1,172 @@
+#ifndef TINYSTL_RING_BUFFER_TEST_H_
+#define TINYSTL_RING_BUFFER_TEST_H_
+
+// ring_buffer test : 测试 ring_buffer 的接口，以及作为 queue 的底层容器时与 deque 的性能对比
+
+#include <string>
+
+#include "../TinySTL/ring_buffer.h"
+#include "../TinySTL/queue.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace ring_buffer_test
+{
+
+// 输出一段连续内存中的元素
+#define SEGMENT_COUT(seg) do {                   \
+  std::string seg_name = #seg;                   \
+  std::cout << " " << seg_name << " :";          \
+  for (size_t i = 0; i < (seg).second; ++i)      \
+    std::cout << " " << (seg).first[i];          \
+  std::cout << std::endl;                        \
+} while(0)
+
+// 先 push count 个元素，再全部 pop
+template <class Queue>
+void push_pop_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  test_time([&]() {
+    Queue q;
+    for (size_t i = 0; i < count; ++i)
+      q.push(static_cast<int>(i));
+    while (!q.empty())
+    {
+      sink = sink + q.front();
+      q.pop();
+    }
+  });
+}
+
+// 保持队列中有 1000 个元素，每次 push 一个再 pop 一个，共 count 次
+template <class Queue>
+void steady_test(size_t count)
+{
+  volatile size_t sink = 0;
+  test_time([&]() {
+    Queue q;
+    for (int i = 0; i < 1000; ++i)
+      q.push(i);
+    for (size_t i = 0; i < count; ++i)
+    {
+      q.push(static_cast<int>(i));
+      sink = sink + q.front();
+      q.pop();
+    }
+  });
+}
+
+typedef tinystl::queue<int>                               deque_queue;
+typedef tinystl::queue<int, tinystl::ring_buffer<int>>    ring_queue;
+
+#define RING_BUFFER_TEST(test, len1, len2, len3)                  \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|    queue<deque>     |";                         \
+  test<deque_queue>(len1);                                        \
+  test<deque_queue>(len2);                                        \
+  test<deque_queue>(len3);                                        \
+  std::cout << "\n| queue<ring_buffer>  |";                       \
+  test<ring_queue>(len1);                                         \
+  test<ring_queue>(len2);                                         \
+  test<ring_queue>(len3);
+
+void ring_buffer_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[-------------- Run container test : ring_buffer ---------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  int a[] = { 1,2,3,4,5 };
+  tinystl::ring_buffer<int> r1;
+  tinystl::ring_buffer<int> r2(3, 7);
+  tinystl::ring_buffer<int> r3(a, a + 5);
+  tinystl::ring_buffer<int> r4{ 1,2,3,4,5,6,7,8,9 };
+  tinystl::ring_buffer<int> r5(r4);
+  tinystl::ring_buffer<int> r6(std::move(r5));
+  tinystl::ring_buffer<int, false> r7;
+  tinystl::ring_buffer<std::string> r8;
+
+  FUN_AFTER(r1, r1.push_back(1));
+  FUN_AFTER(r1, r1.push_back(2));
+  FUN_AFTER(r1, r1.push_front(0));
+  FUN_AFTER(r1, r1.emplace_back(3));
+  FUN_AFTER(r1, r1.pop_front());
+  FUN_AFTER(r1, r1.pop_back());
+  FUN_VALUE(r1.capacity());                                   // 8
+  FUN_VALUE(r2.front());                                      // 7
+  FUN_VALUE(r3.back());                                       // 5
+  FUN_VALUE(r3[2]);                                           // 3
+  FUN_VALUE(r4.capacity());                                   // 16
+  FUN_VALUE(r6.size());                                       // 9
+  FUN_VALUE(r5.size());                                       // 0
+  // 首元素移到缓冲区末尾后，元素分为两段
+  FUN_AFTER(r3, r3.reserve(8));
+  FUN_AFTER(r3, r3.pop_front());
+  FUN_AFTER(r3, r3.pop_front());
+  FUN_AFTER(r3, r3.push_back(6));
+  FUN_AFTER(r3, r3.push_back(7));
+  FUN_AFTER(r3, r3.push_back(8));
+  FUN_AFTER(r3, r3.push_back(9));
+  SEGMENT_COUT(r3.array_one());                               // 3 4 5 6 7 8
+  SEGMENT_COUT(r3.array_two());                               // 9
+  // 固定容量：满时 try_push_back 返回 false，批量写入空闲段
+  r7.reserve(8);
+  std::cout << std::boolalpha;
+  for (int i = 0; i < 8; ++i)
+    r7.push_back(i);
+  FUN_VALUE(r7.full());                                       // true
+  FUN_VALUE(r7.try_push_back(8));                             // false
+  std::cout << std::noboolalpha;
+  FUN_AFTER(r7, r7.consume_front(3));                         // 3 4 5 6 7
+  FUN_AFTER(r7, r7.pop_back());                               // 3 4 5 6
+  FUN_AFTER(r7, r7.pop_back());                               // 3 4 5
+  FUN_VALUE(r7.free_one().second);                            // 2
+  FUN_VALUE(r7.free_two().second);                            // 3
+  for (size_t i = 0; i < r7.free_one().second; ++i)
+    r7.free_one().first[i] = 10 + static_cast<int>(i);
+  FUN_AFTER(r7, r7.commit_back(2));                           // 3 4 5 10 11
+  r8.push_back("hello");
+  r8.emplace_back(3, 'x');
+  FUN_VALUE(r8.back());                                       // xxx
+  FUN_AFTER(r2, r2.swap(r3));
+  FUN_AFTER(r2, r2.clear());
+  tinystl::queue<int, tinystl::ring_buffer<int>> q1{ 1,2,3 };
+  q1.push(4);
+  q1.pop();
+  FUN_VALUE(q1.front());                                      // 2
+  FUN_VALUE(q1.back());                                       // 4
+  FUN_VALUE(q1.size());                                       // 3
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|  push then pop all  |";
+#if LARGER_TEST_DATA_ON
+  RING_BUFFER_TEST(push_pop_test, SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+#else
+  RING_BUFFER_TEST(push_pop_test, SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "| steady push + pop   |";
+#if LARGER_TEST_DATA_ON
+  RING_BUFFER_TEST(steady_test, SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+#else
+  RING_BUFFER_TEST(steady_test, SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[-------------- End container test : ring_buffer ---------------]\n";
+
+}
+
+} // namespace ring_buffer_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_RING_BUFFER_TEST_H_
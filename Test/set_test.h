@@ -1,7 +1,7 @@
 #ifndef TINYSTL_SET_TEST_H
 #define TINYSTL_SET_TEST_H
 
-// set test : 测试 set, multiset 的接口与它们 insert 的性能
+// set test : 测试 set, multiset 的接口与它们 insert、空容器构造的性能
 
 #include <set>
 
@@ -14,6 +14,63 @@ namespace test {
 
 namespace set_test {
 
+// 构造、移动并析构 count 对空容器，统计耗时
+template <class Con>
+void empty_con_test(size_t count) {
+    volatile size_t sink = 0;
+    test_time([&]() {
+        for (size_t i = 0; i < count; ++i) {
+            Con a;
+            Con b(std::move(a));
+            sink = sink + b.size();
+        }
+    });
+}
+
+// 从 x 开始检查红黑树的性质：父指针正确、红节点没有红色子节点、各路径黑节点数相同
+// 返回以 x 为根的子树的黑高（空节点记为 1），不满足时返回 -1
+template <class BasePtr>
+int rb_black_height(BasePtr x, BasePtr parent) {
+    if (x == nullptr) return 1;
+    if (x->parent() != parent) return -1;
+    if (tinystl::rb_tree_is_red(x) &&
+        ((x->left != nullptr && tinystl::rb_tree_is_red(x->left)) ||
+         (x->right != nullptr && tinystl::rb_tree_is_red(x->right))))
+        return -1;
+    const int lh = rb_black_height(x->left, x);
+    const int rh = rb_black_height(x->right, x);
+    if (lh < 0 || lh != rh) return -1;
+    return lh + (tinystl::rb_tree_is_red(x) ? 0 : 1);
+}
+
+// 检查 set / multiset 底层的红黑树：header 为红、根为黑、各节点颜色满足性质，且中序遍历有序
+template <class Set>
+bool rb_tree_valid(const Set& s) {
+    auto header = s.end().node;
+    auto root = header->parent();
+    if (!tinystl::rb_tree_is_red(header)) return false;
+    if (root == nullptr) return s.empty() && header->left == header && header->right == header;
+    if (tinystl::rb_tree_is_red(root) || rb_black_height(root, header) < 0) return false;
+    if (header->left != tinystl::rb_tree_min(root) || header->right != tinystl::rb_tree_max(root)) return false;
+    size_t n = 0;
+    for (auto it = s.begin(); it != s.end(); ++it, ++n) {
+        auto next = it;
+        if (++next != s.end() && s.key_comp()(*next, *it)) return false;
+    }
+    return n == s.size();
+}
+
+#define SET_EMPTY_TEST(len1, len2, len3)                            \
+    TEST_LEN(len1, len2, len3, WIDE);                               \
+    std::cout << "|         std         |";                         \
+    empty_con_test<std::set<int>>(len1);                            \
+    empty_con_test<std::set<int>>(len2);                            \
+    empty_con_test<std::set<int>>(len3);                            \
+    std::cout << "\n|       tinystl       |";                       \
+    empty_con_test<tinystl::set<int>>(len1);                        \
+    empty_con_test<tinystl::set<int>>(len2);                        \
+    empty_con_test<tinystl::set<int>>(len3);
+
 void set_test() {
     std::cout << "[===============================================================]" << std::endl;
     std::cout << "[------------------ Run container test : set -------------------]" << std::endl;
@@ -66,6 +123,36 @@ void set_test() {
     std::cout << std::noboolalpha;
     FUN_VALUE(s1.size());
     FUN_VALUE(s1.max_size());
+    FUN_VALUE(sizeof(tinystl::rb_tree_node_base<int>));        // 24, 颜色存放在父指针的最低位
+    // 颜色与父指针共用一个字，插入、删除后检查每个节点的颜色与遍历顺序
+    {
+        tinystl::set<int> s13;
+        // 降序插入，新节点总在左侧，反复经过父节点为左子节点、叔叔为红的 case3.1
+        for (int i = 63; i >= 0; --i) {
+            s13.insert(i);
+        }
+        std::cout << std::boolalpha;
+        FUN_VALUE(rb_tree_valid(s13));                          // true
+        tinystl::multiset<int> s14;
+        unsigned seed = 12345;
+        for (int i = 0; i < 2000; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            const int v = static_cast<int>((seed >> 16) % 100);
+            if (seed & 0x300) s14.insert(v);
+            else s14.erase(v);
+        }
+        FUN_VALUE(rb_tree_valid(s14));                          // true
+        std::cout << std::noboolalpha;
+        FUN_VALUE(s13.size());                                  // 64
+    }
+    std::cout << std::boolalpha;
+    FUN_VALUE(std::is_nothrow_default_constructible<tinystl::set<int>>::value);  // true
+    std::cout << std::noboolalpha;
+    tinystl::set<int> s11{ 3,1,2 };
+    tinystl::set<int> s12(std::move(s11));
+    FUN_AFTER(s11, s11.insert(4));                              // 4  被移动的 set 仍然可用
+    FUN_AFTER(s12, s12.swap(s11));                              // 4
+    FUN_AFTER(s11, s11 = std::move(s12));                       // 4
     PASSED;
     #if PERFORMANCE_TEST_ON
     std::cout << "[--------------------- Performance Testing ---------------------]" << std::endl;
@@ -78,6 +165,14 @@ void set_test() {
     #endif
     std::cout << std::endl;
     std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+    std::cout << "|  empty set + move   |";
+    #if LARGER_TEST_DATA_ON
+    SET_EMPTY_TEST(SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+    #else
+    SET_EMPTY_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+    #endif
+    std::cout << std::endl;
+    std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
     PASSED;
     #endif
     std::cout << "[------------------ End container test : set -------------------]" << std::endl;
@@ -0,0 +1,125 @@
+#ifndef TINYSTL_SMALL_VECTOR_TEST_H_
+#define TINYSTL_SMALL_VECTOR_TEST_H_
+
+// small_vector test : 测试 small_vector 的接口与大量短小列表的构造性能
+
+#include <string>
+
+#include "../TinySTL/small_vector.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace small_vector_test
+{
+
+// 构造 count 个只含 6 个元素的列表，统计耗时
+template <class Con>
+void small_list_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止构造被优化掉
+  test_time([&]() {
+    for (size_t i = 0; i < count; ++i)
+    {
+      Con c;
+      for (int j = 0; j < 6; ++j)
+        c.push_back(static_cast<int>(i) + j);
+      sink = sink + c.back();
+    }
+  });
+}
+
+#define SMALL_LIST_TEST(len1, len2, len3)                         \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|   tinystl vector    |";                         \
+  small_list_test<tinystl::vector<int>>(len1);                    \
+  small_list_test<tinystl::vector<int>>(len2);                    \
+  small_list_test<tinystl::vector<int>>(len3);                    \
+  std::cout << "\n|    small_vector     |";                       \
+  small_list_test<tinystl::small_vector<int, 8>>(len1);           \
+  small_list_test<tinystl::small_vector<int, 8>>(len2);           \
+  small_list_test<tinystl::small_vector<int, 8>>(len3);
+
+void small_vector_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[-------------- Run container test : small_vector --------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  int a[] = { 1,2,3,4,5 };
+  tinystl::small_vector<int, 4> v1;
+  tinystl::small_vector<int, 4> v2(10);
+  tinystl::small_vector<int, 4> v3(3, 1);
+  tinystl::small_vector<int, 4> v4(a, a + 5);
+  tinystl::small_vector<int, 4> v5(v2);
+  tinystl::small_vector<int, 4> v6(std::move(v2));
+  tinystl::small_vector<int, 4> v7{ 1,2,3,4,5,6,7,8,9 };
+  tinystl::small_vector<int, 4> v8, v9, v10;
+  v8 = v3;
+  v9 = std::move(v3);
+  v10 = { 1,2,3 };
+
+  std::cout << std::boolalpha;
+  FUN_VALUE(v1.is_inline());                                  // true
+  FUN_VALUE(v1.capacity());                                   // 4
+  FUN_AFTER(v1, v1.assign(3, 8));                             // 8 8 8
+  FUN_VALUE(v1.is_inline());                                  // true
+  FUN_AFTER(v1, v1.assign(a, a + 5));                         // 1 2 3 4 5
+  FUN_VALUE(v1.is_inline());                                  // false
+  FUN_AFTER(v1, v1.emplace(v1.begin(), 0));                   // 0 1 2 3 4 5
+  FUN_AFTER(v1, v1.emplace_back(6));                          // 0 1 2 3 4 5 6
+  FUN_AFTER(v1, v1.push_back(6));                             // 0 1 2 3 4 5 6 6
+  FUN_AFTER(v1, v1.insert(v1.end(), 7));                      // 0 1 2 3 4 5 6 6 7
+  FUN_AFTER(v1, v1.insert(v1.begin() + 3, 2, 3));             // 0 1 2 3 3 3 4 5 6 6 7
+  FUN_AFTER(v1, v1.insert(v1.begin(), a, a + 5));             // 1 2 3 4 5 0 1 2 3 3 3 4 5 6 6 7
+  FUN_AFTER(v1, v1.pop_back());                               // 1 2 3 4 5 0 1 2 3 3 3 4 5 6 6
+  FUN_AFTER(v1, v1.erase(v1.begin()));                        // 2 3 4 5 0 1 2 3 3 3 4 5 6 6
+  FUN_AFTER(v1, v1.erase(v1.begin(), v1.begin() + 11));       // 5 6 6
+  FUN_AFTER(v1, v1.shrink_to_fit());                          // 5 6 6
+  FUN_VALUE(v1.is_inline());                                  // true  元素不超过 4 个，搬回内联空间
+  FUN_AFTER(v1, v1.reverse());                                // 6 6 5
+  FUN_AFTER(v1, v1.swap(v4));                                 // 1 2 3 4 5
+  FUN_VALUE(*v1.begin());                                     // 1
+  FUN_VALUE(*(v1.end() - 1));                                 // 5
+  FUN_VALUE(*v1.rbegin());                                    // 5
+  FUN_VALUE(v1.front());                                      // 1
+  FUN_VALUE(v1.back());                                       // 5
+  FUN_VALUE(v1[0]);                                           // 1
+  FUN_VALUE(v1.at(1));                                        // 2
+  FUN_VALUE(v1.empty());                                      // false
+  FUN_VALUE((v9 == v8));                                      // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(v1.size());                                       // 5
+  FUN_AFTER(v1, v1.resize(8));                                // 1 2 3 4 5 0 0 0
+  FUN_AFTER(v1, v1.resize(2, 6));                             // 1 2
+  FUN_AFTER(v1, v1.clear());                                  //
+  FUN_VALUE(v1.size());                                       // 0
+  tinystl::small_vector<std::string, 2> v11{ "a", "b" };
+  FUN_AFTER(v11, v11.insert(v11.begin() + 1, "x"));          // a x b
+  FUN_AFTER(v11, v11.erase(v11.begin()));                     // x b
+  FUN_AFTER(v11, v11.shrink_to_fit());                        // x b
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|  build small lists  |";
+#if LARGER_TEST_DATA_ON
+  SMALL_LIST_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#else
+  SMALL_LIST_TEST(SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[-------------- End container test : small_vector --------------]\n";
+
+}
+
+} // namespace small_vector_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_SMALL_VECTOR_TEST_H_
@@ -0,0 +1,221 @@
+#ifndef TINYSTL_SPSC_QUEUE_TEST_H_
+#define TINYSTL_SPSC_QUEUE_TEST_H_
+
+// spsc_queue test : 测试 spsc_queue 的接口，以及两个线程之间传递消息时与加锁的 queue 的性能对比
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "../TinySTL/spsc_queue.h"
+#include "../TinySTL/queue.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace spsc_queue_test
+{
+
+// 输出消费者一侧看到的全部元素，取出后队列为空
+template <class Queue>
+void spsc_print(Queue& q)
+{
+  while (!q.empty())
+  {
+    std::cout << " " << q.front();
+    q.pop();
+  }
+  std::cout << std::endl;
+}
+
+#define SPSC_COUT(q) do {                        \
+  std::string q_name = #q;                       \
+  std::cout << " " << q_name << " :";            \
+  spsc_print(q);                                 \
+} while(0)
+
+// 用互斥锁保护的 queue，与 spsc_queue 提供相同的 try_push / try_pop
+class locked_queue
+{
+public:
+  explicit locked_queue(size_t n) : cap_(n) {}
+
+  bool try_push(int value)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (q_.size() == cap_) return false;
+    q_.push(value);
+    return true;
+  }
+
+  bool try_pop(int& value)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (q_.empty()) return false;
+    value = q_.front();
+    q_.pop();
+    return true;
+  }
+
+private:
+  std::mutex          mtx_;
+  tinystl::queue<int> q_;
+  size_t              cap_;
+};
+
+// 生产者逐个放入 count 个整数，消费者逐个取出并求和，统计总耗时
+template <class Queue>
+void one_by_one_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止操作被优化掉
+  test_time([&]() {
+    Queue q(1024);
+    std::thread producer([&q, count]() {
+      for (size_t i = 0; i < count; ++i)
+        while (!q.try_push(static_cast<int>(i)))
+          std::this_thread::yield();
+    });
+    size_t sum = 0;
+    int value;
+    for (size_t i = 0; i < count; ++i)
+    {
+      while (!q.try_pop(value))
+        std::this_thread::yield();
+      sum += value;
+    }
+    producer.join();
+    sink = sink + sum;
+  });
+}
+
+// 生产者与消费者每次搬运至多 64 个整数
+void batch_test(size_t count)
+{
+  volatile size_t sink = 0;
+  test_time([&]() {
+    tinystl::spsc_queue<int> q(1024);
+    std::thread producer([&q, count]() {
+      int batch[64];
+      size_t i = 0;
+      while (i < count)
+      {
+        const size_t k = tinystl::min(static_cast<size_t>(64), count - i);
+        for (size_t j = 0; j < k; ++j)
+          batch[j] = static_cast<int>(i + j);
+        for (size_t done = 0; done < k; )
+        {
+          const size_t m = q.try_push_n(batch + done, k - done);
+          if (m == 0) std::this_thread::yield();
+          done += m;
+        }
+        i += k;
+      }
+    });
+    size_t sum = 0;
+    int batch[64];
+    for (size_t got = 0; got < count; )
+    {
+      const size_t m = q.try_pop_n(batch, 64);
+      if (m == 0) std::this_thread::yield();
+      for (size_t j = 0; j < m; ++j)
+        sum += batch[j];
+      got += m;
+    }
+    producer.join();
+    sink = sink + sum;
+  });
+}
+
+#define SPSC_QUEUE_TEST(len1, len2, len3)                         \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|    mutex + queue    |";                         \
+  one_by_one_test<locked_queue>(len1);                            \
+  one_by_one_test<locked_queue>(len2);                            \
+  one_by_one_test<locked_queue>(len3);                            \
+  std::cout << "\n|     spsc_queue      |";                       \
+  one_by_one_test<tinystl::spsc_queue<int>>(len1);                \
+  one_by_one_test<tinystl::spsc_queue<int>>(len2);                \
+  one_by_one_test<tinystl::spsc_queue<int>>(len3);                \
+  std::cout << "\n| spsc_queue (n = 64) |";                       \
+  batch_test(len1);                                               \
+  batch_test(len2);                                               \
+  batch_test(len3);
+
+void spsc_queue_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[--------------- Run container test : spsc_queue ---------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  tinystl::spsc_queue<int> q1(5);
+  tinystl::spsc_queue<std::string> q2(2);
+  int a[] = { 1,2,3,4,5,6,7,8,9,10 };
+  int b[10] = { 0 };
+
+  FUN_VALUE(q1.capacity());                                   // 8
+  std::cout << std::boolalpha;
+  FUN_VALUE(q1.empty());                                      // true
+  FUN_VALUE(q1.try_push(1));                                  // true
+  std::cout << std::noboolalpha;
+  q1.push(2);
+  q1.emplace(3);
+  FUN_VALUE(q1.size());                                       // 3
+  FUN_VALUE(q1.front());                                      // 1
+  // 只放得下 5 个
+  FUN_VALUE(q1.try_push_n(a + 3, 7));                         // 5
+  std::cout << std::boolalpha;
+  FUN_VALUE(q1.try_push(9));                                  // false
+  std::cout << std::noboolalpha;
+  FUN_VALUE(q1.try_pop_n(b, 3));                              // 3
+  FUN_VALUE(b[2]);                                            // 3
+  int value = 0;
+  q1.try_pop(value);
+  FUN_VALUE(value);                                           // 4
+  q1.pop();
+  SPSC_COUT(q1);                                              // 6 7 8
+  q2.push("hello");
+  q2.emplace(3, 'x');
+  FUN_VALUE(q2.front());                                      // hello
+  q2.pop();
+  FUN_VALUE(q2.front());                                      // xxx
+  // 另一个线程放入 1000 个数，本线程依次取出并求和
+  {
+    std::thread producer([&q1]() {
+      for (int i = 1; i <= 1000; ++i)
+        q1.push(i);
+    });
+    int sum = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+      while (q1.empty())
+        std::this_thread::yield();
+      sum += q1.front();
+      q1.pop();
+    }
+    producer.join();
+    FUN_VALUE(sum);                                           // 500500
+  }
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "| producer->consumer  |";
+#if LARGER_TEST_DATA_ON
+  SPSC_QUEUE_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+  SPSC_QUEUE_TEST(SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[--------------- End container test : spsc_queue ---------------]\n";
+
+}
+
+} // namespace spsc_queue_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_SPSC_QUEUE_TEST_H_
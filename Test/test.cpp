@@ -9,12 +9,24 @@
 #endif // check memory leaks
 
 #include "vector_test.h"
+#include "small_vector_test.h"
+#include "vm_vector_test.h"
+#include "dynamic_bitset_test.h"
 #include "list_test.h"
+#include "intrusive_list_test.h"
+#include "unrolled_list_test.h"
 #include "deque_test.h"
 #include "stack_test.h"
 #include "queue_test.h"
+#include "ring_buffer_test.h"
+#include "spsc_queue_test.h"
 #include "set_test.h"
 #include "map_test.h"
+#include "intrusive_rb_tree_test.h"
+#include "addressable_heap_test.h"
+#include "radix_heap_test.h"
+#include "flat_set_test.h"
+#include "flat_map_test.h"
 #include "unordered_set_test.h"
 #include "unordered_map_test.h"
 #include "algorithm_test.h"
@@ -31,15 +43,29 @@ int main() {
     algorithm_performance_test::algorithm_performance_test();
     functor_test::functor_test();
     vector_test::vector_test();
+    small_vector_test::small_vector_test();
+    vm_vector_test::vm_vector_test();
+    dynamic_bitset_test::dynamic_bitset_test();
     list_test::list_test();
+    intrusive_list_test::intrusive_list_test();
+    unrolled_list_test::unrolled_list_test();
     deque_test::deque_test();
     queue_test::queue_test();
+    ring_buffer_test::ring_buffer_test();
+    spsc_queue_test::spsc_queue_test();
     queue_test::priority_test();
+    addressable_heap_test::addressable_heap_test();
+    radix_heap_test::radix_heap_test();
     stack_test::stack_test();
     map_test::map_test();
     map_test::multimap_test();
+    intrusive_rb_tree_test::intrusive_rb_tree_test();
     set_test::set_test();
     set_test::multiset_test();
+    flat_map_test::flat_map_test();
+    flat_map_test::flat_multimap_test();
+    flat_set_test::flat_set_test();
+    flat_set_test::flat_multiset_test();
     unordered_map_test::unordered_map_test();
     unordered_map_test::unordered_multimap_test();
     unordered_set_test::unordered_set_test();
@@ -563,6 +563,23 @@ void test_len(size_t len1, size_t len2, size_t len3, size_t wide)
 
 #define TEST_LEN(len1, len2, len3, wide) test_len(len1, len2, len3, wide)
 
+// 执行一次 f，把耗时（毫秒）作为性能测试表格中的一列输出
+template <class Func>
+void test_time(Func f)
+{
+  clock_t start, end;
+  char buf[10];
+  start = clock();
+  f();
+  end = clock();
+  int n = static_cast<int>(static_cast<double>(end - start)
+      / CLOCKS_PER_SEC * 1000);
+  std::snprintf(buf, sizeof(buf), "%d", n);
+  std::string t = buf;
+  t += "ms    |";
+  std::cout << std::setw(WIDE) << t;
+}
+
 // 常用测试性能的宏
 #define FUN_TEST_FORMAT1(mode, fun, arg, count) do {         \
   srand((int)time(0));                                       \
@@ -0,0 +1,218 @@
+#ifndef TINYSTL_UNROLLED_LIST_TEST_H_
+#define TINYSTL_UNROLLED_LIST_TEST_H_
+
+// unrolled_list test : 测试 unrolled_list 的接口，以及与 list 的插入、遍历性能对比
+
+#include <stdexcept>
+#include <string>
+
+#include "../TinySTL/unrolled_list.h"
+#include "../TinySTL/list.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace unrolled_list_test
+{
+
+// 依次 push_back count 个元素，统计耗时
+template <class Con>
+void push_back_test(size_t count)
+{
+  test_time([&]() {
+    Con c;
+    for (size_t i = 0; i < count; ++i)
+      c.push_back(static_cast<int>(i));
+  });
+}
+
+// 先交错地在头尾插入 count 个元素使节点在内存中不连续，再遍历求和 10 次，只统计遍历的耗时
+template <class Con>
+void traverse_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止遍历被优化掉
+  Con c;
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i & 1) c.push_back(static_cast<int>(i));
+    else       c.push_front(static_cast<int>(i));
+  }
+  test_time([&]() {
+    for (int k = 0; k < 10; ++k)
+    {
+      size_t sum = 0;
+      for (auto it = c.begin(); it != c.end(); ++it)
+        sum += *it;
+      sink = sink + sum;
+    }
+  });
+}
+
+#define UNROLLED_LIST_TEST(fun, len1, len2, len3)                 \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|    tinystl list     |";                         \
+  fun<tinystl::list<int>>(len1);                                  \
+  fun<tinystl::list<int>>(len2);                                  \
+  fun<tinystl::list<int>>(len3);                                  \
+  std::cout << "\n|    unrolled_list    |";                       \
+  fun<tinystl::unrolled_list<int>>(len1);                         \
+  fun<tinystl::unrolled_list<int>>(len2);                         \
+  fun<tinystl::unrolled_list<int>>(len3);
+
+bool is_odd(int x) { return x % 2 == 1; }
+
+// 复制构造时按需抛出异常的元素
+struct throw_on_copy
+{
+  static int countdown;  // 再复制 countdown 次后抛出异常，小于 0 时不抛出
+  int value;
+  explicit throw_on_copy(int v) : value(v) {}
+  throw_on_copy(const throw_on_copy& rhs) : value(rhs.value)
+  {
+    if (countdown >= 0 && countdown-- == 0) throw std::runtime_error("throw_on_copy");
+  }
+  throw_on_copy& operator=(const throw_on_copy& rhs)
+  {
+    value = rhs.value;
+    return *this;
+  }
+};
+int throw_on_copy::countdown = -1;
+
+void unrolled_list_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[------------- Run container test : unrolled_list --------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  int a[] = { 1,2,3,4,5 };
+  // 每个块只放 4 个元素，便于覆盖块的分裂与合并
+  typedef tinystl::unrolled_list<int, tinystl::alloc, 40> small_list;
+  tinystl::unrolled_list<int> l1;
+  tinystl::unrolled_list<int> l2(5);
+  tinystl::unrolled_list<int> l3(5, 1);
+  tinystl::unrolled_list<int> l4(a, a + 5);
+  tinystl::unrolled_list<int> l5(l2);
+  tinystl::unrolled_list<int> l6(std::move(l2));
+  tinystl::unrolled_list<int> l7{ 1,2,3,4,5,6,7,8,9 };
+  tinystl::unrolled_list<int> l8;
+  l8 = l3;
+  tinystl::unrolled_list<int> l9;
+  l9 = std::move(l3);
+  tinystl::unrolled_list<int> l10;
+  l10 = { 1, 2, 2, 3, 5, 6, 7, 8, 9 };
+  small_list s1(a, a + 5);
+
+  FUN_VALUE(small_list::chunk_capacity);                      // 4
+  FUN_AFTER(l1, l1.assign(8, 8));                             // 8 8 8 8 8 8 8 8
+  FUN_AFTER(l1, l1.assign(a, a + 5));                         // 1 2 3 4 5
+  FUN_AFTER(l1, l1.assign({ 1,2,3,4,5,6 }));                  // 1 2 3 4 5 6
+  FUN_AFTER(l1, l1.insert(l1.end(), 6));                      // 1 2 3 4 5 6 6
+  FUN_AFTER(l1, l1.insert(l1.end(), 2, 7));                   // 1 2 3 4 5 6 6 7 7
+  FUN_AFTER(l1, l1.insert(l1.begin(), a, a + 5));             // 1 2 3 4 5 1 2 3 4 5 6 6 7 7
+  FUN_AFTER(l1, l1.push_back(2));                             // ... 7 7 2
+  FUN_AFTER(l1, l1.push_front(1));                            // 1 1 2 3 ...
+  FUN_AFTER(l1, l1.emplace(l1.begin(), 1));                   // 1 1 1 2 3 ...
+  FUN_AFTER(l1, l1.emplace_front(0));                         // 0 1 1 1 2 3 ...
+  FUN_AFTER(l1, l1.emplace_back(10));                         // ... 7 7 2 10
+  FUN_VALUE(l1.size());                                       // 19
+  FUN_AFTER(l1, l1.pop_front());                              // 1 1 1 2 3 ...
+  FUN_AFTER(l1, l1.pop_back());                               // ... 7 7 2
+  FUN_AFTER(l1, l1.erase(l1.begin()));                        // 1 1 2 3 ...
+  FUN_AFTER(l1, l1.erase(l1.begin(), l1.end()));              //
+  FUN_VALUE(l1.size());                                       // 0
+  FUN_AFTER(l1, l1.remove(1));                                //
+  FUN_AFTER(l4, l4.remove_if(is_odd));                        // 2 4
+  FUN_AFTER(l7, l7.splice(l7.end(), l4));                     // 1 2 3 4 5 6 7 8 9 2 4
+  FUN_AFTER(l4, l4.swap(l7));                                 // 1 2 3 4 5 6 7 8 9 2 4
+  // 小块：中间插入使块分裂，删除使块合并，splice 在块中间分裂
+  FUN_AFTER(s1, s1.insert(++s1.begin(), 2, 9));               // 1 9 9 2 3 4 5
+  FUN_AFTER(s1, s1.insert(s1.begin(), a, a + 5));             // 1 2 3 4 5 1 9 9 2 3 4 5
+  FUN_AFTER(s1, s1.erase(++s1.begin(), --s1.end()));          // 1 5
+  small_list s2{ 7, 8 };
+  FUN_AFTER(s1, s1.splice(++s1.begin(), s2));                 // 1 7 8 5
+  FUN_VALUE(s2.size());                                       // 0
+  FUN_VALUE(*s1.rbegin());                                    // 5
+  FUN_VALUE(*(++s1.rbegin()));                                // 8
+  std::cout << std::boolalpha;
+  FUN_VALUE(l1.empty());                                      // true
+  FUN_VALUE((l4 == l7));                                      // false
+  FUN_VALUE((l5 == l6));                                      // true
+  FUN_VALUE((l8 < l10));                                      // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(l4.front());                                      // 1
+  FUN_VALUE(l4.back());                                       // 4
+  FUN_AFTER(l4, l4.clear());                                  //
+  FUN_AFTER(l4, l4.push_back(3));                             // 3
+  // 插入本容器的元素：块已满时先分裂，参数引用的元素会被移走
+  tinystl::unrolled_list<std::string> l11{ "aa", "bb", "cc" };
+  FUN_VALUE(l11.chunk_capacity);                              // 3
+  FUN_AFTER(l11, l11.insert(++l11.begin(), l11.back()));      // aa cc bb cc
+  FUN_AFTER(l11, l11.insert(l11.begin(), 2, l11.back()));     // cc cc aa cc bb cc
+  FUN_AFTER(l11, l11.insert(l11.end(), 4, l11.front()));      // cc cc aa cc bb cc cc cc cc cc
+  // 构造元素时抛出异常：新建的空块不能留在链表中
+  tinystl::unrolled_list<throw_on_copy> t1;
+  throw_on_copy x(1);
+  throw_on_copy::countdown = 0;
+  try { t1.push_back(x); } catch (const std::runtime_error&) {}
+  std::cout << std::boolalpha;
+  FUN_VALUE(t1.size());                                       // 0
+  FUN_VALUE((t1.begin() == t1.end()));                        // true
+  throw_on_copy::countdown = -1;
+  t1.push_back(x);
+  throw_on_copy::countdown = 0;
+  try { t1.push_front(x); } catch (const std::runtime_error&) {}
+  throw_on_copy::countdown = -1;
+  FUN_VALUE(t1.size());                                       // 1
+  FUN_VALUE((++t1.begin() == t1.end()));                      // true
+  // 分裂、合并块时搬运元素抛出异常：撤销搬运，遍历得到的元素个数与 size() 一致
+  tinystl::unrolled_list<throw_on_copy, tinystl::alloc, 40> t2;
+  for (int i = 1; i <= 4; ++i)
+    t2.emplace_back(i);
+  throw_on_copy::countdown = 2;  // 新元素与分裂时的第一次搬运成功，第二次搬运抛出
+  try { t2.insert(++t2.begin(), x); } catch (const std::runtime_error&) {}
+  throw_on_copy::countdown = -1;
+  FUN_VALUE(t2.size());                                       // 4
+  FUN_VALUE(tinystl::distance(t2.begin(), t2.end()));         // 4
+  t2.emplace_back(5);  // 块为 [1 2 3 4] [5]
+  t2.pop_front();
+  t2.pop_front();
+  throw_on_copy::countdown = 0;  // [4] 合并 [5] 时抛出
+  try { t2.pop_front(); } catch (const std::runtime_error&) {}
+  throw_on_copy::countdown = -1;
+  FUN_VALUE(t2.size());                                       // 2
+  FUN_VALUE(tinystl::distance(t2.begin(), t2.end()));         // 2
+  FUN_VALUE(t2.back().value);                                 // 5
+  std::cout << std::noboolalpha;
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|      push_back      |";
+#if LARGER_TEST_DATA_ON
+  UNROLLED_LIST_TEST(push_back_test, SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#else
+  UNROLLED_LIST_TEST(push_back_test, SCALE_M(LEN1), SCALE_M(LEN2), SCALE_M(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|   traverse x 10     |";
+#if LARGER_TEST_DATA_ON
+  UNROLLED_LIST_TEST(traverse_test, SCALE_S(LEN1), SCALE_S(LEN2), SCALE_S(LEN3));
+#else
+  UNROLLED_LIST_TEST(traverse_test, SCALE_SS(LEN1), SCALE_SS(LEN2), SCALE_SS(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[------------- End container test : unrolled_list --------------]\n";
+
+}
+
+} // namespace unrolled_list_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_UNROLLED_LIST_TEST_H_
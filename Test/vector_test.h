@@ -3,9 +3,13 @@
 
 // vector test : 测试 vector 的接口与 push_back 的性能
 
+#include <cstdint>
+#include <cstdlib>
+#include <string>
 #include <vector>
 
 #include "../TinySTL/vector.h"
+#include "../TinySTL/huge_page_alloc.h"
 #include "test.h"
 
 namespace tinystl
@@ -15,6 +19,56 @@ namespace test
 namespace vector_test
 {
 
+// 在长度为 len 的 vector<int> 中随机读取 count 次，统计耗时，数据很大时主要受 TLB 缺失影响
+template <class Alloc>
+void random_access_test(size_t len, size_t count)
+{
+  srand((int)time(0));
+  tinystl::vector<int, Alloc> v(len, 1);
+  volatile size_t sink = 0;
+  size_t x = static_cast<size_t>(rand());
+  test_time([&]() {
+    for (size_t i = 0; i < count; ++i)
+    {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;  // 线性同余，比 rand() 开销小
+      sink = sink + v[(x >> 33) % len];
+    }
+  });
+}
+
+// 按缓存行对齐的元素，alloc 的内存池只保证 8 字节对齐
+struct alignas(64) cache_line
+{
+  int value;
+};
+
+// 只提供 allocate(bytes) / deallocate(p, bytes) 的旧式配置器
+struct legacy_alloc
+{
+  static void* allocate(size_t n) { return std::malloc(n); }
+  static void  deallocate(void* p, size_t) { std::free(p); }
+};
+
+// 反复把 vector<char> 缓冲区清空再扩大到 count 字节，模拟每条消息复用一次读缓冲区
+template <bool DefaultInit>
+void buffer_resize_test(size_t count)
+{
+  tinystl::vector<char> v;
+  volatile size_t sink = 0;
+  test_time([&]() {
+    for (size_t i = 0; i < 100; ++i)
+    {
+      v.clear();
+      if (DefaultInit)
+        v.resize_default_init(count);
+      else
+        v.resize(count);
+      v[i % count] = static_cast<char>(i);
+      sink = sink + static_cast<size_t>(v[i % count]);
+    }
+  });
+}
+
 void vector_test()
 {
   std::cout << "[===============================================================]\n";
@@ -92,6 +146,49 @@ void vector_test()
   FUN_AFTER(v1, v1.shrink_to_fit());                         //
   FUN_VALUE(v1.size());                                      // 0
   FUN_VALUE(v1.capacity());                                  // 0
+  std::cout << std::boolalpha;
+  FUN_VALUE(tinystl::is_trivially_relocatable<int>::value);          // true  按字节搬移
+  FUN_VALUE(tinystl::is_trivially_relocatable<std::string>::value);  // false 逐个移动构造
+  std::cout << std::noboolalpha;
+  tinystl::vector<std::string> v12{ "a", "b", "c" };
+  FUN_AFTER(v12, v12.insert(v12.begin() + 1, "x"));         // a x b c
+  FUN_AFTER(v12, v12.erase(v12.begin()));                    // x b c
+  FUN_AFTER(v12, v12.reserve(32));                           // x b c
+  tinystl::vector<int> v13(4, tinystl::default_init);        // 4 个未初始化的 int
+  FUN_VALUE(v13.size());                                     // 4
+  FUN_AFTER(v13, v13.assign(a, a + 3));                      // 1 2 3
+  v13.resize_default_init(5);                                // 1 2 3 ? ?  新增的两个元素未初始化，不输出
+  FUN_VALUE(v13.size());                                     // 5
+  FUN_AFTER(v13, v13.resize_and_overwrite(8, [](int* p, size_t n) {
+    for (size_t i = 3; i < n; ++i) p[i] = static_cast<int>(i) + 1;
+    return n - 2;
+  }));                                                       // 1 2 3 4 5 6
+  tinystl::vector<char> v14;
+  FUN_AFTER(v14, v14.shrink_to_fit());                       //
+  FUN_AFTER(v14, v14.reserve_exact(17));                     //
+  FUN_VALUE(v14.capacity());                                 // 17
+  FUN_VALUE(v14.usable_capacity());                          // 24  alloc 按 8 字节取整
+  FUN_AFTER(v14, v14.reserve(18));                           //
+  FUN_VALUE(v14.capacity());                                 // 24  reserve 补满实际分配的区块
+  tinystl::vector<int, tinystl::alloc, tinystl::growth_2x> v15(16, 1);
+  FUN_AFTER(v15, v15.push_back(2));                          // 1 ... 1 2
+  FUN_VALUE(v15.capacity());                                 // 32
+  tinystl::vector<char, tinystl::alloc, tinystl::growth_size_class<>> v16;
+  FUN_VALUE(v16.capacity());                                 // 64  空容器至少 64 字节
+  tinystl::vector<float, tinystl::allocator<float, 64>> v17(100, 1.0f);
+  tinystl::vector<cache_line> v18(3);
+  std::cout << std::boolalpha;
+  FUN_VALUE((reinterpret_cast<uintptr_t>(v17.data()) % 64 == 0));  // true
+  FUN_VALUE((reinterpret_cast<uintptr_t>(v18.data()) % 64 == 0));  // true
+  FUN_AFTER(v17, v17.resize(3));                             // 1 1 1
+  FUN_VALUE((reinterpret_cast<uintptr_t>(v17.data()) % 64 == 0));  // true
+  tinystl::vector<int, tinystl::huge_page_alloc<>> v19;
+  FUN_AFTER(v19, v19.reserve(600000));                       //
+  FUN_VALUE((reinterpret_cast<uintptr_t>(v19.data()) % tinystl::HUGE_PAGE_SIZE == 0));  // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(v19.capacity());                                 // 1048576  补满两个 2MB 大页
+  tinystl::vector<int, legacy_alloc> v20{ 1,2,3 };
+  FUN_AFTER(v20, v20.push_back(4));                          // 1 2 3 4
   PASSED;
 
 #if PERFORMANCE_TEST_ON
@@ -103,6 +200,30 @@ void vector_test()
 #else
   CON_TEST_P1(vector<int>, push_back, rand(), SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
 #endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|  100 buffer resize  |";
+  TEST_LEN(LEN1, LEN2, LEN3, WIDE);
+  std::cout << "|       resize        |";
+  buffer_resize_test<false>(LEN1);
+  buffer_resize_test<false>(LEN2);
+  buffer_resize_test<false>(LEN3);
+  std::cout << "\n| resize_default_init |";
+  buffer_resize_test<true>(LEN1);
+  buffer_resize_test<true>(LEN2);
+  buffer_resize_test<true>(LEN3);
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|  random read x 1e7  |";
+  TEST_LEN(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3), WIDE);
+  std::cout << "|       tinystl       |";
+  random_access_test<tinystl::alloc>(SCALE_L(LEN1), LEN3);
+  random_access_test<tinystl::alloc>(SCALE_L(LEN2), LEN3);
+  random_access_test<tinystl::alloc>(SCALE_L(LEN3), LEN3);
+  std::cout << "\n|   huge_page_alloc   |";
+  random_access_test<tinystl::huge_page_alloc<>>(SCALE_L(LEN1), LEN3);
+  random_access_test<tinystl::huge_page_alloc<>>(SCALE_L(LEN2), LEN3);
+  random_access_test<tinystl::huge_page_alloc<>>(SCALE_L(LEN3), LEN3);
   std::cout << "\n";
   std::cout << "|---------------------|-------------|-------------|-------------|\n";
   PASSED;
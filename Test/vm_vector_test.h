@@ -0,0 +1,123 @@
+#ifndef TINYSTL_VM_VECTOR_TEST_H_
+#define TINYSTL_VM_VECTOR_TEST_H_
+
+// vm_vector test : 测试 vm_vector 的接口、增长时元素地址不变，以及大量 push_back 的性能
+
+#include <string>
+
+#include "../TinySTL/vm_vector.h"
+#include "../TinySTL/vector.h"
+#include "test.h"
+
+namespace tinystl
+{
+namespace test
+{
+namespace vm_vector_test
+{
+
+// 依次 push_back count 个元素，统计耗时
+template <class Con>
+void push_back_test(size_t count)
+{
+  volatile size_t sink = 0;  // 防止插入被优化掉
+  test_time([&]() {
+    Con c;
+    for (size_t i = 0; i < count; ++i)
+      c.push_back(static_cast<int>(i));
+    sink = sink + c.back();
+  });
+}
+
+#define VM_PUSH_BACK_TEST(len1, len2, len3)                       \
+  TEST_LEN(len1, len2, len3, WIDE);                               \
+  std::cout << "|   tinystl vector    |";                         \
+  push_back_test<tinystl::vector<int>>(len1);                     \
+  push_back_test<tinystl::vector<int>>(len2);                     \
+  push_back_test<tinystl::vector<int>>(len3);                     \
+  std::cout << "\n|      vm_vector      |";                       \
+  push_back_test<tinystl::vm_vector<int>>(len1);                  \
+  push_back_test<tinystl::vm_vector<int>>(len2);                  \
+  push_back_test<tinystl::vm_vector<int>>(len3);
+
+void vm_vector_test()
+{
+  std::cout << "[===============================================================]\n";
+  std::cout << "[--------------- Run container test : vm_vector ----------------]\n";
+  std::cout << "[-------------------------- API test ---------------------------]\n";
+  int a[] = { 1,2,3,4,5 };
+  tinystl::vm_vector<int> v1;
+  tinystl::vm_vector<int> v2(10);
+  tinystl::vm_vector<int> v3(3, 1);
+  tinystl::vm_vector<int> v4(a, a + 5);
+  tinystl::vm_vector<int> v5(v2);
+  tinystl::vm_vector<int> v6(std::move(v2));
+  tinystl::vm_vector<int> v7{ 1,2,3,4,5,6,7,8,9 };
+  tinystl::vm_vector<int> v8, v9, v10;
+  tinystl::vm_vector<int> v11(tinystl::vm_reserve, 100000);
+  v8 = v3;
+  v9 = std::move(v3);
+  v10 = { 1,2,3 };
+
+  std::cout << std::boolalpha;
+  FUN_AFTER(v1, v1.append(a, a + 5));                         // 1 2 3 4 5
+  FUN_AFTER(v1, v1.emplace_back(6));                          // 1 2 3 4 5 6
+  FUN_AFTER(v1, v1.push_back(7));                             // 1 2 3 4 5 6 7
+  FUN_AFTER(v1, v1.pop_back());                               // 1 2 3 4 5 6
+  FUN_VALUE(*v1.begin());                                     // 1
+  FUN_VALUE(*(v1.end() - 1));                                 // 6
+  FUN_VALUE(*v1.rbegin());                                    // 6
+  FUN_VALUE(v1.front());                                      // 1
+  FUN_VALUE(v1.back());                                       // 6
+  FUN_VALUE(v1[0]);                                           // 1
+  FUN_VALUE(v1.at(1));                                        // 2
+  FUN_VALUE(v1.empty());                                      // false
+  FUN_VALUE((v9 == v8));                                      // true
+  FUN_VALUE((v4 < v7));                                       // true
+  std::cout << std::noboolalpha;
+  FUN_VALUE(v1.size());                                       // 6
+  FUN_AFTER(v1, v1.resize(8));                                // 1 2 3 4 5 6 0 0
+  FUN_AFTER(v1, v1.resize(2, 6));                             // 1 2
+  FUN_AFTER(v1, v1.swap(v4));                                 // 1 2 3 4 5
+  FUN_AFTER(v1, v1.clear());                                  //
+  FUN_VALUE(v1.size());                                       // 0
+  FUN_VALUE(v11.max_size());                                  // 100352  按页取整
+  FUN_AFTER(v11, v11.reserve(1000));                          //
+  FUN_VALUE(v11.capacity());                                  // 1024
+  std::cout << std::boolalpha;
+  const int* p = v11.data();
+  for (int i = 0; i < 100000; ++i)
+    v11.push_back(i);
+  FUN_VALUE((p == v11.data()));                               // true  增长时元素不搬移
+  FUN_VALUE(v11.back());                                      // 99999
+  std::cout << std::noboolalpha;
+  FUN_AFTER(v11, v11.resize(10));                             // 0 1 2 3 4 5 6 7 8 9
+  FUN_AFTER(v11, v11.resize(3));                              // 0 1 2
+  FUN_AFTER(v11, v11.shrink_to_fit());                        // 0 1 2
+  FUN_VALUE(v11.capacity());                                  // 1024  保留一页
+  tinystl::vm_vector<std::string> v12{ "a", "b" };
+  FUN_AFTER(v12, v12.push_back("c"));                         // a b c
+  FUN_AFTER(v12, v12.pop_back());                             // a b
+  PASSED;
+
+#if PERFORMANCE_TEST_ON
+  std::cout << "[--------------------- Performance Testing ---------------------]\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  std::cout << "|      push_back      |";
+#if LARGER_TEST_DATA_ON
+  VM_PUSH_BACK_TEST(SCALE_LL(LEN1), SCALE_LL(LEN2), SCALE_LL(LEN3));
+#else
+  VM_PUSH_BACK_TEST(SCALE_L(LEN1), SCALE_L(LEN2), SCALE_L(LEN3));
+#endif
+  std::cout << "\n";
+  std::cout << "|---------------------|-------------|-------------|-------------|\n";
+  PASSED;
+#endif
+  std::cout << "[--------------- End container test : vm_vector ----------------]\n";
+
+}
+
+} // namespace vm_vector_test
+} // namespace test
+} // namespace tinystl
+#endif // !TINYSTL_VM_VECTOR_TEST_H_
@@ -0,0 +1,270 @@
+#ifndef TINYSTL_ADDRESSABLE_HEAP_H_
+#define TINYSTL_ADDRESSABLE_HEAP_H_
+
+// 这个头文件包含一个模板类 addressable_heap
+// addressable_heap : 可寻址堆，push 返回稳定的句柄，可以通过句柄修改元素的优先级或删除元素
+
+// notes:
+//
+// priority_queue 不能修改已在堆中的元素，Dijkstra、A* 与按截止时间调度的场景只能重复 push，并在 pop 时
+// 跳过过期的元素，堆中充斥着无效的副本。addressable_heap 是带位置表的 D 叉堆（缺省 4 叉）：
+//   * 堆数组中存放 (元素, 句柄)，比较时直接读取堆数组，与 priority_queue 一样是连续访问
+//   * pos_[句柄] 记录元素在堆数组中的下标，元素每移动一次就更新一次，由此 O(1) 找到句柄对应的元素
+//   * update / decrease_key / increase_key / increase / decrease / erase 均为 O(log n)，top 为 O(1)
+//   * 句柄在元素被 pop 或 erase 之前一直有效；被删除的句柄会在之后的 push 中复用
+//   * decrease_key / increase_key 按键本身的大小而言：decrease_key 把键改小，increase_key 把键改大，
+//     与堆的方向无关。Dijkstra 用 greater 构成小顶堆，缩短距离就是 decrease_key，元素向堆顶移动
+//   * increase / decrease 则按 Compare 定义的优先级而言，与 boost.heap 相同：increase 使元素更靠近堆顶，
+//     只做一个方向的调整，省去一次比较；在小顶堆中 increase 对应的是 decrease_key
+
+#include "vector.h"
+#include "functional.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+/// @brief 可寻址堆
+/// @tparam T        元素类型
+/// @tparam Compare  比较方式，缺省为 less，堆顶为最大的元素
+/// @tparam D        堆的叉数，缺省为 4
+template <class T, class Compare = tinystl::less<T>, size_t D = 4>
+class addressable_heap {
+    static_assert(D >= 2, "the arity of a heap should be at least 2");
+
+public:
+    typedef T                 value_type;
+    typedef Compare           value_compare;
+    typedef size_t            size_type;
+    typedef size_t            handle_type;
+    typedef const value_type& const_reference;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+private:
+    /// @brief 堆数组中的元素及其句柄
+    struct entry {
+        value_type  value;
+        handle_type handle;
+
+        template <class... Args>
+        entry(handle_type h, Args&&... args) : value(tinystl::forward<Args>(args)...), handle(h) {}
+    };
+
+    tinystl::vector<entry>       heap_;   // D 叉堆
+    tinystl::vector<size_type>   pos_;    // 句柄 -> 堆数组中的下标，空闲的句柄为 npos
+    tinystl::vector<handle_type> free_;   // 可复用的句柄
+    value_compare                comp_;   // 权值比较的标准
+
+public:  // 构造、复制、移动、析构函数
+    addressable_heap() = default;
+    explicit addressable_heap(const Compare& c) : comp_(c) {}
+
+    addressable_heap(const addressable_heap&) = default;
+    addressable_heap(addressable_heap&&) = default;
+    addressable_heap& operator=(const addressable_heap&) = default;
+    addressable_heap& operator=(addressable_heap&&) = default;
+    ~addressable_heap() = default;
+
+public:  // 容量相关操作
+    bool      empty() const noexcept { return heap_.empty(); }
+    size_type size()  const noexcept { return heap_.size(); }
+
+    /// @brief 预留 n 个元素的空间，之后的 n 次 push 不再分配内存
+    void reserve(size_type n) {
+        heap_.reserve(n);
+        pos_.reserve(n);
+    }
+
+public:  // 访问元素相关操作
+    const_reference top() const {
+        TINYSTL_DEBUG(!empty());
+        return heap_.front().value;
+    }
+
+    handle_type top_handle() const {
+        TINYSTL_DEBUG(!empty());
+        return heap_.front().handle;
+    }
+
+    /// @brief 句柄 h 是否对应堆中的元素
+    bool contains(handle_type h) const noexcept { return h < pos_.size() && pos_[h] != npos; }
+
+    const_reference get(handle_type h) const {
+        TINYSTL_DEBUG(contains(h));
+        return heap_[pos_[h]].value;
+    }
+
+    const_reference operator[](handle_type h) const { return get(h); }
+
+public:  // 修改容器相关操作
+    /// @brief 先选定句柄但不从 free_ 中取走，元素放入堆数组成功后才提交，构造抛出异常时句柄不会丢失
+    template <class... Args>
+    handle_type emplace(Args&&... args) {
+        const bool fresh = free_.empty();
+        if (fresh) pos_.push_back(npos);
+        const handle_type h = fresh ? pos_.size() - 1 : free_.back();
+        try {
+            heap_.emplace_back(h, tinystl::forward<Args>(args)...);
+        }
+        catch (...) {
+            if (fresh) pos_.pop_back();
+            throw;
+        }
+        if (!fresh) free_.pop_back();
+        pos_[h] = heap_.size() - 1;
+        sift_up(heap_.size() - 1);
+        return h;
+    }
+
+    handle_type push(const value_type& value) { return emplace(value); }
+    handle_type push(value_type&& value)      { return emplace(tinystl::move(value)); }
+
+    /// @brief 删除堆顶：与 adjust_heap 一样先把洞沿较大的子节点下放到叶子，再把最后一个元素从洞处上浮
+    void pop() {
+        TINYSTL_DEBUG(!empty());
+        release_handle(heap_.front().handle);
+        entry tmp = tinystl::move(heap_.back());
+        heap_.pop_back();
+        if (heap_.empty()) return;
+        const size_type len = heap_.size();
+        size_type i = 0;
+        for (size_type child = 1; child < len; child = D * i + 1) {
+            const size_type best = best_child(child, len);
+            heap_[i] = tinystl::move(heap_[best]);
+            pos_[heap_[i].handle] = i;
+            i = best;
+        }
+        place_up(i, tinystl::move(tmp));
+    }
+
+    /// @brief 删除句柄 h 对应的元素
+    void erase(handle_type h) {
+        TINYSTL_DEBUG(contains(h));
+        remove_at(pos_[h]);
+    }
+
+    /// @brief 把句柄 h 对应的元素改为 value，按需上浮或下沉
+    void update(handle_type h, const value_type& value) {
+        TINYSTL_DEBUG(contains(h));
+        const size_type i = pos_[h];
+        const bool up = comp_(heap_[i].value, value);
+        heap_[i].value = value;
+        if (up) sift_up(i);
+        else    sift_down(i);
+    }
+
+    /// @brief 把句柄 h 对应元素的键减小为 value，小顶堆中上浮，大顶堆中下沉
+    void decrease_key(handle_type h, const value_type& value) { update(h, value); }
+
+    /// @brief 把句柄 h 对应元素的键增大为 value，小顶堆中下沉，大顶堆中上浮
+    void increase_key(handle_type h, const value_type& value) { update(h, value); }
+
+    /// @brief 把句柄 h 对应的元素改为优先级不低于原值的 value，只需上浮
+    void increase(handle_type h, const value_type& value) {
+        TINYSTL_DEBUG(contains(h) && !comp_(value, get(h)));
+        const size_type i = pos_[h];
+        heap_[i].value = value;
+        sift_up(i);
+    }
+
+    /// @brief 把句柄 h 对应的元素改为优先级不高于原值的 value，只需下沉
+    void decrease(handle_type h, const value_type& value) {
+        TINYSTL_DEBUG(contains(h) && !comp_(get(h), value));
+        const size_type i = pos_[h];
+        heap_[i].value = value;
+        sift_down(i);
+    }
+
+    void clear() noexcept {
+        heap_.clear();
+        pos_.clear();
+        free_.clear();
+    }
+
+    void swap(addressable_heap& rhs) noexcept {
+        heap_.swap(rhs.heap_);
+        pos_.swap(rhs.pos_);
+        free_.swap(rhs.free_);
+        tinystl::swap(comp_, rhs.comp_);
+    }
+
+private:  // 辅助函数
+    /// @brief 回收句柄 h：先放入 free_ 再修改 pos_，push_back 抛出异常时堆保持不变，
+    ///        因此 pop / remove_at 在改动堆数组之前调用它
+    void release_handle(handle_type h) {
+        free_.push_back(h);
+        pos_[h] = npos;
+    }
+
+    /// @brief [child, min(child + D, len)) 中优先级最高的子节点
+    size_type best_child(size_type child, size_type len) const {
+        const size_type end = child + D < len ? child + D : len;
+        size_type best = child;
+        for (size_type k = child + 1; k < end; ++k) {
+            if (comp_(heap_[best].value, heap_[k].value)) best = k;
+        }
+        return best;
+    }
+
+    /// @brief 删除下标 i 处的元素：用最后一个元素填补，再按需上浮或下沉
+    void remove_at(size_type i) {
+        release_handle(heap_[i].handle);
+        const size_type last = heap_.size() - 1;
+        if (i != last) {
+            const bool up = comp_(heap_[i].value, heap_[last].value);
+            heap_[i] = tinystl::move(heap_[last]);
+            pos_[heap_[i].handle] = i;
+            heap_.pop_back();
+            if (up) sift_up(i);
+            else    sift_down(i);
+        }
+        else {
+            heap_.pop_back();
+        }
+    }
+
+    /// @brief 把 tmp 放入下标 i 处的洞并上浮，与 push_heap_aux 一样先移动父节点，最后再放入元素
+    void place_up(size_type i, entry tmp) {
+        while (i > 0) {
+            const size_type parent = (i - 1) / D;
+            if (!comp_(heap_[parent].value, tmp.value)) break;
+            heap_[i] = tinystl::move(heap_[parent]);
+            pos_[heap_[i].handle] = i;
+            i = parent;
+        }
+        pos_[tmp.handle] = i;
+        heap_[i] = tinystl::move(tmp);
+    }
+
+    void sift_up(size_type i) { place_up(i, tinystl::move(heap_[i])); }
+
+    /// @brief 从下标 i 下沉，到元素不小于所有子节点为止
+    void sift_down(size_type i) {
+        const size_type len = heap_.size();
+        entry tmp = tinystl::move(heap_[i]);
+        for (size_type child = D * i + 1; child < len; child = D * i + 1) {
+            const size_type best = best_child(child, len);
+            if (!comp_(tmp.value, heap_[best].value)) break;
+            heap_[i] = tinystl::move(heap_[best]);
+            pos_[heap_[i].handle] = i;
+            i = best;
+        }
+        pos_[tmp.handle] = i;
+        heap_[i] = tinystl::move(tmp);
+    }
+};
+
+template <class T, class Compare, size_t D>
+constexpr typename addressable_heap<T, Compare, D>::size_type addressable_heap<T, Compare, D>::npos;
+
+// ==================================== 重载 swap ==================================== //
+
+template <class T, class Compare, size_t D>
+void swap(addressable_heap<T, Compare, D>& lhs, addressable_heap<T, Compare, D>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_ADDRESSABLE_HEAP_H_
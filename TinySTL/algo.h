@@ -421,6 +421,75 @@ ForwardIterator adjacent_find(ForwardIterator first, ForwardIterator last, Binar
     return last;
 }
 
+/*****************************************************************************************/
+// 无分支二分查找 (branchless binary search)
+// 元素类型与 value 均为算术类型，且以 operator< 或 tinystl::less 比较时，
+// random_access 版本的 lower_bound / upper_bound 改用下面的无分支实现：
+// 每次折半用条件传送 (cmov) 代替难以预测的分支，并预取下一轮两个候选中点
+/*****************************************************************************************/
+
+#ifndef TINYSTL_BOUND_PREFETCH
+#define TINYSTL_BOUND_PREFETCH 1  // 设为 0 可关闭无分支二分查找中的预取
+#endif
+
+// 以 operator< 比较两侧的值，允许两侧类型不同，供不带 comp 的版本使用
+struct bound_less {
+    template <class T1, class T2>
+    bool operator()(const T1& lhs, const T2& rhs) const { return lhs < rhs; }
+};
+
+template <class Compare>
+struct is_bound_less : m_false_type {};
+
+template <>
+struct is_bound_less<bound_less> : m_true_type {};
+
+template <class T>
+struct is_bound_less<tinystl::less<T>> : m_true_type {};
+
+// 是否可以使用无分支版本
+template <class RandomAccessIterator, class T, class Compare>
+struct use_branchless_bound : m_bool_constant<
+    std::is_arithmetic<typename iterator_traits<RandomAccessIterator>::value_type>::value &&
+    std::is_arithmetic<T>::value && is_bound_less<Compare>::value> {};
+
+// 无分支 lower_bound 的判定条件：x < value
+template <class Compare>
+struct lbound_pred {
+    Compare comp;
+    lbound_pred(Compare c) : comp(c) {}
+    template <class T1, class T2>
+    bool operator()(const T1& x, const T2& value) const { return comp(x, value); }
+};
+
+// 无分支 upper_bound 的判定条件：!(value < x)
+template <class Compare>
+struct ubound_pred {
+    Compare comp;
+    ubound_pred(Compare c) : comp(c) {}
+    template <class T1, class T2>
+    bool operator()(const T1& x, const T2& value) const { return !comp(value, x); }
+};
+
+/// @brief 无分支的二分查找，返回第一个使 pred(x, value) 为 false 的位置
+template <class RandomAccessIterator, class T, class Pred>
+RandomAccessIterator branchless_bound(RandomAccessIterator first, RandomAccessIterator last,
+                                      const T& value, Pred pred) {
+    auto len = last - first;
+    if (len == 0) return first;
+    while (len > 1) {
+        auto half = len >> 1;
+#if TINYSTL_BOUND_PREFETCH
+        // 下一轮的中点不是 first + half / 2 就是 first + half + half / 2，两个都提前取进缓存
+        TINYSTL_PREFETCH(&*(first + (half >> 1)));
+        TINYSTL_PREFETCH(&*(first + half + (half >> 1)));
+#endif
+        first += pred(*(first + half), value) ? half : 0;
+        len -= half;
+    }
+    return first + (pred(*first, value) ? 1 : 0);
+}
+
 /*****************************************************************************************/
 // lower_bound
 // 在[first, last)中查找第一个不小于 value 的元素，并返回指向它的迭代器，若没有则返回 last
@@ -454,6 +523,9 @@ ForwardIterator lbound_dispatch(ForwardIterator first, ForwardIterator last,
 template <class RandomAccessIterator, class T>
 RandomAccessIterator lbound_dispatch(RandomAccessIterator first, RandomAccessIterator last, 
                                     const T& value, random_access_iterator_tag) {
+    if (use_branchless_bound<RandomAccessIterator, T, bound_less>::value) {
+        return tinystl::branchless_bound(first, last, value, lbound_pred<bound_less>(bound_less()));
+    }
     auto len = last - first;
     auto half = len;
     RandomAccessIterator middle;
@@ -501,6 +573,9 @@ ForwardIterator lbound_dispatch(ForwardIterator first, ForwardIterator last,
 template <class RandomAccessIterator, class T, class Compare>
 RandomAccessIterator lbound_dispatch(RandomAccessIterator first, RandomAccessIterator last, 
                                      const T& value, Compare comp, random_access_iterator_tag) {
+    if (use_branchless_bound<RandomAccessIterator, T, Compare>::value) {
+        return tinystl::branchless_bound(first, last, value, lbound_pred<Compare>(comp));
+    }
     auto len = last - first;
     auto half = len;
     RandomAccessIterator middle;
@@ -557,6 +632,9 @@ ForwardIterator ubound_dispatch(ForwardIterator first, ForwardIterator last,
 template <class RandomAccessIterator, class T>
 RandomAccessIterator ubound_dispatch(RandomAccessIterator first, RandomAccessIterator last, 
                                      const T& value, random_access_iterator_tag) {
+    if (use_branchless_bound<RandomAccessIterator, T, bound_less>::value) {
+        return tinystl::branchless_bound(first, last, value, ubound_pred<bound_less>(bound_less()));
+    }
     auto len = last - first;
     auto half = len;
     RandomAccessIterator middle;
@@ -601,6 +679,9 @@ ForwardIterator ubound_dispatch(ForwardIterator first, ForwardIterator last,
 template <class RandomAccessIterator, class T, class Compare>
 RandomAccessIterator ubound_dispatch(RandomAccessIterator first, RandomAccessIterator last, 
                                      const T& value, random_access_iterator_tag, Compare comp) {
+    if (use_branchless_bound<RandomAccessIterator, T, Compare>::value) {
+        return tinystl::branchless_bound(first, last, value, ubound_pred<Compare>(comp));
+    }
     auto len = last - first;
     auto half = len;
     RandomAccessIterator middle;
@@ -2198,6 +2279,38 @@ void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
     }
 }
 
+/*****************************************************************************************/
+// stable_sort
+// 将[first, last)内的元素以递增的方式排序，相等元素保持原有的相对次序
+// 思路：小区间直接插入排序，否则对前后两半递归排序，再用 inplace_merge 合并（两者都是稳定的）
+/*****************************************************************************************/
+
+/// @brief 稳定排序
+template <class RandomAccessIterator>
+void stable_sort(RandomAccessIterator first, RandomAccessIterator last) {
+    if (last - first <= static_cast<ptrdiff_t>(kThreshold)) {
+        tinystl::insertion_sort(first, last);
+        return;
+    }
+    auto middle = first + (last - first) / 2;
+    tinystl::stable_sort(first, middle);
+    tinystl::stable_sort(middle, last);
+    tinystl::inplace_merge(first, middle, last);
+}
+
+/// @brief 重载版本使用函数对象 comp 代替比较操作
+template <class RandomAccessIterator, class Compare>
+void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+    if (last - first <= static_cast<ptrdiff_t>(kThreshold)) {
+        tinystl::insertion_sort(first, last, comp);
+        return;
+    }
+    auto middle = first + (last - first) / 2;
+    tinystl::stable_sort(first, middle, comp);
+    tinystl::stable_sort(middle, last, comp);
+    tinystl::inplace_merge(first, middle, last, comp);
+}
+
 /*****************************************************************************************/
 // nth_element
 // 对序列重排，使得所有小于第 n 个元素的元素出现在它的前面，大于它的出现在它的后面
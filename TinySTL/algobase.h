@@ -21,6 +21,13 @@ namespace tinystl {
 #undef min
 #endif  // min
 
+// 预取 addr 所在的缓存行，编译器不支持时为空操作
+#if defined(__GNUC__) || defined(__clang__)
+#define TINYSTL_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define TINYSTL_PREFETCH(addr) ((void)0)
+#endif
+
 
 // ========================== max ========================== // 
 // max: 返回两个参数中的较大者，语义相等时返回第一个参数
@@ -3,13 +3,47 @@
 
 // 这个头文件包含一个类 alloc，用于分配和回收内存，以内存池的方式实现
 
+// notes:
+//
+// alloc 的小型区块只按 __ALIGN 对齐，大型区块由 malloc 分配，只保证 alignof(std::max_align_t)。
+// 对齐要求超过 __ALIGN 的类型（如 alignas(64) 的结构体、__m256）不经过内存池，
+// 由 aligned_allocate 直接分配，simple_alloc<T, alloc> 会按 alignof(T) 自动选择。
+// 只提供 allocate(bytes) / deallocate(p, bytes) 的自定义配置器仍可用于 simple_alloc，此时 T 的对齐要求
+// 不能超过 __ALIGN，否则编译时报错。
+
 #include <new>        // placement new
 #include <cstddef>    // ptrdiff_t, size_t
 #include <cstdio>     // std::fprintf
-#include <cstdlib>    // std::malloc, std::free
+#include <cstdlib>    // std::malloc, std::free, posix_memalign
+#include <type_traits> // std::integral_constant
+#if defined(_WIN32)
+#include <malloc.h>   // _aligned_malloc, _aligned_free
+#endif
 
 namespace tinystl {
 
+/// @brief 分配 bytes 字节、按 align 对齐的内存，align 须为 2 的幂，失败时抛出 std::bad_alloc
+inline void* aligned_allocate(size_t bytes, size_t align) {
+    void* p = nullptr;
+#if defined(_WIN32)
+    p = _aligned_malloc(bytes, align);
+#else
+    if (align < sizeof(void*)) align = sizeof(void*);  // posix_memalign 要求至少为指针大小
+    if (posix_memalign(&p, align, bytes) != 0) p = nullptr;
+#endif
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+/// @brief 释放由 aligned_allocate 分配的内存
+inline void aligned_deallocate(void* p) noexcept {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
 // 二级空间配置器的参数设置
 enum {__ALIGN = 8};  // 小型区块的上调边界
 enum {__MAX_BYTES = 128};  // 小型区块的上限
@@ -38,6 +72,21 @@ public:
     static void      deallocate(void* p, size_t n);
     static void*     reallocate(void* p, size_t old_sz, size_t new_sz);
 
+    // 按 align 对齐的版本，align 不超过 __ALIGN 时与上面相同，否则绕过内存池
+    static void*     allocate(size_t n, size_t align) {
+        return align <= static_cast<size_t>(__ALIGN) ? allocate(n) : aligned_allocate(n, align);
+    }
+
+    static void      deallocate(void* p, size_t n, size_t align) {
+        if (align <= static_cast<size_t>(__ALIGN)) deallocate(p, n);
+        else aligned_deallocate(p);
+    }
+
+    // 申请 bytes 字节时实际交付的区块大小，小型区块上调至 8 的倍数
+    static size_t    size_class(size_t bytes) {
+        return bytes > static_cast<size_t>(__MAX_BYTES) ? bytes : ROUND_UP(bytes);
+    }
+
 private:
     static size_t    ROUND_UP(size_t bytes);                   // 上调边界至 8 的倍数
     static size_t    FREELIST_INDEX(size_t bytes);             // 根据区块大小计算 free-lists 的下标
@@ -245,46 +294,58 @@ char* alloc::chunk_alloc(size_t size, int& nblock) {
 }
 
 
+/// @brief 判断 Alloc 是否提供按对齐分配的 allocate(bytes, align) / deallocate(p, bytes, align)
+template <class Alloc>
+struct has_aligned_allocate {
+    private:
+        struct two { char a; char b; };
+        template <class U> static two test(...);
+        template <class U> static char test(decltype(U::allocate(size_t(), size_t()))* = 0,
+                                            decltype(U::deallocate(nullptr, size_t(), size_t()))* = 0);
+    public:
+        static const bool value = sizeof(test<Alloc>(0)) == sizeof(char);
+};
+
+/// @brief 按元素个数分配的包装
+/// @note  Alloc 提供 allocate(bytes, align) / deallocate(p, bytes, align) 时按 alignof(T) 分配；
+///        只提供 allocate(bytes) / deallocate(p, bytes) 的配置器仍可使用，但只能用于 alignof(T) <= __ALIGN 的类型
 template <class T, class Alloc>
 class simple_alloc {
 public:
     static T* allocate(size_t n) {
-        return 0 == n ? 0 : (T*)Alloc::allocate(n * sizeof(T));
+        return 0 == n ? 0 : (T*)allocate_bytes(n * sizeof(T), aligned_tag());
     }
 
     static T* allocate(void) {
-        return (T*)Alloc::allocate(sizeof(T));
+        return (T*)allocate_bytes(sizeof(T), aligned_tag());
     }
 
     static void deallocate(T* p, size_t n) {
-        if (0 != n) Alloc::deallocate(p, n * sizeof(T));
+        if (0 != n) deallocate_bytes(p, n * sizeof(T), aligned_tag());
     }
 
     static void deallocate(T* p) {
-        Alloc::deallocate(p, sizeof(T));
+        deallocate_bytes(p, sizeof(T), aligned_tag());
     }
-};
-
 
-// 博主自己写的一个比较奇怪的偏特化
+private:
+    typedef std::integral_constant<bool, has_aligned_allocate<Alloc>::value> aligned_tag;
 
-template <class T, class S>
-class simple_alloc<T, allocator<S>> {
-public:
-    static T* allocate(size_t n) {
-        return 0 == n ? 0 : (T*)allocator<T>::allocate(n * sizeof(T));
+    static void* allocate_bytes(size_t bytes, std::true_type) {
+        return Alloc::allocate(bytes, alignof(T));
     }
 
-    static T* allocate(void) {
-        return (T*)allocator<T>::allocate(sizeof(T));
+    static void* allocate_bytes(size_t bytes, std::false_type) {
+        static_assert(alignof(T) <= __ALIGN, "Alloc without allocate(bytes, align) cannot serve over-aligned types");
+        return Alloc::allocate(bytes);
     }
 
-    static void deallocate(T* p, size_t n) {
-        if (0 != n) allocator<T>::deallocate(p, n * sizeof(T));
+    static void deallocate_bytes(void* p, size_t bytes, std::true_type) {
+        Alloc::deallocate(p, bytes, alignof(T));
     }
 
-    static void deallocate(T* p) {
-        allocator<T>::deallocate(p, sizeof(T));
+    static void deallocate_bytes(void* p, size_t bytes, std::false_type) {
+        Alloc::deallocate(p, bytes);
     }
 };
 
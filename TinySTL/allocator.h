@@ -4,14 +4,24 @@
 // 标准空间配置器，只是对 new 和 delete 做了简单封装
 // 简单起见，这里没有实现 set_new_handler 等异常处理机制
 
-#include <cstddef>      // ptrdiff_t, size_t
+// notes:
+//
+// allocator<T, Align> 按 max(alignof(T), Align) 对齐，Align 缺省为 0，即只考虑 alignof(T)。
+// 对齐要求不超过 alignof(std::max_align_t) 时直接使用 operator new，否则使用 aligned_allocate，
+// 例如 tinystl::vector<float, tinystl::allocator<float, 64>> 的数据按缓存行对齐，可以使用对齐的向量读写。
+
+#include <cstddef>      // ptrdiff_t, size_t, std::max_align_t
 #include <new>          // placement new
 #include "construct.h"  // 构造和销毁对象
 #include "util.h"       // forward, move
+#include "alloc.h"      // simple_alloc, aligned_allocate
 
 namespace tinystl {
 
-template <class T>
+/// @brief 模板类 allocator
+/// @tparam T  元素类型
+/// @tparam Align  额外的对齐要求，须为 0 或 2 的幂
+template <class T, size_t Align = 0>
 class allocator {
 
 public:
@@ -24,6 +34,14 @@ public:
     typedef size_t      size_type;        // 元素数量
     typedef ptrdiff_t   difference_type;  // 两个指针之间的距离
 
+    static constexpr size_t alignment = Align > alignof(T) ? Align : alignof(T);  // 实际的对齐边界
+
+    static_assert((alignment & (alignment - 1)) == 0, "allocator alignment must be a power of 2");
+
+private:
+    // operator new 只保证 alignof(std::max_align_t)
+    static constexpr bool over_aligned = alignment > alignof(std::max_align_t);
+
 public:
     static T* allocate();  
     static T* allocate(size_type n);
@@ -42,79 +60,111 @@ public:
     static void destroy(T* first, T* last);    
 };
 
+template <class T, size_t Align>
+constexpr size_t allocator<T, Align>::alignment;
+
+template <class T, size_t Align>
+constexpr bool allocator<T, Align>::over_aligned;
+
 /// @brief 分配一个 T 大小的内存
-template <class T>
-T* allocator<T>::allocate() {
+template <class T, size_t Align>
+T* allocator<T, Align>::allocate() {
     // 调用全局的 operator new, 分配一个 T 大小的内存并进行类型转换
+    if (over_aligned) return static_cast<T*>(aligned_allocate(sizeof(T), alignment));
     return static_cast<T*>(::operator new (sizeof(T)));
 }
 
 /// @brief 分配 n 个 T 大小的内存
-template <class T>
-T* allocator<T>::allocate(size_type n) {
+template <class T, size_t Align>
+T* allocator<T, Align>::allocate(size_type n) {
     // 调用全局的 operator new, 分配 n 个 T 大小的内存并进行类型转换
     if (n == 0) return nullptr;
+    if (over_aligned) return static_cast<T*>(aligned_allocate(n * sizeof(T), alignment));
     return static_cast<T*>(::operator new (n * sizeof(T)));
 }
 
 /// @brief 释放 ptr 指向的内存
-template <class T>
-void allocator<T>::deallocate(T* ptr) {
+template <class T, size_t Align>
+void allocator<T, Align>::deallocate(T* ptr) {
     // 调用全局的 operator delete, 释放 ptr 指向的内存
     if (ptr == nullptr) return;
-    ::operator delete(ptr);
+    if (over_aligned) aligned_deallocate(ptr);
+    else ::operator delete(ptr);
 }
 
 /// @brief 释放 ptr 指向的内存
 /// 实际上这里的 size 参数没有用到，只是为了与函数签名一致
-template <class T>
-void allocator<T>::deallocate(T* ptr, size_type /*size*/) {
+template <class T, size_t Align>
+void allocator<T, Align>::deallocate(T* ptr, size_type /*size*/) {
     // 调用全局的 operator delete, 释放 ptr 指向的内存
     if (ptr == nullptr) return;
-    ::operator delete(ptr);
+    if (over_aligned) aligned_deallocate(ptr);
+    else ::operator delete(ptr);
 }
 
 /// @brief 默认构造一个对象
-template <class T>
-void allocator<T>::construct(T* ptr) {
+template <class T, size_t Align>
+void allocator<T, Align>::construct(T* ptr) {
     // 调用 construct.h 中的 construct 函数
     tinystl::construct(ptr);  // 默认构造
 }
 
 /// @brief 拷贝构造一个对象 
-template <class T>
-void allocator<T>::construct(T* ptr, const T& value) {
+template <class T, size_t Align>
+void allocator<T, Align>::construct(T* ptr, const T& value) {
     tinystl::construct(ptr, value);  // 拷贝构造
 }
 
 /// @brief 移动构造一个对象
-template <class T>
-void allocator<T>::construct(T* ptr, T&& value) {
+template <class T, size_t Align>
+void allocator<T, Align>::construct(T* ptr, T&& value) {
     // tinystl::move 将左值转换为右值引用, 详见 util.h
     tinystl::construct(ptr, tinystl::move(value));  // 移动构造
 }
 
 /// @brief 带参构造一个对象
-template <class T>
+template <class T, size_t Align>
 template <class... Args>
-void allocator<T>::construct(T* ptr, Args&&... args) {
+void allocator<T, Align>::construct(T* ptr, Args&&... args) {
     // tinystl::forward 用于完美转发，详见 util.h
     tinystl::construct(ptr, tinystl::forward<Args>(args)...);  // 带参数的构造
 }
 
 /// @brief 析构一个对象
-template <class T>
-void allocator<T>::destroy(T* ptr) {
+template <class T, size_t Align>
+void allocator<T, Align>::destroy(T* ptr) {
     // 调用 construct.h 中的 destroy 函数
     tinystl::destroy(ptr);
 }
 
 /// @brief 析构两个指针之间的所有对象
-template <class T>
-void allocator<T>::destroy(T* first, T* last) {
+template <class T, size_t Align>
+void allocator<T, Align>::destroy(T* first, T* last) {
     tinystl::destroy(first, last);
 }
 
+// 让 allocator 也可以作为容器的 Alloc 参数，按元素个数转发给 allocator<T, Align>
+
+template <class T, class S, size_t Align>
+class simple_alloc<T, allocator<S, Align>> {
+public:
+    static T* allocate(size_t n) {
+        return allocator<T, Align>::allocate(n);
+    }
+
+    static T* allocate(void) {
+        return allocator<T, Align>::allocate();
+    }
+
+    static void deallocate(T* p, size_t n) {
+        allocator<T, Align>::deallocate(p, n);
+    }
+
+    static void deallocate(T* p) {
+        allocator<T, Align>::deallocate(p);
+    }
+};
+
 }  // namespace tinystl
 
 #endif  // TINYSTL_ALLOCATOR_H_
\ No newline at end of file
@@ -7,15 +7,24 @@
 // notes:
 //
 // 异常保证：
-// tinystl::deque<T, Alloc> 满足基本异常保证，部分函数无异常保证，并对以下等函数做强异常安全保证：
+// tinystl::deque<T, Alloc, BufSize> 满足基本异常保证，部分函数无异常保证，并对以下等函数做强异常安全保证：
 //   * emplace_front
 //   * emplace_back
 //   * emplace
 //   * push_front
 //   * push_back
 //   * insert
+//
+// 缓冲区：
+//   * 第三个模板参数 BufSize 指定每个缓冲区容纳的元素个数，缺省（0）时由 deque_buf_size 决定：
+//     sizeof(T) < 256 时为 4096 / sizeof(T)，否则为 16。也可以为自己的类型特化 deque_buf_size<T, 0>
+//   * 每个 deque 保留至多 DEQUE_SPARE_BLOCKS 个空闲缓冲区，头尾释放的缓冲区先放入其中，
+//     需要新缓冲区时优先取用。作为 queue 的底层容器时，稳定的 push_back / pop_front 不再分配内存
+//   * clear 后空闲缓冲区仍然保留，直到析构时才归还给空间配置器
 
 #include <initializer_list>
+#include <cstring>
+#include <type_traits>
 
 #include "iterator.h"
 #include "memory.h"
@@ -39,24 +48,34 @@ namespace tinystl {
 #define DEQUE_MAP_INIT_SIZE 8
 #endif
 
+// 每个 deque 保留的空闲缓冲区的最大个数
+#ifndef DEQUE_SPARE_BLOCKS
+#define DEQUE_SPARE_BLOCKS 2
+#endif
+
 /// @brief 确定 deque 的缓冲区大小
 /// @tparam T 
-template <class T>
+/// @tparam BufSize  指定的缓冲区大小（元素个数），为 0 时按元素大小决定
+template <class T, size_t BufSize = 0>
 struct deque_buf_size {
-    static constexpr size_t value = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+    static constexpr size_t value = BufSize != 0 ? BufSize : sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
 };
 
+template <class T, size_t BufSize>
+constexpr size_t deque_buf_size<T, BufSize>::value;
+
 // ============================================= deque_iterator ============================================= //
 
 /// @brief 模板类 deque_iterator
 /// @tparam T  迭代器所指向的对象的类型
 /// @tparam Ref  迭代器所指向的对象的引用类型
 /// @tparam Ptr  迭代器所指向的对象的指针类型
-template <class T, class Ref, class Ptr>
+/// @tparam BufSize  缓冲区大小，含义同 deque_buf_size
+template <class T, class Ref, class Ptr, size_t BufSize = 0>
 struct deque_iterator : public iterator<random_access_iterator_tag, T> {
     
-    typedef deque_iterator<T, T&, T*>             iterator;
-    typedef deque_iterator<T, const T&, const T*> const_iterator;
+    typedef deque_iterator<T, T&, T*, BufSize>             iterator;
+    typedef deque_iterator<T, const T&, const T*, BufSize> const_iterator;
     typedef deque_iterator                        self;
 
     typedef T              value_type;
@@ -67,7 +86,7 @@ struct deque_iterator : public iterator<random_access_iterator_tag, T> {
     typedef T*             value_pointer;
     typedef T**            map_pointer;
 
-    static const size_type buffer_size = deque_buf_size<T>::value;
+    static const size_type buffer_size = deque_buf_size<T, BufSize>::value;
 
     // 迭代器所含成员数据
     value_pointer cur;      // 指向当前缓冲区的当前元素
@@ -216,12 +235,235 @@ struct deque_iterator : public iterator<random_access_iterator_tag, T> {
 
 };  // struct deque_iterator
 
+// ====================================== 分段算法 ====================================== //
+// deque 的区间由若干段连续的缓冲区组成，逐个元素推进迭代器时每一步都要检查是否越过缓冲区。
+// 以下重载把区间按缓冲区拆成若干段，对每一段调用原生指针的版本：copy / move / fill
+// 可以用上 algobase.h 中的 memmove / memset，find / for_each / equal 的内层循环只是指针循环
+
+/// @brief 把原生指针区间 [first, last) 复制到 deque 中 result 开始处，按目标缓冲区分段
+template <class RandomAccessIterator, class T, size_t BufSize>
+typename std::enable_if<tinystl::is_random_access_iterator<RandomAccessIterator>::value,
+    deque_iterator<T, T&, T*, BufSize>>::type
+copy(RandomAccessIterator first, RandomAccessIterator last, deque_iterator<T, T&, T*, BufSize> result) {
+    auto n = last - first;
+    while (n > 0) {
+        const auto len = tinystl::min(n, static_cast<decltype(n)>(result.last - result.cur));
+        tinystl::copy(first, first + len, result.cur);
+        first += len;
+        result += len;
+        n -= len;
+    }
+    return result;
+}
+
+/// @brief 把 deque 的区间 [first, last) 复制到 result 开始处，按源缓冲区分段
+template <class T, class Ref, class Ptr, size_t BufSize, class OutputIterator>
+OutputIterator copy(deque_iterator<T, Ref, Ptr, BufSize> first,
+                    deque_iterator<T, Ref, Ptr, BufSize> last, OutputIterator result) {
+    if (first.node == last.node)
+        return tinystl::copy(first.cur, last.cur, result);
+    result = tinystl::copy(first.cur, first.last, result);
+    for (auto node = first.node + 1; node != last.node; ++node)
+        result = tinystl::copy(*node, *node + first.buffer_size, result);
+    return tinystl::copy(last.first, last.cur, result);
+}
+
+/// @brief deque 之间的复制，每一段取源与目标缓冲区剩余长度的较小者
+template <class T, class Ref, class Ptr, size_t BufSize1, class U, size_t BufSize2>
+deque_iterator<U, U&, U*, BufSize2>
+copy(deque_iterator<T, Ref, Ptr, BufSize1> first, deque_iterator<T, Ref, Ptr, BufSize1> last,
+     deque_iterator<U, U&, U*, BufSize2> result) {
+    auto n = last - first;
+    while (n > 0) {
+        const auto len = tinystl::min(n, tinystl::min(first.last - first.cur, result.last - result.cur));
+        tinystl::copy(first.cur, first.cur + len, result.cur);
+        first += len;
+        result += len;
+        n -= len;
+    }
+    return result;
+}
+
+/// @brief 把原生指针区间 [first, last) 移动到 deque 中 result 开始处，按目标缓冲区分段
+template <class RandomAccessIterator, class T, size_t BufSize>
+typename std::enable_if<tinystl::is_random_access_iterator<RandomAccessIterator>::value,
+    deque_iterator<T, T&, T*, BufSize>>::type
+move(RandomAccessIterator first, RandomAccessIterator last, deque_iterator<T, T&, T*, BufSize> result) {
+    auto n = last - first;
+    while (n > 0) {
+        const auto len = tinystl::min(n, static_cast<decltype(n)>(result.last - result.cur));
+        tinystl::move(first, first + len, result.cur);
+        first += len;
+        result += len;
+        n -= len;
+    }
+    return result;
+}
+
+/// @brief 把 deque 的区间 [first, last) 移动到 result 开始处，按源缓冲区分段
+template <class T, class Ref, class Ptr, size_t BufSize, class OutputIterator>
+OutputIterator move(deque_iterator<T, Ref, Ptr, BufSize> first,
+                    deque_iterator<T, Ref, Ptr, BufSize> last, OutputIterator result) {
+    if (first.node == last.node)
+        return tinystl::move(first.cur, last.cur, result);
+    result = tinystl::move(first.cur, first.last, result);
+    for (auto node = first.node + 1; node != last.node; ++node)
+        result = tinystl::move(*node, *node + first.buffer_size, result);
+    return tinystl::move(last.first, last.cur, result);
+}
+
+/// @brief deque 之间的移动，每一段取源与目标缓冲区剩余长度的较小者
+template <class T, class Ref, class Ptr, size_t BufSize1, class U, size_t BufSize2>
+deque_iterator<U, U&, U*, BufSize2>
+move(deque_iterator<T, Ref, Ptr, BufSize1> first, deque_iterator<T, Ref, Ptr, BufSize1> last,
+     deque_iterator<U, U&, U*, BufSize2> result) {
+    auto n = last - first;
+    while (n > 0) {
+        const auto len = tinystl::min(n, tinystl::min(first.last - first.cur, result.last - result.cur));
+        tinystl::move(first.cur, first.cur + len, result.cur);
+        first += len;
+        result += len;
+        n -= len;
+    }
+    return result;
+}
+
+/// @brief 从 first 开始填充 n 个 value，按缓冲区分段
+template <class T, size_t BufSize, class Size, class Up>
+deque_iterator<T, T&, T*, BufSize>
+fill_n(deque_iterator<T, T&, T*, BufSize> first, Size n, const Up& value) {
+    typedef typename deque_iterator<T, T&, T*, BufSize>::difference_type difference_type;
+    auto left = static_cast<difference_type>(n);
+    while (left > 0) {
+        const auto len = tinystl::min(left, first.last - first.cur);
+        tinystl::fill_n(first.cur, len, value);
+        first += len;
+        left -= len;
+    }
+    return first;
+}
+
+/// @brief 将 [first, last) 区间内的元素填充为 value，按缓冲区分段
+template <class T, size_t BufSize, class Up>
+void fill(deque_iterator<T, T&, T*, BufSize> first, deque_iterator<T, T&, T*, BufSize> last,
+          const Up& value) {
+    if (first.node == last.node) {
+        tinystl::fill_n(first.cur, last.cur - first.cur, value);
+        return;
+    }
+    tinystl::fill_n(first.cur, first.last - first.cur, value);
+    for (auto node = first.node + 1; node != last.node; ++node)
+        tinystl::fill_n(*node, first.buffer_size, value);
+    tinystl::fill_n(last.first, last.cur - last.first, value);
+}
+
+/// @brief 在 [first, last) 区间内找到等于 value 的元素，按缓冲区分段
+template <class T, class Ref, class Ptr, size_t BufSize, class Up>
+deque_iterator<T, Ref, Ptr, BufSize>
+find(deque_iterator<T, Ref, Ptr, BufSize> first, deque_iterator<T, Ref, Ptr, BufSize> last,
+     const Up& value) {
+    while (first.node != last.node) {
+        for (auto p = first.cur; p != first.last; ++p) {
+            if (*p == value) {
+                first.cur = p;
+                return first;
+            }
+        }
+        first.set_node(first.node + 1);
+        first.cur = first.first;
+    }
+    for (auto p = first.cur; p != last.cur; ++p) {
+        if (*p == value) {
+            first.cur = p;
+            return first;
+        }
+    }
+    return last;
+}
+
+/// @brief 对 [first, last) 区间内的每个元素调用 f，按缓冲区分段
+template <class T, class Ref, class Ptr, size_t BufSize, class Function>
+Function for_each(deque_iterator<T, Ref, Ptr, BufSize> first,
+                  deque_iterator<T, Ref, Ptr, BufSize> last, Function f) {
+    if (first.node == last.node) {
+        for (Ptr p = first.cur; p != last.cur; ++p) f(*p);
+        return f;
+    }
+    for (Ptr p = first.cur; p != first.last; ++p) f(*p);
+    for (auto node = first.node + 1; node != last.node; ++node) {
+        Ptr end = *node + first.buffer_size;
+        for (Ptr p = *node; p != end; ++p) f(*p);
+    }
+    for (Ptr p = last.first; p != last.cur; ++p) f(*p);
+    return f;
+}
+
+/// @brief equal 的分段内核，比较 [first1, first1 + n) 与 first2 开始的 n 个元素，并推进 first2
+template <class T, class InputIterator>
+bool segment_equal_n(const T* first1, size_t n, InputIterator& first2, std::false_type) {
+    for (; n > 0; --n, ++first1, ++first2) {
+        if (!(*first1 == *first2)) return false;
+    }
+    return true;
+}
+
+// 整数与指针逐字节相等即值相等，用 memcmp 比较
+template <class T, class InputIterator>
+bool segment_equal_n(const T* first1, size_t n, InputIterator& first2, std::true_type) {
+    if (n == 0) return true;
+    const bool eq = std::memcmp(first1, first2, n * sizeof(T)) == 0;
+    first2 += n;
+    return eq;
+}
+
+template <class T, class InputIterator>
+struct segment_bitwise_equal : public std::integral_constant<bool,
+    std::is_pointer<InputIterator>::value &&
+    std::is_same<typename std::remove_cv<typename std::remove_pointer<InputIterator>::type>::type, T>::value &&
+    (std::is_integral<T>::value || std::is_pointer<T>::value)> {};
+
+/// @brief 比较 deque 的区间 [first1, last1) 与 first2 开始的序列是否相等，按缓冲区分段
+template <class T, class Ref, class Ptr, size_t BufSize, class InputIterator>
+bool equal(deque_iterator<T, Ref, Ptr, BufSize> first1, deque_iterator<T, Ref, Ptr, BufSize> last1,
+           InputIterator first2) {
+    typedef segment_bitwise_equal<T, InputIterator> bitwise;
+    if (first1.node == last1.node)
+        return segment_equal_n(first1.cur, static_cast<size_t>(last1.cur - first1.cur), first2, bitwise());
+    if (!segment_equal_n(first1.cur, static_cast<size_t>(first1.last - first1.cur), first2, bitwise()))
+        return false;
+    for (auto node = first1.node + 1; node != last1.node; ++node) {
+        if (!segment_equal_n(*node, first1.buffer_size, first2, bitwise()))
+            return false;
+    }
+    return segment_equal_n(last1.first, static_cast<size_t>(last1.cur - last1.first), first2, bitwise());
+}
+
+/// @brief 比较两个 deque 的区间是否相等，每一段取两边缓冲区剩余长度的较小者
+template <class T, class Ref1, class Ptr1, size_t BufSize1, class U, class Ref2, class Ptr2, size_t BufSize2>
+bool equal(deque_iterator<T, Ref1, Ptr1, BufSize1> first1, deque_iterator<T, Ref1, Ptr1, BufSize1> last1,
+           deque_iterator<U, Ref2, Ptr2, BufSize2> first2) {
+    typedef segment_bitwise_equal<T, U*> bitwise;
+    auto n = last1 - first1;
+    while (n > 0) {
+        const auto len = tinystl::min(n, tinystl::min(first1.last - first1.cur, first2.last - first2.cur));
+        U* p = first2.cur;
+        if (!segment_equal_n(first1.cur, static_cast<size_t>(len), p, bitwise()))
+            return false;
+        first1 += len;
+        first2 += len;
+        n -= len;
+    }
+    return true;
+}
+
 
 // ============================================= deque ============================================= //
 
 /// @brief 模板类 deque
 /// @tparam T  deque 中存储的元素的类型
-template <class T, class Alloc = tinystl::allocator<T>>
+/// @tparam Alloc  空间配置器
+/// @tparam BufSize  每个缓冲区容纳的元素个数，为 0 时由 deque_buf_size 决定
+template <class T, class Alloc = tinystl::allocator<T>, size_t BufSize = 0>
 class deque {
 
 public: // deque 的型别定义
@@ -253,14 +495,16 @@ public: // deque 的型别定义
     typedef pointer*                                  map_pointer;
     typedef const pointer*                            const_map_pointer;
 
-    typedef deque_iterator<T, T&, T*>                 iterator;
-    typedef deque_iterator<T, const T&, const T*>     const_iterator;
+    typedef deque_iterator<T, T&, T*, BufSize>       iterator;
+    typedef deque_iterator<T, const T&, const T*, BufSize> const_iterator;
     typedef tinystl::reverse_iterator<iterator>       reverse_iterator;
     typedef tinystl::reverse_iterator<const_iterator> const_reverse_iterator;
 
     allocator_type get_allocator() { return allocator_type(); }  // 返回一个 allocator
 
-    static const size_type buffer_size = deque_buf_size<T>::value;
+    static const size_type buffer_size = deque_buf_size<T, BufSize>::value;
+
+    static_assert(DEQUE_SPARE_BLOCKS > 0, "DEQUE_SPARE_BLOCKS must be positive");
 
 private: // deque 的成员变量
     
@@ -268,6 +512,8 @@ private: // deque 的成员变量
     iterator    finish_;       // 指向最后一个缓冲区
     map_pointer map_;          // 指向管控中心，管控中心是一个指针数组，每个指针指向一个缓冲区
     size_type   map_size_;     // 管控中心的大小
+    pointer     spare_[DEQUE_SPARE_BLOCKS] = {};  // 空闲缓冲区
+    size_type   spare_count_ = 0;                 // 空闲缓冲区的个数
 
 public:  // 构造、复制、移动、析构函数
 
@@ -290,11 +536,15 @@ public:  // 构造、复制、移动、析构函数
     }
 
     deque(deque&& rhs) noexcept
-        : start_(rhs.start_), finish_(rhs.finish_), map_(rhs.map_), map_size_(rhs.map_size_) {
+        : start_(rhs.start_), finish_(rhs.finish_), map_(rhs.map_), map_size_(rhs.map_size_),
+          spare_count_(rhs.spare_count_) {
+        for (size_type i = 0; i < spare_count_; ++i)
+            spare_[i] = rhs.spare_[i];
         rhs.start_ = iterator();
         rhs.finish_ = iterator();
         rhs.map_ = nullptr;
         rhs.map_size_ = 0;
+        rhs.spare_count_ = 0;
     }
 
     deque& operator=(const deque& rhs);
@@ -314,6 +564,7 @@ public:  // 构造、复制、移动、析构函数
             map_allocator::deallocate(map_, map_size_);
             map_ = nullptr;
         }
+        release_spare();
     }
 
 public:  // 迭代器相关操作
@@ -470,6 +721,16 @@ private:  // help functions
     template <class ...Args>
     iterator    insert_aux(iterator pos, Args&& ...args);
 
+    // relocate，仅用于可平凡重定位的元素，逐个缓冲区以 memmove 代替逐个赋值
+    static constexpr bool relocatable = tinystl::is_trivially_relocatable<T>::value;
+
+    template <class ...Args>
+    iterator    relocate_insert_aux(iterator pos, Args&& ...args);
+    iterator    relocate_erase(iterator first, iterator last);
+
+    static iterator relocate_forward(iterator first, iterator last, iterator result);
+    static iterator relocate_backward(iterator first, iterator last, iterator result);
+
     void        fill_insert(iterator pos, size_type n, const value_type& value);
 
     template <class ForwardIterator>
@@ -490,13 +751,25 @@ private:  // help functions
 
 public:  // appendix
 
-    /// @brief 为 node 分配存放元素的缓冲区
+    /// @brief 为 node 分配存放元素的缓冲区，优先取用空闲缓冲区
     /// @return 返回分配的缓冲区的首地址
-    pointer     allocate_node() { return data_allocator::allocate(buffer_size); }
+    pointer     allocate_node() {
+        if (spare_count_ != 0) return spare_[--spare_count_];
+        return data_allocator::allocate(buffer_size);
+    }
 
-    /// @brief 释放 node 所指向的缓冲区
+    /// @brief 释放 node 所指向的缓冲区，空闲缓冲区未满时留作下次使用
     /// @param p  缓冲区的首地址
-    void        deallocate_node(pointer p) { data_allocator::deallocate(p, buffer_size); }
+    void        deallocate_node(pointer p) {
+        if (spare_count_ < DEQUE_SPARE_BLOCKS) spare_[spare_count_++] = p;
+        else data_allocator::deallocate(p, buffer_size);
+    }
+
+    /// @brief 把全部空闲缓冲区归还给空间配置器
+    void        release_spare() noexcept {
+        while (spare_count_ != 0)
+            data_allocator::deallocate(spare_[--spare_count_], buffer_size);
+    }
 
     /// @brief 分配一个大小为 n 的 map
     /// @param n  map 的大小
@@ -557,8 +830,8 @@ public:  // appendix
 // =================================== 函数实现 =================================== //
 
 /// @brief 复制赋值运算符
-template <class T, class Alloc>
-deque<T, Alloc>& deque<T, Alloc>::operator=(const deque& rhs) {
+template <class T, class Alloc, size_t BufSize>
+deque<T, Alloc, BufSize>& deque<T, Alloc, BufSize>::operator=(const deque& rhs) {
     if (this != &rhs) {
         const auto len = size();
         if (len >= rhs.size()) {
@@ -574,23 +847,17 @@ deque<T, Alloc>& deque<T, Alloc>::operator=(const deque& rhs) {
 }
 
 /// @brief 移动赋值运算符
-template <class T, class Alloc>
-deque<T, Alloc>& deque<T, Alloc>::operator=(deque&& rhs) noexcept {
-    clear();
-    start_ = tinystl::move(rhs.start_);
-    finish_ = tinystl::move(rhs.finish_);
-    map_ = rhs.map_;
-    map_size_ = rhs.map_size_;
-
-    rhs.map_ = nullptr;
-    rhs.map_size_ = 0;
-
+template <class T, class Alloc, size_t BufSize>
+deque<T, Alloc, BufSize>& deque<T, Alloc, BufSize>::operator=(deque&& rhs) noexcept {
+    // 原有的缓冲区、管控中心与空闲缓冲区随 tmp 一同释放
+    deque tmp(tinystl::move(rhs));
+    swap(tmp);
     return *this;
 }
 
 /// @brief 重置容器的大小
-template <class T, class Alloc>
-void deque<T, Alloc>::resize(size_type new_size, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::resize(size_type new_size, const value_type& value) {
     const auto len = size();
     if (new_size < len) {
         erase(begin() + new_size, end());
@@ -616,9 +883,9 @@ void deque<T, Alloc>::resize(size_type new_size, const value_type& value) {
 // }
 
 /// @brief 在头部就地构造元素
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ...Args>
-void deque<T, Alloc>::emplace_front(Args&& ...args) {
+void deque<T, Alloc, BufSize>::emplace_front(Args&& ...args) {
     // 如果头部缓冲区还有空间，就在头部就地构造元素
     if (start_.cur != start_.first) {
         tinystl::construct(start_.cur - 1, tinystl::forward<Args>(args)...);
@@ -640,9 +907,9 @@ void deque<T, Alloc>::emplace_front(Args&& ...args) {
 }
 
 /// @brief 在尾部就地构造元素
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ...Args>
-void deque<T, Alloc>::emplace_back(Args&& ...args) {
+void deque<T, Alloc, BufSize>::emplace_back(Args&& ...args) {
     // 如果尾部缓冲区还有空间，就在尾部就地构造元素
     if (finish_.cur != finish_.last - 1) {
         tinystl::construct(finish_.cur, tinystl::forward<Args>(args)...);
@@ -658,9 +925,9 @@ void deque<T, Alloc>::emplace_back(Args&& ...args) {
 }
 
 /// @brief 在 pos 处就地构造元素
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ...Args>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::emplace(iterator pos, Args&& ...args) {
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::emplace(iterator pos, Args&& ...args) {
     if (pos.cur == start_.cur) {
         emplace_front(tinystl::forward<Args>(args)...);
         return start_;
@@ -675,9 +942,9 @@ typename deque<T, Alloc>::iterator deque<T, Alloc>::emplace(iterator pos, Args&&
 /// @brief 重新分配 map 并在尾部添加元素
 /// @tparam T  元素类型
 /// @param ...args  元素的构造参数
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class... Args>
-inline void deque<T, Alloc>::push_back_aux(Args &&...args)
+inline void deque<T, Alloc, BufSize>::push_back_aux(Args &&...args)
 {
     reserve_map_at_back();
     *(finish_.node + 1) = allocate_node();
@@ -695,9 +962,9 @@ inline void deque<T, Alloc>::push_back_aux(Args &&...args)
 /// @brief 重新分配 map 并在头部添加元素
 /// @tparam T  元素类型
 /// @param ...args  元素的构造参数
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class... Args>
-inline void deque<T, Alloc>::push_front_aux(Args &&...args)
+inline void deque<T, Alloc, BufSize>::push_front_aux(Args &&...args)
 {
     reserve_map_at_front();
     *(start_.node - 1) = allocate_node();
@@ -714,8 +981,8 @@ inline void deque<T, Alloc>::push_front_aux(Args &&...args)
 }
 
 /// @brief 弹出头部元素
-template <class T, class Alloc>
-void deque<T, Alloc>::pop_front() {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::pop_front() {
     TINYSTL_DEBUG(!empty());
     // 如果头部缓冲区还有元素，就在头部就地销毁元素
     if (start_.cur != start_.last - 1) {
@@ -731,8 +998,8 @@ void deque<T, Alloc>::pop_front() {
 }
 
 /// @brief 弹出尾部元素
-template <class T, class Alloc>
-void deque<T, Alloc>::pop_back() {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::pop_back() {
     TINYSTL_DEBUG(!empty());
     // 如果尾部缓冲区还有元素，就在尾部就地销毁元素
     if (finish_.cur != finish_.first) {
@@ -748,20 +1015,20 @@ void deque<T, Alloc>::pop_back() {
 }
 
 /// @brief 在 pos 处插入元素
-template <class T, class Alloc>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::insert(iterator pos, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::insert(iterator pos, const value_type& value) {
     return emplace(pos, value);
 }
 
 /// @brief 在 pos 处插入元素
-template <class T, class Alloc>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::insert(iterator pos, value_type&& value) {
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::insert(iterator pos, value_type&& value) {
     return emplace(pos, tinystl::move(value));
 }
 
 /// @brief 在 pos 处插入 n 个元素
-template <class T, class Alloc>
-void deque<T, Alloc>::insert(iterator pos, size_type n, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::insert(iterator pos, size_type n, const value_type& value) {
     if (pos.cur == start_.cur) {
         // require_capacity(n, true);
         // auto new_start = start_ - static_cast<difference_type>(n);
@@ -782,9 +1049,12 @@ void deque<T, Alloc>::insert(iterator pos, size_type n, const value_type& value)
 }
 
 /// @brief 清除 pos 处的元素
-template <class T, class Alloc>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::erase(iterator pos) {
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::erase(iterator pos) {
     auto next = pos; ++next;  // 尽量不要使用 pos + 1
+    if (relocatable) {
+        return relocate_erase(pos, next);
+    }
     const auto elem_before = pos - start_;
     // 如果 pos 前面的元素比较少，就从前面开始移动
     if (elem_before < (size() >> 1)) {
@@ -800,12 +1070,15 @@ typename deque<T, Alloc>::iterator deque<T, Alloc>::erase(iterator pos) {
 }
 
 /// @brief 清除 [first, last) 内的元素
-template <class T, class Alloc>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::erase(iterator first, iterator last) {
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::erase(iterator first, iterator last) {
     if (first == start_ && last == finish_) {
         clear();
         return finish_;
     }
+    else if (relocatable) {
+        return relocate_erase(first, last);
+    }
     else {
         const auto n = last - first;
         const auto elems_before = first - start_;
@@ -813,16 +1086,20 @@ typename deque<T, Alloc>::iterator deque<T, Alloc>::erase(iterator first, iterat
         if (elems_before < (size() - n) / 2) {
             tinystl::copy_backward(start_, first, last);
             auto new_start = start_ + n;
-            tinystl::destroy(start_.cur, new_start.cur);
-            // destroy_buffer(start_.node, new_start.node - 1);
+            tinystl::destroy(start_, new_start);  // 区间可能跨越多个缓冲区
+            if (start_.node != new_start.node) {
+                destroy_buffer(start_.node, new_start.node - 1);
+            }
             start_ = new_start;
         }
         // 否则从后面开始移动
         else {
             tinystl::copy(last, finish_, first);
             auto new_finish = finish_ - n;
-            tinystl::destroy(new_finish.cur, finish_.cur);
-            // destroy_buffer(new_finish.node + 1, finish_.node);
+            tinystl::destroy(new_finish, finish_);
+            if (finish_.node != new_finish.node) {
+                destroy_buffer(new_finish.node + 1, finish_.node);
+            }
             finish_ = new_finish;
         }
         return start_ + elems_before;
@@ -830,18 +1107,18 @@ typename deque<T, Alloc>::iterator deque<T, Alloc>::erase(iterator first, iterat
 }
 
 /// @brief 清空 deque，保留头部的缓冲区
-template <class T, class Alloc>
-void deque<T, Alloc>::clear() {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::clear() {
     // 针对头尾以外的缓冲区，全部释放
     for (auto cur = start_.node + 1; cur < finish_.node; ++cur) {
         tinystl::destroy(*cur, *cur + buffer_size);       // 析构缓冲区内的元素
-        data_allocator::deallocate(*cur, buffer_size);           // 释放缓冲区
+        deallocate_node(*cur);                            // 释放缓冲区
     }
     // 至少有头尾两个缓冲区
     if (start_.node != finish_.node) {
         tinystl::destroy(start_.cur, start_.last);        // 析构头部缓冲区内的元素
         tinystl::destroy(finish_.first, finish_.cur);     // 析构尾部缓冲区内的元素
-        data_allocator::deallocate(finish_.first, buffer_size);  // 释放尾部缓冲区
+        deallocate_node(finish_.first);                   // 释放尾部缓冲区
     }
     // 仅剩一个缓冲区
     else tinystl::destroy(start_.cur, finish_.cur);       // 只需析构头部缓冲区内的元素
@@ -851,21 +1128,24 @@ void deque<T, Alloc>::clear() {
 }
 
 /// @brief 交换两个 deque
-template <class T, class Alloc>
-void deque<T, Alloc>::swap(deque& rhs) noexcept {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::swap(deque& rhs) noexcept {
     if (this != &rhs) {
         tinystl::swap(start_, rhs.start_);
         tinystl::swap(finish_, rhs.finish_);
         tinystl::swap(map_, rhs.map_);
         tinystl::swap(map_size_, rhs.map_size_);
+        tinystl::swap(spare_count_, rhs.spare_count_);
+        for (size_type i = 0; i < DEQUE_SPARE_BLOCKS; ++i)
+            tinystl::swap(spare_[i], rhs.spare_[i]);
     }
 }
 
 // =================================== help functions =================================== //
 
 /// @brief 创建管控中心
-template <class T, class Alloc>
-typename deque<T, Alloc>::map_pointer deque<T, Alloc>::create_map(size_type size) {
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::map_pointer deque<T, Alloc, BufSize>::create_map(size_type size) {
     map_pointer map = nullptr;
     map = map_allocator::allocate(size);
     for (auto cur = map; cur < map + size; ++cur) {
@@ -875,18 +1155,18 @@ typename deque<T, Alloc>::map_pointer deque<T, Alloc>::create_map(size_type size
 }
 
 /// @brief 创建缓冲区
-template <class T, class Alloc>
-void deque<T, Alloc>::create_buffer(map_pointer nstart, map_pointer nfinish) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::create_buffer(map_pointer nstart, map_pointer nfinish) {
     map_pointer cur;
     try {
         for (cur = nstart; cur <= nfinish; ++cur) {
-            *cur = data_allocator::allocate(buffer_size);
+            *cur = allocate_node();
         }
     }
     catch (...) {
         while (cur != nstart) {
             --cur;
-            data_allocator::deallocate(*cur, buffer_size);
+            deallocate_node(*cur);
             *cur = nullptr;
         }
         throw;
@@ -894,17 +1174,17 @@ void deque<T, Alloc>::create_buffer(map_pointer nstart, map_pointer nfinish) {
 }
 
 /// @brief 销毁缓冲区
-template <class T, class Alloc>
-void deque<T, Alloc>::destroy_buffer(map_pointer nstart, map_pointer nfinish) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::destroy_buffer(map_pointer nstart, map_pointer nfinish) {
     for (auto cur = nstart; cur <= nfinish; ++cur) {
-        data_allocator::deallocate(*cur, buffer_size);
+        deallocate_node(*cur);
         *cur = nullptr;
     }
 }
 
 /// @brief 初始化一个容量为 nElem 的 deque
-template <class T, class Alloc>
-void deque<T, Alloc>::map_init(size_type nElem) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::map_init(size_type nElem) {
     // 需要节点数 = （元素数 / 缓冲区大小） + 1
     // 如果刚好整除，会多分配一个节点
     const auto nNode = nElem / buffer_size + 1;
@@ -945,12 +1225,12 @@ void deque<T, Alloc>::map_init(size_type nElem) {
 }
 
 /// @brief 初始化一个容量为 n 且每个元素都为 value 的 deque
-template <class T, class Alloc>
-void deque<T, Alloc>::fill_init(size_type n, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::fill_init(size_type n, const value_type& value) {
     map_init(n);
     if (n != 0) {
         // 填充非尾节点的缓冲区
-        for (auto cur = start_.node; cur <= finish_.node; ++cur) {
+        for (auto cur = start_.node; cur < finish_.node; ++cur) {
             tinystl::uninitialized_fill(*cur, *cur + buffer_size, value);
         }
         // 填充尾节点的缓冲区
@@ -959,9 +1239,9 @@ void deque<T, Alloc>::fill_init(size_type n, const value_type& value) {
 }
 
 /// @brief 利用 [first, last) 区间的元素初始化 deque
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class InputIterator>
-void deque<T, Alloc>::copy_init(InputIterator first, InputIterator last, tinystl::input_iterator_tag) {
+void deque<T, Alloc, BufSize>::copy_init(InputIterator first, InputIterator last, tinystl::input_iterator_tag) {
     const difference_type n = tinystl::distance(first, last);
     map_init(n);
     for (; first != last; ++first) {
@@ -970,9 +1250,9 @@ void deque<T, Alloc>::copy_init(InputIterator first, InputIterator last, tinystl
 }
 
 /// @brief 利用 [first, last) 区间的元素初始化 deque
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ForwardIterator>
-void deque<T, Alloc>::copy_init(ForwardIterator first, ForwardIterator last, tinystl::forward_iterator_tag) {
+void deque<T, Alloc, BufSize>::copy_init(ForwardIterator first, ForwardIterator last, tinystl::forward_iterator_tag) {
     const difference_type n = tinystl::distance(first, last);
     map_init(n);
     for (auto cur = start_.node; cur < finish_.node; ++cur) {
@@ -985,8 +1265,8 @@ void deque<T, Alloc>::copy_init(ForwardIterator first, ForwardIterator last, tin
 }
 
 /// @brief 为 deque 赋值 n 个 value
-template <class T, class Alloc>
-void deque<T, Alloc>::fill_assign(size_type n, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::fill_assign(size_type n, const value_type& value) {
     if (n > size()) {
         tinystl::fill(begin(), end(), value);
         insert(end(), n - size(), value);
@@ -998,9 +1278,9 @@ void deque<T, Alloc>::fill_assign(size_type n, const value_type& value) {
 }
 
 /// @brief 将 [first, last) 区间的元素拷贝赋值给 deque
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class InputIterator>
-void deque<T, Alloc>::copy_assign(InputIterator first, InputIterator last, tinystl::input_iterator_tag) {
+void deque<T, Alloc, BufSize>::copy_assign(InputIterator first, InputIterator last, tinystl::input_iterator_tag) {
     auto first1 = begin();
     auto last1 = end();
 
@@ -1017,9 +1297,9 @@ void deque<T, Alloc>::copy_assign(InputIterator first, InputIterator last, tinys
 }
 
 /// @brief 将 [first, last) 区间的元素拷贝赋值给 deque
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ForwardIterator>
-void deque<T, Alloc>::copy_assign(ForwardIterator first, ForwardIterator last, tinystl::forward_iterator_tag) {
+void deque<T, Alloc, BufSize>::copy_assign(ForwardIterator first, ForwardIterator last, tinystl::forward_iterator_tag) {
     const auto len = tinystl::distance(first, last);
     if (len > size()) {
         auto next = first;
@@ -1033,9 +1313,12 @@ void deque<T, Alloc>::copy_assign(ForwardIterator first, ForwardIterator last, t
 }
 
 /// @brief 在 pos 处插入 1 个元素
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ...Args>
-typename deque<T, Alloc>::iterator deque<T, Alloc>::insert_aux(iterator pos, Args&& ...args) {
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::insert_aux(iterator pos, Args&& ...args) {
+    if (relocatable) {
+        return relocate_insert_aux(pos, tinystl::forward<Args>(args)...);
+    }
     const auto elem_before = pos - start_;
     // 如果前面的元素比较少，就从前面开始移动
     if (elem_before < (size() >> 1)) {
@@ -1058,13 +1341,123 @@ typename deque<T, Alloc>::iterator deque<T, Alloc>::insert_aux(iterator pos, Arg
     return pos;
 }
 
+/// @brief insert_aux 的可平凡重定位版本：把较短一侧的元素按字节搬移一位，在 pos 处留出空位再构造
+template <class T, class Alloc, size_t BufSize>
+template <class ...Args>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::relocate_insert_aux(iterator pos, Args&& ...args) {
+    const auto elem_before = pos - start_;
+    value_type tmp(tinystl::forward<Args>(args)...);  // 先构造，参数可能引用容器内的元素
+    if (elem_before < static_cast<difference_type>(size() >> 1)) {
+        auto new_start = reserve_elements_at_front(1);  // 可能重新分配 map，此后才能计算迭代器
+        pos = start_ + elem_before;
+        relocate_forward(start_, pos, new_start);
+        start_ = new_start;
+        pos = start_ + elem_before;
+        try {
+            tinystl::construct(pos.cur, tinystl::move(tmp));
+        }
+        catch (...) {
+            auto pos1 = pos;  ++pos1;
+            relocate_backward(start_, pos, pos1);
+            ++start_;
+            throw;
+        }
+    }
+    else {
+        auto new_finish = reserve_elements_at_back(1);
+        pos = start_ + elem_before;
+        relocate_backward(pos, finish_, new_finish);
+        finish_ = new_finish;
+        try {
+            tinystl::construct(pos.cur, tinystl::move(tmp));
+        }
+        catch (...) {
+            auto pos1 = pos;  ++pos1;
+            relocate_forward(pos1, finish_, pos);
+            --finish_;
+            throw;
+        }
+    }
+    return pos;
+}
+
+/// @brief erase 的可平凡重定位版本：析构 [first, last) 后把较短一侧的元素按字节搬移过来，并释放空出的缓冲区
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator deque<T, Alloc, BufSize>::relocate_erase(iterator first, iterator last) {
+    const auto n = last - first;
+    const auto elems_before = first - start_;
+    tinystl::destroy(first, last);
+    if (elems_before < static_cast<difference_type>((size() - n) / 2)) {
+        relocate_backward(start_, first, last);
+        auto new_start = start_ + n;
+        if (start_.node != new_start.node) {
+            destroy_buffer(start_.node, new_start.node - 1);
+        }
+        start_ = new_start;
+    }
+    else {
+        relocate_forward(last, finish_, first);
+        auto new_finish = finish_ - n;
+        if (finish_.node != new_finish.node) {
+            destroy_buffer(new_finish.node + 1, finish_.node);
+        }
+        finish_ = new_finish;
+    }
+    return start_ + elems_before;
+}
+
+/// @brief 把 [first, last) 按字节搬移到 result 开始处，按缓冲区分段调用 memmove，
+//  目标区间在源区间之前（或不重叠）时使用，返回目标区间的尾
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator
+deque<T, Alloc, BufSize>::relocate_forward(iterator first, iterator last, iterator result) {
+    auto n = last - first;
+    while (n > 0) {
+        auto len = tinystl::min(n, tinystl::min(first.last - first.cur, result.last - result.cur));
+        tinystl::relocate_bytes(result.cur, first.cur, static_cast<size_type>(len));
+        first += len;
+        result += len;
+        n -= len;
+    }
+    return result;
+}
+
+/// @brief 把 [first, last) 按字节搬移到以 result 为尾的区间，按缓冲区从后往前分段调用 memmove，
+//  目标区间在源区间之后（或不重叠）时使用，返回目标区间的头
+template <class T, class Alloc, size_t BufSize>
+typename deque<T, Alloc, BufSize>::iterator
+deque<T, Alloc, BufSize>::relocate_backward(iterator first, iterator last, iterator result) {
+    auto n = last - first;
+    while (n > 0) {
+        // 迭代器位于缓冲区头部时，其前面的元素在上一个缓冲区的尾部
+        difference_type llen = last.cur - last.first;
+        pointer         lend = last.cur;
+        if (llen == 0) {
+            llen = static_cast<difference_type>(buffer_size);
+            lend = *(last.node - 1) + buffer_size;
+        }
+        difference_type rlen = result.cur - result.first;
+        pointer         rend = result.cur;
+        if (rlen == 0) {
+            rlen = static_cast<difference_type>(buffer_size);
+            rend = *(result.node - 1) + buffer_size;
+        }
+        auto len = tinystl::min(n, tinystl::min(llen, rlen));
+        tinystl::relocate_bytes(rend - len, lend - len, static_cast<size_type>(len));
+        last -= len;
+        result -= len;
+        n -= len;
+    }
+    return result;
+}
+
 /// @brief 在 pos 处插入 n 个值为 value 的元素
 /// @tparam T  元素类型
 /// @param pos  插入的位置
 /// @param n  插入的元素个数
 /// @param value  插入的元素的值
-template <class T, class Alloc>
-void deque<T, Alloc>::fill_insert(iterator pos, size_type n, const value_type& value) {
+template <class T, class Alloc, size_t BufSize>
+void deque<T, Alloc, BufSize>::fill_insert(iterator pos, size_type n, const value_type& value) {
     const auto elem_before = pos - start_;
     const auto len = size();
     auto value_copy = value;
@@ -1133,9 +1526,9 @@ void deque<T, Alloc>::fill_insert(iterator pos, size_type n, const value_type& v
 }
 
 /// @brief 在 pos 处插入 [first, last) 区间的元素
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ForwardIterator>
-void deque<T, Alloc>::copy_insert(iterator pos, ForwardIterator first, ForwardIterator last, size_type n) {
+void deque<T, Alloc, BufSize>::copy_insert(iterator pos, ForwardIterator first, ForwardIterator last, size_type n) {
     const auto elem_before = pos - start_;
     const auto len = size();
 
@@ -1207,9 +1600,9 @@ void deque<T, Alloc>::copy_insert(iterator pos, ForwardIterator first, ForwardIt
 }
 
 /// @brief insert 的 InputIterator 版本
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class InputIterator>
-void deque<T, Alloc>::insert_dispatch(iterator pos, InputIterator first, InputIterator last, 
+void deque<T, Alloc, BufSize>::insert_dispatch(iterator pos, InputIterator first, InputIterator last, 
     tinystl::input_iterator_tag) {
     if (last <= first) return;
     const auto n = tinystl::distance(first, last);
@@ -1230,9 +1623,9 @@ void deque<T, Alloc>::insert_dispatch(iterator pos, InputIterator first, InputIt
 } 
 
 /// @brief insert 的 ForwardIterator 版本
-template <class T, class Alloc>
+template <class T, class Alloc, size_t BufSize>
 template <class ForwardIterator>
-void deque<T, Alloc>::insert_dispatch(iterator pos, ForwardIterator first, ForwardIterator last, 
+void deque<T, Alloc, BufSize>::insert_dispatch(iterator pos, ForwardIterator first, ForwardIterator last, 
     tinystl::forward_iterator_tag) {
     if (last <= first) return;
     const auto n = tinystl::distance(first, last);
@@ -1336,8 +1729,8 @@ void deque<T, Alloc>::insert_dispatch(iterator pos, ForwardIterator first, Forwa
 /// @tparam T  deque 的元素类型
 /// @param nodes_to_add  需要增加的节点个数
 /// @param add_at_front  是否在头部增加节点
-template <class T, class Alloc>
-inline void deque<T, Alloc>::reallocate_map(size_type nodes_to_add, bool add_at_front)
+template <class T, class Alloc, size_t BufSize>
+inline void deque<T, Alloc, BufSize>::reallocate_map(size_type nodes_to_add, bool add_at_front)
 {
     const size_type old_num_nodes = finish_.node - start_.node + 1;  // 原始的节点个数
     const size_type new_num_nodes = old_num_nodes + nodes_to_add;    // 新的节点个数
@@ -1380,8 +1773,8 @@ inline void deque<T, Alloc>::reallocate_map(size_type nodes_to_add, bool add_at_
 /// @brief 在头部分配 n 个元素的空间
 /// @tparam T  deque 的元素类型
 /// @param new_elements  需要分配的元素个数
-template <class T, class Alloc>
-inline void deque<T, Alloc>::new_elements_at_front(size_type new_elements)
+template <class T, class Alloc, size_t BufSize>
+inline void deque<T, Alloc, BufSize>::new_elements_at_front(size_type new_elements)
 {
     THROW_LENGTH_ERROR_IF(max_size() - size() < new_elements, "deque<T, Alloc> too long");
     const size_type new_nodes = (new_elements + buffer_size - 1) / buffer_size;
@@ -1401,8 +1794,8 @@ inline void deque<T, Alloc>::new_elements_at_front(size_type new_elements)
 /// @brief 在尾部分配 n 个元素的空间
 /// @tparam T  deque 的元素类型
 /// @param new_elements  需要分配的元素个数
-template <class T, class Alloc>
-inline void deque<T, Alloc>::new_elements_at_back(size_type new_elements)
+template <class T, class Alloc, size_t BufSize>
+inline void deque<T, Alloc, BufSize>::new_elements_at_back(size_type new_elements)
 {
     THROW_LENGTH_ERROR_IF(max_size() - size() < new_elements, "deque<T, Alloc> too long");
     const size_type new_nodes = (new_elements + buffer_size - 1) / buffer_size;
@@ -1421,41 +1814,41 @@ inline void deque<T, Alloc>::new_elements_at_back(size_type new_elements)
 
 // =================================== 重载比较运算符 =================================== //
 
-template <class T, class Alloc>
-bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator==(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
     return lhs.size() == rhs.size() && 
     tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class T, class Alloc>
-bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator<(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
     return tinystl::lexicographical_compare(
     lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class T, class Alloc>
-bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator!=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
   return !(lhs == rhs);
 }
 
-template <class T, class Alloc>
-bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator>(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
   return rhs < lhs;
 }
 
-template <class T, class Alloc>
-bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator<=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
   return !(rhs < lhs);
 }
 
-template <class T, class Alloc>
-bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+bool operator>=(const deque<T, Alloc, BufSize>& lhs, const deque<T, Alloc, BufSize>& rhs) {
   return !(lhs < rhs);
 }
 
 // 重载 tinystl 的 swap
-template <class T, class Alloc>
-void swap(deque<T, Alloc>& lhs, deque<T, Alloc>& rhs) {
+template <class T, class Alloc, size_t BufSize>
+void swap(deque<T, Alloc, BufSize>& lhs, deque<T, Alloc, BufSize>& rhs) {
   lhs.swap(rhs);
 }
 
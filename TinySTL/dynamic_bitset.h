@@ -0,0 +1,655 @@
+#ifndef TINYSTL_DYNAMIC_BITSET_H_
+#define TINYSTL_DYNAMIC_BITSET_H_
+
+// 这个头文件包含两个模板类 dynamic_bitset 和 bitset_rank_index
+// dynamic_bitset    : 长度可变的位集合，按 64 位字紧凑存放，替代被禁用的 vector<bool>
+// bitset_rank_index : 为 dynamic_bitset 建立的 rank / select 索引
+
+// notes:
+//
+// vector<bool> 在 tinystl 中被禁用，用 vector<char> 代替时每一位占一个字节。dynamic_bitset
+// 把位按 64 位一个字存放在 tinystl::vector<uint64_t> 中，内存只有 vector<char> 的 1/8，并且：
+//   * count / any / all / find_first / find_next / rank / select 以字为单位处理，
+//     每个字只需一次 popcount 或 ctz，编译器支持时直接使用 popcnt / tzcnt 等指令
+//   * &、|、^、~、-、<<、>> 逐字计算，循环简单，编译器可以向量化
+//   * 最后一个字中超出 size() 的高位始终为 0，因此各种逐字操作不需要额外的掩码
+//
+// 第 i 位位于第 i / 64 个字的第 i % 64 位，to_string 与 std::bitset 一致，最高位在前。
+// 两个位集合做 &、|、^ 等运算时长度必须相同。
+//
+// bitset_rank_index 每 512 位记录一次前缀计数，rank 最多再数 8 个字，select 先二分超块再逐字查找。
+// 索引只保存指向位集合的指针，位集合修改或销毁后需要重新建立。
+
+#include <cstdint>           // uint64_t
+#include <string>            // std::string
+#include <initializer_list>  // std::initializer_list
+#if defined(__BMI2__)
+#include <immintrin.h>       // _pdep_u64
+#endif
+
+#include "vector.h"
+#include "algobase.h"
+#include "algo.h"
+#include "exceptdef.h"
+#include "util.h"
+
+namespace tinystl {
+
+// ========================================= 位运算 ========================================= //
+
+/// @brief 统计 x 中 1 的个数；未开启 popcnt 指令时使用 SWAR 算法，避免逐位循环或查表
+inline size_t popcount64(uint64_t x) noexcept {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__POPCNT__)
+    return static_cast<size_t>(__builtin_popcountll(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<size_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/// @brief 最低位的 1 的位置，要求 x != 0
+inline size_t ctz64(uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(x));
+#else
+    size_t r = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++r;
+    }
+    return r;
+#endif
+}
+
+/// @brief 第 k 个（从 0 开始）1 的位置，要求 k < popcount64(x)
+inline size_t select64(uint64_t x, size_t k) noexcept {
+#if defined(__BMI2__)
+    return ctz64(_pdep_u64(1ULL << k, x));
+#else
+    for (; k > 0; --k) x &= x - 1;  // 去掉最低的 k 个 1
+    return ctz64(x);
+#endif
+}
+
+// ====================================== dynamic_bitset ====================================== //
+
+/// @brief 模板类 dynamic_bitset
+/// @tparam Alloc  存放字的 vector 使用的空间配置器
+template <class Alloc = alloc>
+class dynamic_bitset {
+
+public:
+    // dynamic_bitset 的嵌套型别定义
+    typedef uint64_t                              block_type;
+    typedef size_t                                size_type;
+    typedef bool                                  const_reference;
+    typedef tinystl::vector<block_type, Alloc>    container_type;
+
+    static constexpr size_type bits_per_block = 64;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    /// @brief 指向单个位的代理对象
+    class reference {
+        friend class dynamic_bitset;
+
+        block_type* block_;
+        block_type  mask_;
+
+        reference(block_type* block, size_type bit) noexcept
+            : block_(block), mask_(block_type(1) << bit) {}
+
+    public:
+        operator bool() const noexcept { return (*block_ & mask_) != 0; }
+        bool operator~() const noexcept { return (*block_ & mask_) == 0; }
+
+        reference& operator=(bool x) noexcept {
+            if (x) *block_ |= mask_;
+            else   *block_ &= ~mask_;
+            return *this;
+        }
+
+        reference& operator=(const reference& rhs) noexcept { return *this = static_cast<bool>(rhs); }
+
+        reference& operator|=(bool x) noexcept { if (x) *block_ |= mask_; return *this; }
+        reference& operator&=(bool x) noexcept { if (!x) *block_ &= ~mask_; return *this; }
+        reference& operator^=(bool x) noexcept { if (x) *block_ ^= mask_; return *this; }
+
+        reference& flip() noexcept {
+            *block_ ^= mask_;
+            return *this;
+        }
+    };
+
+private:
+    container_type blocks_;  // 按字存放的位，最后一个字中超出 size_ 的位为 0
+    size_type      size_;    // 位的个数
+
+public:
+
+    // =========================  构造函数  ========================= //
+
+    dynamic_bitset() noexcept : blocks_(), size_(0) {}
+
+    /// @brief 构造 n 位，全部置为 value
+    explicit dynamic_bitset(size_type n, bool value = false)
+        : blocks_(blocks_for(n), value ? ~block_type(0) : block_type(0)), size_(n) {
+        trim();
+    }
+
+    /// @brief 第 i 个元素为第 i 位
+    dynamic_bitset(std::initializer_list<bool> ilist) : blocks_(), size_(0) {
+        reserve(ilist.size());
+        for (bool b : ilist) push_back(b);
+    }
+
+    /// @brief 由 '0' / '1' 组成的字符串构造，与 std::bitset 一样最左边的字符为最高位
+    explicit dynamic_bitset(const std::string& str) : blocks_(blocks_for(str.size()), 0), size_(str.size()) {
+        for (size_type i = 0; i < size_; ++i) {
+            const char c = str[size_ - 1 - i];
+            THROW_RUNTIME_ERROR_IF(c != '0' && c != '1',
+                "dynamic_bitset(const std::string&) only accepts '0' and '1'");
+            if (c == '1') blocks_[i / bits_per_block] |= block_type(1) << (i % bits_per_block);
+        }
+    }
+
+    dynamic_bitset(const dynamic_bitset& rhs) = default;
+
+    dynamic_bitset(dynamic_bitset&& rhs) noexcept
+        : blocks_(tinystl::move(rhs.blocks_)), size_(rhs.size_) {
+        rhs.size_ = 0;
+    }
+
+    dynamic_bitset& operator=(const dynamic_bitset& rhs) = default;
+
+    dynamic_bitset& operator=(dynamic_bitset&& rhs) noexcept {
+        if (this != &rhs) {
+            blocks_ = tinystl::move(rhs.blocks_);
+            size_ = rhs.size_;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+public:
+    // =========================  容量相关操作  ====================== //
+
+    bool      empty()      const noexcept { return size_ == 0; }
+    size_type size()       const noexcept { return size_; }
+    size_type num_blocks() const noexcept { return blocks_.size(); }
+    size_type capacity()   const noexcept { return blocks_.capacity() * bits_per_block; }
+    size_type max_size()   const noexcept {
+        return blocks_.max_size() > npos / bits_per_block ? npos - 1 : blocks_.max_size() * bits_per_block;
+    }
+
+    void reserve(size_type n) { blocks_.reserve(blocks_for(n)); }
+    void shrink_to_fit() { blocks_.shrink_to_fit(); }
+
+    // =========================  元素访问相关操作  ====================== //
+
+    reference operator[](size_type pos) {
+        TINYSTL_DEBUG(pos < size_);
+        return reference(&blocks_[pos / bits_per_block], pos % bits_per_block);
+    }
+
+    const_reference operator[](size_type pos) const {
+        TINYSTL_DEBUG(pos < size_);
+        return get(pos);
+    }
+
+    bool test(size_type pos) const {
+        THROW_OUT_OF_RANGE_IF(!(pos < size_), "dynamic_bitset<Alloc>::test() subscript out of range");
+        return get(pos);
+    }
+
+    const block_type* data() const noexcept { return blocks_.data(); }
+
+    // =========================  修改容器相关操作  ====================== //
+
+    void push_back(bool value) {
+        if (size_ % bits_per_block == 0) blocks_.push_back(0);
+        if (value) blocks_.back() |= block_type(1) << (size_ % bits_per_block);
+        ++size_;
+    }
+
+    void pop_back() {
+        TINYSTL_DEBUG(!empty());
+        --size_;
+        if (size_ % bits_per_block == 0) blocks_.pop_back();
+        else blocks_.back() &= ~(block_type(1) << (size_ % bits_per_block));
+    }
+
+    /// @brief 改变位数，新增的位置为 value
+    void resize(size_type n, bool value = false) {
+        const size_type old_size = size_;
+        blocks_.resize(blocks_for(n), value ? ~block_type(0) : block_type(0));
+        if (value && n > old_size && old_size % bits_per_block != 0) {
+            blocks_[old_size / bits_per_block] |= ~block_type(0) << (old_size % bits_per_block);
+        }
+        size_ = n;
+        trim();
+    }
+
+    void clear() noexcept {
+        blocks_.clear();
+        size_ = 0;
+    }
+
+    // set / reset / flip
+
+    dynamic_bitset& set() noexcept {
+        tinystl::fill(blocks_.begin(), blocks_.end(), ~block_type(0));
+        trim();
+        return *this;
+    }
+
+    dynamic_bitset& set(size_type pos, bool value = true) {
+        THROW_OUT_OF_RANGE_IF(!(pos < size_), "dynamic_bitset<Alloc>::set() subscript out of range");
+        (*this)[pos] = value;
+        return *this;
+    }
+
+    dynamic_bitset& reset() noexcept {
+        tinystl::fill(blocks_.begin(), blocks_.end(), block_type(0));
+        return *this;
+    }
+
+    dynamic_bitset& reset(size_type pos) { return set(pos, false); }
+
+    dynamic_bitset& flip() noexcept {
+        for (auto& b : blocks_) b = ~b;
+        trim();
+        return *this;
+    }
+
+    dynamic_bitset& flip(size_type pos) {
+        THROW_OUT_OF_RANGE_IF(!(pos < size_), "dynamic_bitset<Alloc>::flip() subscript out of range");
+        (*this)[pos].flip();
+        return *this;
+    }
+
+    // 逐字的集合运算，两个位集合的长度必须相同
+
+    dynamic_bitset& operator&=(const dynamic_bitset& rhs) noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) blocks_[i] &= rhs.blocks_[i];
+        return *this;
+    }
+
+    dynamic_bitset& operator|=(const dynamic_bitset& rhs) noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) blocks_[i] |= rhs.blocks_[i];
+        return *this;
+    }
+
+    dynamic_bitset& operator^=(const dynamic_bitset& rhs) noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) blocks_[i] ^= rhs.blocks_[i];
+        return *this;
+    }
+
+    // 差集：清除 rhs 中为 1 的位
+    dynamic_bitset& operator-=(const dynamic_bitset& rhs) noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) blocks_[i] &= ~rhs.blocks_[i];
+        return *this;
+    }
+
+    dynamic_bitset& operator<<=(size_type n) noexcept;
+    dynamic_bitset& operator>>=(size_type n) noexcept;
+
+    dynamic_bitset operator~() const {
+        dynamic_bitset tmp(*this);
+        tmp.flip();
+        return tmp;
+    }
+
+    dynamic_bitset operator<<(size_type n) const {
+        dynamic_bitset tmp(*this);
+        tmp <<= n;
+        return tmp;
+    }
+
+    dynamic_bitset operator>>(size_type n) const {
+        dynamic_bitset tmp(*this);
+        tmp >>= n;
+        return tmp;
+    }
+
+    void swap(dynamic_bitset& rhs) noexcept {
+        blocks_.swap(rhs.blocks_);
+        tinystl::swap(size_, rhs.size_);
+    }
+
+    // =========================  查询相关操作  ====================== //
+
+    size_type count() const noexcept {
+        size_type n = 0;
+        for (size_type i = 0; i < blocks_.size(); ++i) n += popcount64(blocks_[i]);
+        return n;
+    }
+
+    bool all() const noexcept;
+
+    bool any() const noexcept {
+        for (size_type i = 0; i < blocks_.size(); ++i) {
+            if (blocks_[i] != 0) return true;
+        }
+        return false;
+    }
+
+    bool none() const noexcept { return !any(); }
+
+    // 两个位集合是否有共同的 1
+    bool intersects(const dynamic_bitset& rhs) const noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) {
+            if ((blocks_[i] & rhs.blocks_[i]) != 0) return true;
+        }
+        return false;
+    }
+
+    // 为 1 的位是否都在 rhs 中为 1
+    bool is_subset_of(const dynamic_bitset& rhs) const noexcept {
+        TINYSTL_DEBUG(size_ == rhs.size_);
+        for (size_type i = 0; i < blocks_.size(); ++i) {
+            if ((blocks_[i] & ~rhs.blocks_[i]) != 0) return false;
+        }
+        return true;
+    }
+
+    /// @brief 返回第一个为 1 的位，若不存在则返回 npos
+    size_type find_first() const noexcept { return find_from_block(0); }
+
+    /// @brief 返回 pos 之后第一个为 1 的位，若不存在则返回 npos
+    size_type find_next(size_type pos) const noexcept;
+
+    /// @brief 返回 [0, pos) 中为 1 的位数，要求 pos <= size()
+    size_type rank(size_type pos) const noexcept;
+
+    /// @brief 返回第 k 个（从 0 开始）为 1 的位，若不存在则返回 npos
+    size_type select(size_type k) const noexcept;
+
+    std::string to_string() const;
+
+private:
+    // =========================  辅助函数  ====================== //
+
+    static size_type blocks_for(size_type n) noexcept {
+        return (n + bits_per_block - 1) / bits_per_block;
+    }
+
+    bool get(size_type pos) const noexcept {
+        return (blocks_[pos / bits_per_block] >> (pos % bits_per_block)) & 1;
+    }
+
+    // 清除最后一个字中超出 size_ 的位
+    void trim() noexcept {
+        const size_type extra = size_ % bits_per_block;
+        if (extra != 0) blocks_.back() &= (block_type(1) << extra) - 1;
+    }
+
+    size_type find_from_block(size_type i) const noexcept {
+        for (; i < blocks_.size(); ++i) {
+            if (blocks_[i] != 0) return i * bits_per_block + ctz64(blocks_[i]);
+        }
+        return npos;
+    }
+
+    template <class A>
+    friend bool operator==(const dynamic_bitset<A>& lhs, const dynamic_bitset<A>& rhs);
+
+};  // class dynamic_bitset
+
+template <class Alloc>
+constexpr typename dynamic_bitset<Alloc>::size_type dynamic_bitset<Alloc>::bits_per_block;
+
+template <class Alloc>
+constexpr typename dynamic_bitset<Alloc>::size_type dynamic_bitset<Alloc>::npos;
+
+// =========================  函数实现  ====================== //
+
+/// @brief 所有位向高位移动 n 位，低位补 0，与 std::bitset 相同
+template <class Alloc>
+dynamic_bitset<Alloc>& dynamic_bitset<Alloc>::operator<<=(size_type n) noexcept {
+    if (n >= size_) return reset();
+    const size_type shift = n / bits_per_block;
+    const size_type offset = n % bits_per_block;
+    const size_type last = blocks_.size() - 1;
+    if (offset == 0) {
+        for (size_type i = last; i > shift; --i) {
+            blocks_[i] = blocks_[i - shift];
+        }
+        blocks_[shift] = blocks_[0];
+    }
+    else {
+        for (size_type i = last; i > shift; --i) {
+            blocks_[i] = (blocks_[i - shift] << offset) | (blocks_[i - shift - 1] >> (bits_per_block - offset));
+        }
+        blocks_[shift] = blocks_[0] << offset;
+    }
+    tinystl::fill(blocks_.begin(), blocks_.begin() + shift, block_type(0));
+    trim();
+    return *this;
+}
+
+/// @brief 所有位向低位移动 n 位，高位补 0
+template <class Alloc>
+dynamic_bitset<Alloc>& dynamic_bitset<Alloc>::operator>>=(size_type n) noexcept {
+    if (n >= size_) return reset();
+    const size_type shift = n / bits_per_block;
+    const size_type offset = n % bits_per_block;
+    const size_type last = blocks_.size() - 1 - shift;  // 移动后最后一个非零字
+    if (offset == 0) {
+        for (size_type i = 0; i <= last; ++i) {
+            blocks_[i] = blocks_[i + shift];
+        }
+    }
+    else {
+        for (size_type i = 0; i < last; ++i) {
+            blocks_[i] = (blocks_[i + shift] >> offset) | (blocks_[i + shift + 1] << (bits_per_block - offset));
+        }
+        blocks_[last] = blocks_[last + shift] >> offset;
+    }
+    tinystl::fill(blocks_.begin() + last + 1, blocks_.end(), block_type(0));
+    return *this;
+}
+
+template <class Alloc>
+bool dynamic_bitset<Alloc>::all() const noexcept {
+    const size_type full = size_ / bits_per_block;
+    for (size_type i = 0; i < full; ++i) {
+        if (blocks_[i] != ~block_type(0)) return false;
+    }
+    const size_type extra = size_ % bits_per_block;
+    return extra == 0 || blocks_[full] == (block_type(1) << extra) - 1;
+}
+
+template <class Alloc>
+typename dynamic_bitset<Alloc>::size_type
+dynamic_bitset<Alloc>::find_next(size_type pos) const noexcept {
+    if (pos == npos || ++pos >= size_) return npos;
+    const size_type i = pos / bits_per_block;
+    const block_type rest = blocks_[i] & (~block_type(0) << (pos % bits_per_block));
+    if (rest != 0) return i * bits_per_block + ctz64(rest);
+    return find_from_block(i + 1);
+}
+
+template <class Alloc>
+typename dynamic_bitset<Alloc>::size_type
+dynamic_bitset<Alloc>::rank(size_type pos) const noexcept {
+    TINYSTL_DEBUG(pos <= size_);
+    const size_type full = pos / bits_per_block;
+    size_type n = 0;
+    for (size_type i = 0; i < full; ++i) n += popcount64(blocks_[i]);
+    const size_type extra = pos % bits_per_block;
+    if (extra != 0) n += popcount64(blocks_[full] & ((block_type(1) << extra) - 1));
+    return n;
+}
+
+template <class Alloc>
+typename dynamic_bitset<Alloc>::size_type
+dynamic_bitset<Alloc>::select(size_type k) const noexcept {
+    for (size_type i = 0; i < blocks_.size(); ++i) {
+        const size_type c = popcount64(blocks_[i]);
+        if (k < c) return i * bits_per_block + select64(blocks_[i], k);
+        k -= c;
+    }
+    return npos;
+}
+
+template <class Alloc>
+std::string dynamic_bitset<Alloc>::to_string() const {
+    std::string str(size_, '0');
+    for (size_type i = find_first(); i != npos; i = find_next(i)) {
+        str[size_ - 1 - i] = '1';
+    }
+    return str;
+}
+
+// =========================  重载操作符  ====================== //
+
+template <class Alloc>
+bool operator==(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    return lhs.size_ == rhs.size_ && lhs.blocks_ == rhs.blocks_;
+}
+
+template <class Alloc>
+bool operator!=(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class Alloc>
+dynamic_bitset<Alloc> operator&(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    dynamic_bitset<Alloc> tmp(lhs);
+    tmp &= rhs;
+    return tmp;
+}
+
+template <class Alloc>
+dynamic_bitset<Alloc> operator|(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    dynamic_bitset<Alloc> tmp(lhs);
+    tmp |= rhs;
+    return tmp;
+}
+
+template <class Alloc>
+dynamic_bitset<Alloc> operator^(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    dynamic_bitset<Alloc> tmp(lhs);
+    tmp ^= rhs;
+    return tmp;
+}
+
+template <class Alloc>
+dynamic_bitset<Alloc> operator-(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+    dynamic_bitset<Alloc> tmp(lhs);
+    tmp -= rhs;
+    return tmp;
+}
+
+// 重载 tinystl 的 swap
+template <class Alloc>
+void swap(dynamic_bitset<Alloc>& lhs, dynamic_bitset<Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// ==================================== bitset_rank_index ==================================== //
+
+/// @brief 模板类 bitset_rank_index，rank 为常数时间，select 为 O(log(n / 512))
+/// @tparam Alloc  位集合与索引使用的空间配置器
+template <class Alloc = alloc>
+class bitset_rank_index {
+
+public:  // 嵌套型别定义
+    typedef dynamic_bitset<Alloc>                   bitset_type;
+    typedef typename bitset_type::block_type        block_type;
+    typedef typename bitset_type::size_type         size_type;
+
+    static constexpr size_type blocks_per_super = 8;  // 每个超块包含的字数，即 512 位
+    static constexpr size_type npos = bitset_type::npos;
+
+private:
+    const bitset_type*                bits_;   // 建立索引的位集合
+    tinystl::vector<size_type, Alloc> super_;  // super_[j] 为前 j 个超块中 1 的个数，末尾为总数
+
+public:  // 构造函数
+    bitset_rank_index() : bits_(nullptr), super_() {}
+
+    explicit bitset_rank_index(const bitset_type& bits) : bits_(nullptr), super_() {
+        assign(bits);
+    }
+
+    void assign(const bitset_type& bits);
+
+public:  // 查询相关操作
+
+    /// @brief 返回 [0, pos) 中为 1 的位数，要求 pos <= size()
+    size_type rank(size_type pos) const noexcept;
+
+    /// @brief 返回第 k 个（从 0 开始）为 1 的位，若不存在则返回 npos
+    size_type select(size_type k) const noexcept;
+
+    size_type count() const noexcept { return super_.empty() ? 0 : super_.back(); }
+    size_type size()  const noexcept { return bits_ == nullptr ? 0 : bits_->size(); }
+
+    void swap(bitset_rank_index& rhs) noexcept {
+        tinystl::swap(bits_, rhs.bits_);
+        super_.swap(rhs.super_);
+    }
+};
+
+template <class Alloc>
+constexpr typename bitset_rank_index<Alloc>::size_type bitset_rank_index<Alloc>::blocks_per_super;
+
+template <class Alloc>
+constexpr typename bitset_rank_index<Alloc>::size_type bitset_rank_index<Alloc>::npos;
+
+template <class Alloc>
+void bitset_rank_index<Alloc>::assign(const bitset_type& bits) {
+    bits_ = &bits;
+    const block_type* blocks = bits.data();
+    const size_type nblocks = bits.num_blocks();
+    super_.clear();
+    super_.reserve(nblocks / blocks_per_super + 2);
+    size_type n = 0;
+    for (size_type i = 0; i < nblocks; ++i) {
+        if (i % blocks_per_super == 0) super_.push_back(n);
+        n += popcount64(blocks[i]);
+    }
+    super_.push_back(n);
+}
+
+template <class Alloc>
+typename bitset_rank_index<Alloc>::size_type
+bitset_rank_index<Alloc>::rank(size_type pos) const noexcept {
+    TINYSTL_DEBUG(pos <= size());
+    const block_type* blocks = bits_->data();
+    const size_type full = pos / bitset_type::bits_per_block;
+    const size_type s = full / blocks_per_super;
+    size_type n = super_[s];
+    for (size_type i = s * blocks_per_super; i < full; ++i) n += popcount64(blocks[i]);
+    const size_type extra = pos % bitset_type::bits_per_block;
+    if (extra != 0) n += popcount64(blocks[full] & ((block_type(1) << extra) - 1));
+    return n;
+}
+
+template <class Alloc>
+typename bitset_rank_index<Alloc>::size_type
+bitset_rank_index<Alloc>::select(size_type k) const noexcept {
+    if (k >= count()) return npos;
+    // 找到最后一个前缀计数不超过 k 的超块
+    const size_type s = static_cast<size_type>(
+        tinystl::upper_bound(super_.begin(), super_.end(), k) - super_.begin()) - 1;
+    const block_type* blocks = bits_->data();
+    k -= super_[s];
+    for (size_type i = s * blocks_per_super; ; ++i) {
+        const size_type c = popcount64(blocks[i]);
+        if (k < c) return i * bitset_type::bits_per_block + select64(blocks[i], k);
+        k -= c;
+    }
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_DYNAMIC_BITSET_H_
@@ -0,0 +1,220 @@
+#ifndef TINYSTL_EYTZINGER_H_
+#define TINYSTL_EYTZINGER_H_
+
+// 这个头文件包含一个模板类 eytzinger_index
+// eytzinger_index : 为有序序列建立的静态查找索引，元素按 Eytzinger (BFS) 顺序存放
+
+// notes:
+//
+// 对有序数组做经典二分查找时，前几层的访问点分散在整个数组中，数据超过 L2 后几乎每一层都会缺页。
+// Eytzinger 布局把隐式二叉查找树按层序存放：下标 k 的左右孩子为 2k 和 2k + 1（下标从 1 开始），
+//   * 靠近根的若干层集中在数组头部，常驻缓存
+//   * 节点 k 往下第 4 层的 16 个后代 [16k, 16k + 16) 是连续的，可以提前预取
+//   * 每一层只需计算 k = 2k + (a[k] < key)，没有难以预测的分支
+//
+// 查找结果以原有序序列中的下标（秩）表示，与 lower_bound / upper_bound 的语义一致。
+// 节点的秩由其编号直接算出，不需要额外的存储和访存。索引建立后只读，不支持插入删除。
+
+#include <cstdint>
+
+#include "algobase.h"
+#include "functional.h"
+#include "vector.h"
+#include "util.h"
+
+namespace tinystl {
+
+/// @brief 模板类 eytzinger_index
+/// @tparam T  元素类型
+/// @tparam Compare  元素比较准则，建立索引的序列必须按 Compare 有序
+template <class T, class Compare = tinystl::less<T>, class Alloc = alloc>
+class eytzinger_index {
+
+public:  // 嵌套型别定义
+    typedef T                                   value_type;
+    typedef Compare                             value_compare;
+    typedef const T&                            const_reference;
+    typedef size_t                              size_type;
+    typedef ptrdiff_t                           difference_type;
+
+private:
+    // 每次预取的跨度：一个 64 字节缓存行大约能放下多少个元素，即向下若干层的全部后代
+    static constexpr size_type prefetch_stride = sizeof(T) >= 64 ? 1 : 64 / sizeof(T);
+
+    tinystl::vector<T, Alloc> data_;    // data_[1..n] 按 Eytzinger 顺序存放元素，data_[0] 不使用
+    size_type                 size_;    // 元素个数 n
+    size_type                 height_;  // 最底层的深度 H，根的深度为 0
+    size_type                 leaves_;  // 最底层的节点个数
+    value_compare             comp_;
+
+public:  // 构造函数
+    eytzinger_index() : data_(), size_(0), height_(0), leaves_(0), comp_() {}
+
+    /// @brief 由有序区间 [first, last) 建立索引
+    template <class RandomIter>
+    eytzinger_index(RandomIter first, RandomIter last, const value_compare& comp = value_compare())
+        : data_(), size_(0), height_(0), leaves_(0), comp_(comp) {
+        assign(first, last);
+    }
+
+    template <class RandomIter>
+    void assign(RandomIter first, RandomIter last);
+
+public:  // 容量相关操作
+    bool      empty() const noexcept { return size_ == 0; }
+    size_type size()  const noexcept { return size_; }
+
+    value_compare value_comp() const { return comp_; }
+
+public:  // 查找相关操作
+
+    /// @brief 返回第一个不小于 value 的元素在原序列中的下标，若不存在则返回 size()
+    size_type lower_bound(const T& value) const {
+        return to_rank(lower_bound_node(value));
+    }
+
+    /// @brief 返回第一个大于 value 的元素在原序列中的下标，若不存在则返回 size()
+    size_type upper_bound(const T& value) const {
+        return to_rank(upper_bound_node(value));
+    }
+
+    /// @brief 返回与 value 等价的元素在原序列中的下标区间 [first, second)
+    tinystl::pair<size_type, size_type> equal_range(const T& value) const {
+        return tinystl::make_pair(lower_bound(value), upper_bound(value));
+    }
+
+    /// @brief 判断是否存在与 value 等价的元素
+    bool binary_search(const T& value) const {
+        const size_type k = lower_bound_node(value);
+        return k != 0 && !comp_(value, data_[k]);
+    }
+
+    /// @brief 返回指向第一个不小于 value 的元素的指针，若不存在则返回 nullptr
+    const T* find_lower(const T& value) const {
+        const size_type k = lower_bound_node(value);
+        return k == 0 ? nullptr : data_.data() + k;
+    }
+
+    void swap(eytzinger_index& rhs) noexcept {
+        data_.swap(rhs.data_);
+        tinystl::swap(size_, rhs.size_);
+        tinystl::swap(height_, rhs.height_);
+        tinystl::swap(leaves_, rhs.leaves_);
+        tinystl::swap(comp_, rhs.comp_);
+    }
+
+private:  // 辅助函数
+    template <class RandomIter>
+    void build(RandomIter first, size_type& i, size_type k);
+
+    size_type lower_bound_node(const T& value) const;
+    size_type upper_bound_node(const T& value) const;
+
+    size_type to_rank(size_type k) const;
+
+    static size_type log2_floor(size_type x) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - static_cast<size_type>(__builtin_clzll(static_cast<unsigned long long>(x)));
+#else
+        size_type r = 0;
+        while (x >>= 1) ++r;
+        return r;
+#endif
+    }
+
+    // 预取节点 k 往下若干层的后代。它们可能远在数组末尾之外，指针运算越界是未定义行为，
+    // 所以经由 uintptr_t 计算地址；预取本身不会引发访存错误
+    void prefetch_descendants(size_type k) const noexcept {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(data_.data());
+        TINYSTL_PREFETCH(reinterpret_cast<const void*>(base + k * prefetch_stride * sizeof(T)));
+    }
+
+    // 下降结束时 k 的二进制表示为 “答案节点 + 1 + 若干个 1”，去掉末尾连续的 1 和其前面的 0 即得答案
+    static size_type strip(size_type k) {
+#if defined(__GNUC__) || defined(__clang__)
+        return k >> (__builtin_ctzll(static_cast<unsigned long long>(~k)) + 1);
+#else
+        while (k & 1) k >>= 1;
+        return k >> 1;
+#endif
+    }
+};
+
+// ============================================ 函数实现 ================================================ //
+
+/// @brief 由有序区间 [first, last) 重新建立索引
+template <class T, class Compare, class Alloc>
+template <class RandomIter>
+void eytzinger_index<T, Compare, Alloc>::assign(RandomIter first, RandomIter last) {
+    size_ = static_cast<size_type>(last - first);
+    if (size_ == 0) {
+        data_.clear();
+        height_ = leaves_ = 0;
+        return;
+    }
+    height_ = log2_floor(size_);
+    leaves_ = size_ - ((size_type(1) << height_) - 1);
+    data_.assign(size_ + 1, *first);
+    size_type i = 0;
+    build(first, i, 1);
+}
+
+/// @brief 按中序遍历隐式二叉树，依次将有序序列的第 i 个元素放入节点 k
+template <class T, class Compare, class Alloc>
+template <class RandomIter>
+void eytzinger_index<T, Compare, Alloc>::build(RandomIter first, size_type& i, size_type k) {
+    if (k > size_) return;
+    build(first, i, 2 * k);
+    data_[k] = *(first + i++);
+    build(first, i, 2 * k + 1);
+}
+
+/// @brief 无分支下降，返回第一个不小于 value 的节点编号，若不存在则返回 0
+template <class T, class Compare, class Alloc>
+typename eytzinger_index<T, Compare, Alloc>::size_type
+eytzinger_index<T, Compare, Alloc>::lower_bound_node(const T& value) const {
+    const T* a = data_.data();
+    size_type k = 1;
+    while (k <= size_) {
+        prefetch_descendants(k);
+        k = 2 * k + static_cast<size_type>(comp_(a[k], value));
+    }
+    return strip(k);
+}
+
+/// @brief 无分支下降，返回第一个大于 value 的节点编号，若不存在则返回 0
+template <class T, class Compare, class Alloc>
+typename eytzinger_index<T, Compare, Alloc>::size_type
+eytzinger_index<T, Compare, Alloc>::upper_bound_node(const T& value) const {
+    const T* a = data_.data();
+    size_type k = 1;
+    while (k <= size_) {
+        prefetch_descendants(k);
+        k = 2 * k + static_cast<size_type>(!comp_(value, a[k]));
+    }
+    return strip(k);
+}
+
+/// @brief 计算节点 k 在原有序序列中的下标，k 为 0 时返回 size()
+//  先把树补成深度为 H 的满二叉树：深度 d、层内偏移 o 的节点中序位置为 (2o + 1) * 2^(H - d) - 1，
+//  最底层的叶子位于偶数位置，再减去排在它前面的、实际不存在的叶子个数
+template <class T, class Compare, class Alloc>
+typename eytzinger_index<T, Compare, Alloc>::size_type
+eytzinger_index<T, Compare, Alloc>::to_rank(size_type k) const {
+    if (k == 0) return size_;
+    const size_type d = log2_floor(k);
+    const size_type o = k - (size_type(1) << d);
+    const size_type p = ((2 * o + 1) << (height_ - d)) - 1;
+    const size_type before = (p + 1) >> 1;  // 满二叉树中排在 p 之前的叶子个数
+    return before > leaves_ ? p - (before - leaves_) : p;
+}
+
+// 重载 swap
+template <class T, class Compare, class Alloc>
+void swap(eytzinger_index<T, Compare, Alloc>& lhs, eytzinger_index<T, Compare, Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_EYTZINGER_H_
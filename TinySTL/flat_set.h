@@ -0,0 +1,415 @@
+#ifndef TINYSTL_FLAT_SET_H
+#define TINYSTL_FLAT_SET_H
+
+// 这个头文件包含两个模板类 flat_set 和 flat_multiset
+// flat_set      : 以有序 vector 实现的集合，键值即实值，键值不允许重复
+// flat_multiset : 以有序 vector 实现的集合，键值即实值，键值允许重复
+
+// notes:
+//
+// 与 set / multiset 的接口基本一致，区别在于：
+//   * 元素连续存放，查找更加缓存友好，但单个元素的插入删除为 O(n)
+//   * 插入或删除元素会使所有迭代器失效
+//   * 额外提供 reserve / capacity / shrink_to_fit
+//   * 范围插入 insert(first, last) 采用 追加 + sort + inplace_merge 的批量方式
+
+#include "flat_tree.h"
+
+namespace tinystl {
+
+// ========================================== flat_set ========================================== //
+
+/// @brief 模板类 flat_set，键值不允许重复
+/// @tparam Key  键值类型
+/// @tparam Compare  键值比较方式，缺省使用 tinystl::less
+template <class Key, class Compare = tinystl::less<Key>>
+class flat_set {
+
+public:  // flat_set 的型别定义
+    typedef Key            key_type;
+    typedef Key            value_type;
+    typedef Compare        key_compare;
+    typedef Compare        value_compare;
+
+private:  // 内部型别定义
+    // 以 tinystl::flat_tree 作为底层机制
+    typedef tinystl::flat_tree<value_type, key_compare> base_type;
+    base_type tree_;  // 底层有序 vector
+
+public:  // 使用 flat_tree 定义的型别
+    // 不允许通过迭代器来更改 flat_set 的键值，因此下述全部使用 const 
+    typedef typename base_type::const_pointer          pointer; 
+    typedef typename base_type::const_pointer          const_pointer;
+    typedef typename base_type::const_reference        reference;
+    typedef typename base_type::const_reference        const_reference;
+    typedef typename base_type::const_iterator         iterator;
+    typedef typename base_type::const_iterator         const_iterator;
+    typedef typename base_type::const_reverse_iterator reverse_iterator;
+    typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+    typedef typename base_type::size_type              size_type;
+    typedef typename base_type::difference_type        difference_type;
+    typedef typename base_type::allocator_type         allocator_type;
+
+public:  // 构造、复制、移动函数
+    flat_set() = default;
+
+    template <class InputIterator>
+    flat_set(InputIterator first, InputIterator last) : tree_() {
+        tree_.insert_unique(first, last);
+    }
+
+    flat_set(std::initializer_list<value_type> ilist) : tree_() {
+        tree_.insert_unique(ilist.begin(), ilist.end());
+    }
+
+    flat_set(const flat_set& rhs) : tree_(rhs.tree_) {}
+
+    flat_set(flat_set&& rhs) noexcept : tree_(tinystl::move(rhs.tree_)) {}
+
+    flat_set& operator=(const flat_set& rhs) {
+        tree_ = rhs.tree_;
+        return *this;
+    }
+
+    flat_set& operator=(flat_set&& rhs) noexcept {
+        tree_ = tinystl::move(rhs.tree_);
+        return *this;
+    }
+
+    flat_set& operator=(std::initializer_list<value_type> ilist) {
+        tree_.clear();
+        tree_.insert_unique(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+public:  // 相关接口
+    key_compare   key_comp()       const { return tree_.key_comp(); }
+    value_compare value_comp()     const { return tree_.key_comp(); }
+    allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+public:  // 迭代器相关操作
+    iterator               begin()         noexcept { return tree_.cbegin(); }
+    const_iterator         begin()   const noexcept { return tree_.begin(); }
+    iterator               end()           noexcept { return tree_.cend(); }
+    const_iterator         end()     const noexcept { return tree_.end(); }
+    reverse_iterator       rbegin()        noexcept { return tree_.crbegin(); }
+    const_reverse_iterator rbegin()  const noexcept { return tree_.crbegin(); }
+    reverse_iterator       rend()          noexcept { return tree_.crend(); }
+    const_reverse_iterator rend()    const noexcept { return tree_.crend(); }
+
+    const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+    const_iterator         cend()    const noexcept { return tree_.cend(); }
+    const_reverse_iterator crbegin() const noexcept { return tree_.crbegin(); }
+    const_reverse_iterator crend()   const noexcept { return tree_.crend(); }
+
+public:  // 容量相关
+    bool                   empty()    const noexcept { return tree_.empty(); }
+    size_type              size()     const noexcept { return tree_.size(); }
+    size_type              max_size() const noexcept { return tree_.max_size(); }
+    size_type              capacity() const noexcept { return tree_.capacity(); }
+
+    void                   reserve(size_type n)      { tree_.reserve(n); }
+    void                   shrink_to_fit()           { tree_.shrink_to_fit(); }
+
+public:  // 插入删除相关
+    template <class ...Args>
+    pair<iterator, bool> emplace(Args&& ...args) {
+        return tree_.emplace_unique(tinystl::forward<Args>(args)...);
+    }
+
+    template <class ...Args>
+    iterator emplace_hint(const_iterator hint, Args&& ...args) {
+        return tree_.emplace_unique_use_hint(hint, tinystl::forward<Args>(args)...);
+    }
+
+    pair<iterator, bool> insert(const value_type& value) {
+        return tree_.insert_unique(value);
+    }
+
+    pair<iterator, bool> insert(value_type&& value) {
+        return tree_.insert_unique(tinystl::move(value));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value) {
+        return tree_.insert_unique(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value) {
+        return tree_.insert_unique(hint, tinystl::move(value));
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        tree_.insert_unique(first, last);
+    }
+
+    iterator  erase(const_iterator pos)                        { return tree_.erase(pos); }
+    size_type erase(const key_type& key)                       { return tree_.erase_unique(key); }
+    iterator  erase(const_iterator first, const_iterator last) { return tree_.erase(first, last); }
+
+    void      clear() { tree_.clear(); }
+
+public:  // flat_set 相关操作
+    iterator       find(const key_type& key)              { return tree_.find(key); }
+    const_iterator find(const key_type& key)        const { return tree_.find(key); }
+
+    size_type      count(const key_type& key)       const { return tree_.count_unique(key); }
+
+    iterator       lower_bound(const key_type& key)       { return tree_.lower_bound(key); }
+    const_iterator lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+
+    iterator       upper_bound(const key_type& key)       { return tree_.upper_bound(key); }
+    const_iterator upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+    pair<iterator, iterator> equal_range(const key_type& key) {
+        return tree_.equal_range_unique(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return tree_.equal_range_unique(key);
+    }
+
+    void swap(flat_set& rhs) noexcept { tree_.swap(rhs.tree_); }
+
+public:
+    friend bool operator==(const flat_set& lhs, const flat_set& rhs) { return lhs.tree_ == rhs.tree_; }
+    friend bool operator< (const flat_set& lhs, const flat_set& rhs) { return lhs.tree_ <  rhs.tree_; }
+};
+
+// 重载比较操作符
+template <class Key, class Compare>
+bool operator==(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return lhs == rhs;
+}
+
+template <class Key, class Compare>
+bool operator<(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return lhs < rhs;
+}
+
+template <class Key, class Compare>
+bool operator!=(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class Key, class Compare>
+bool operator>(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return rhs < lhs;
+}
+
+template <class Key, class Compare>
+bool operator<=(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class Key, class Compare>
+bool operator>=(const flat_set<Key, Compare>& lhs, const flat_set<Key, Compare>& rhs) {
+    return !(lhs < rhs);
+}
+
+// 重载 swap
+template <class Key, class Compare>
+void swap(flat_set<Key, Compare>& lhs, flat_set<Key, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+// ======================================== flat_multiset ======================================== //
+
+/// @brief 模板类 flat_multiset，键值允许重复
+/// @tparam Key  键值类型
+/// @tparam Compare  键值比较方式，缺省使用 tinystl::less
+template <class Key, class Compare = tinystl::less<Key>>
+class flat_multiset {
+
+public:  // flat_multiset 的型别定义
+    typedef Key            key_type;
+    typedef Key            value_type;
+    typedef Compare        key_compare;
+    typedef Compare        value_compare;
+
+private:  // 内部型别定义
+    // 以 tinystl::flat_tree 作为底层机制
+    typedef tinystl::flat_tree<value_type, key_compare> base_type;
+    base_type tree_;  // 底层有序 vector
+
+public:  // 使用 flat_tree 定义的型别
+    // 不允许通过迭代器来更改 flat_multiset 的键值，因此下述全部使用 const 
+    typedef typename base_type::const_pointer          pointer; 
+    typedef typename base_type::const_pointer          const_pointer;
+    typedef typename base_type::const_reference        reference;
+    typedef typename base_type::const_reference        const_reference;
+    typedef typename base_type::const_iterator         iterator;
+    typedef typename base_type::const_iterator         const_iterator;
+    typedef typename base_type::const_reverse_iterator reverse_iterator;
+    typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+    typedef typename base_type::size_type              size_type;
+    typedef typename base_type::difference_type        difference_type;
+    typedef typename base_type::allocator_type         allocator_type;
+
+public:  // 构造、复制、移动函数
+    flat_multiset() = default;
+
+    template <class InputIterator>
+    flat_multiset(InputIterator first, InputIterator last) : tree_() {
+        tree_.insert_multi(first, last);
+    }
+
+    flat_multiset(std::initializer_list<value_type> ilist) : tree_() {
+        tree_.insert_multi(ilist.begin(), ilist.end());
+    }
+
+    flat_multiset(const flat_multiset& rhs) : tree_(rhs.tree_) {}
+
+    flat_multiset(flat_multiset&& rhs) noexcept : tree_(tinystl::move(rhs.tree_)) {}
+
+    flat_multiset& operator=(const flat_multiset& rhs) {
+        tree_ = rhs.tree_;
+        return *this;
+    }
+
+    flat_multiset& operator=(flat_multiset&& rhs) noexcept {
+        tree_ = tinystl::move(rhs.tree_);
+        return *this;
+    }
+
+    flat_multiset& operator=(std::initializer_list<value_type> ilist) {
+        tree_.clear();
+        tree_.insert_multi(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+public:  // 相关接口
+    key_compare   key_comp()       const { return tree_.key_comp(); }
+    value_compare value_comp()     const { return tree_.key_comp(); }
+    allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+public:  // 迭代器相关
+    iterator               begin()         noexcept { return tree_.cbegin(); }
+    const_iterator         begin()   const noexcept { return tree_.begin(); }
+    iterator               end()           noexcept { return tree_.cend(); }
+    const_iterator         end()     const noexcept { return tree_.end(); }
+    reverse_iterator       rbegin()        noexcept { return tree_.crbegin(); }
+    const_reverse_iterator rbegin()  const noexcept { return tree_.crbegin(); }
+    reverse_iterator       rend()          noexcept { return tree_.crend(); }
+    const_reverse_iterator rend()    const noexcept { return tree_.crend(); }
+
+    const_iterator         cbegin()  const noexcept { return tree_.cbegin(); }
+    const_iterator         cend()    const noexcept { return tree_.cend(); }
+    const_reverse_iterator crbegin() const noexcept { return tree_.crbegin(); }
+    const_reverse_iterator crend()   const noexcept { return tree_.crend(); }
+
+public:  // 容量相关
+    bool                   empty()    const noexcept { return tree_.empty(); }
+    size_type              size()     const noexcept { return tree_.size(); }
+    size_type              max_size() const noexcept { return tree_.max_size(); }
+    size_type              capacity() const noexcept { return tree_.capacity(); }
+
+    void                   reserve(size_type n)      { tree_.reserve(n); }
+    void                   shrink_to_fit()           { tree_.shrink_to_fit(); }
+
+public:  // 插入删除相关
+    template <class ...Args>
+    iterator emplace(Args&& ...args) {
+        return tree_.emplace_multi(tinystl::forward<Args>(args)...);
+    }
+
+    template <class ...Args>
+    iterator emplace_hint(const_iterator hint, Args&& ...args) {
+        return tree_.emplace_multi_use_hint(hint, tinystl::forward<Args>(args)...);
+    }
+
+    iterator insert(const value_type& value) {
+        return tree_.insert_multi(value);
+    }
+
+    iterator insert(value_type&& value) {
+        return tree_.insert_multi(tinystl::move(value));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value) {
+        return tree_.insert_multi(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value) {
+        return tree_.insert_multi(hint, tinystl::move(value));
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last) {
+        tree_.insert_multi(first, last);
+    }
+
+    iterator  erase(const_iterator pos)                        { return tree_.erase(pos); }
+    size_type erase(const key_type& key)                       { return tree_.erase_multi(key); }
+    iterator  erase(const_iterator first, const_iterator last) { return tree_.erase(first, last); }
+
+    void      clear() { tree_.clear(); }
+
+public:  // flat_multiset 相关操作
+    iterator       find(const key_type& key)              { return tree_.find(key); }
+    const_iterator find(const key_type& key)        const { return tree_.find(key); }
+
+    size_type      count(const key_type& key)       const { return tree_.count_multi(key); }
+
+    iterator       lower_bound(const key_type& key)       { return tree_.lower_bound(key); }
+    const_iterator lower_bound(const key_type& key) const { return tree_.lower_bound(key); }
+
+    iterator       upper_bound(const key_type& key)       { return tree_.upper_bound(key); }
+    const_iterator upper_bound(const key_type& key) const { return tree_.upper_bound(key); }
+
+    pair<iterator, iterator> equal_range(const key_type& key) {
+        return tree_.equal_range_multi(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return tree_.equal_range_multi(key);
+    }
+
+    void swap(flat_multiset& rhs) noexcept { tree_.swap(rhs.tree_); }
+
+public:
+    friend bool operator==(const flat_multiset& lhs, const flat_multiset& rhs) { return lhs.tree_ == rhs.tree_; }
+    friend bool operator< (const flat_multiset& lhs, const flat_multiset& rhs) { return lhs.tree_ <  rhs.tree_; }
+};
+
+// 重载比较操作符
+template <class Key, class Compare>
+bool operator==(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return lhs == rhs;
+}
+
+template <class Key, class Compare>
+bool operator<(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return lhs < rhs;
+}
+
+template <class Key, class Compare>
+bool operator!=(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class Key, class Compare>
+bool operator>(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return rhs < lhs;
+}
+
+template <class Key, class Compare>
+bool operator<=(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class Key, class Compare>
+bool operator>=(const flat_multiset<Key, Compare>& lhs, const flat_multiset<Key, Compare>& rhs) {
+    return !(lhs < rhs);
+}
+
+// 重载 swap
+template <class Key, class Compare>
+void swap(flat_multiset<Key, Compare>& lhs, flat_multiset<Key, Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+ 
+#endif  // TINYSTL_FLAT_SET_H
\ No newline at end of file
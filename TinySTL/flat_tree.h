@@ -0,0 +1,507 @@
+#ifndef TINYSTL_FLAT_TREE_H_
+#define TINYSTL_FLAT_TREE_H_
+
+// 这个头文件包含一个模板类 flat_tree
+// flat_tree : 以有序 vector 实现的关联式容器底层机制，为 flat_set / flat_map 提供支持
+
+// notes:
+//
+// 与 rb_tree 相比，flat_tree 将所有元素连续地存放在一个 tinystl::vector 中：
+//   * 查找通过 tinystl::lower_bound / upper_bound 的 random_access 版本完成，访存连续
+//   * 每个元素没有额外的节点开销，适合构建一次、查询多次的场景
+//   * 单个元素的插入删除为 O(n)，批量插入采用 追加 + sort + inplace_merge (+ unique) 的方式，
+//     总代价为 O(n + m log m)
+//
+// 插入或删除元素会使所有迭代器失效
+
+#include <initializer_list>
+
+#include "algo.h"
+#include "functional.h"
+#include "vector.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+// =====================================  flat_tree value traits ===================================== //
+
+template <class T, bool>
+struct flat_tree_value_traits_imp {
+    typedef T key_type;
+    typedef T mapped_type;
+    typedef T value_type;
+
+    template <class Ty>
+    static const key_type& get_key(const Ty& value) {
+        return value;
+    }
+
+    template <class Ty>
+    static const value_type& get_value(const Ty& value) {
+        return value;
+    }
+};
+
+template <class T>
+struct flat_tree_value_traits_imp<T, true> {
+    typedef typename std::remove_cv<typename T::first_type>::type  key_type;
+    typedef typename T::second_type                                mapped_type;
+    typedef T                                                      value_type;
+
+    template <class Ty>
+    static const key_type& get_key(const Ty& value) {
+        return value.first;
+    }
+
+    template <class Ty>
+    static const value_type& get_value(const Ty& value) {
+        return value;
+    }
+};
+
+template <class T>
+struct flat_tree_value_traits {
+    static constexpr bool is_map = tinystl::is_pair<T>::value;
+
+    typedef flat_tree_value_traits_imp<T, is_map>   value_traits_type;
+    typedef typename value_traits_type::key_type    key_type;
+    typedef typename value_traits_type::mapped_type mapped_type;
+    typedef typename value_traits_type::value_type  value_type;
+
+    template <class Ty>
+    static const key_type& get_key(const Ty& value) {
+        return value_traits_type::get_key(value);
+    }
+
+    template <class Ty>
+    static const value_type& get_value(const Ty& value) {
+        return value_traits_type::get_value(value);
+    }
+};
+
+// ========================================== flat_tree ========================================== //
+
+/// @brief 模板类 flat_tree
+/// @tparam T  元素的值类型
+/// @tparam Compare  键值比较准则
+template <class T, class Compare, class Alloc = alloc>
+class flat_tree {
+
+public:  // flat_tree 的嵌套型别定义
+    typedef flat_tree_value_traits<T>                       value_traits;
+    typedef tinystl::vector<T, Alloc>                       container_type;
+
+    typedef typename value_traits::key_type                 key_type;
+    typedef typename value_traits::mapped_type              mapped_type;
+    typedef typename value_traits::value_type               value_type;
+    typedef Compare                                         key_compare;
+
+    typedef typename container_type::allocator_type         allocator_type;
+    typedef typename container_type::pointer                pointer;
+    typedef typename container_type::const_pointer          const_pointer;
+    typedef typename container_type::reference              reference;
+    typedef typename container_type::const_reference        const_reference;
+    typedef typename container_type::size_type              size_type;
+    typedef typename container_type::difference_type        difference_type;
+
+    typedef typename container_type::iterator               iterator;
+    typedef typename container_type::const_iterator         const_iterator;
+    typedef typename container_type::reverse_iterator       reverse_iterator;
+    typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+    allocator_type get_allocator() const { return allocator_type(); }
+    key_compare    key_comp()      const { return key_comp_; }
+
+private:  // 比较元素与键值的仿函数，供 lower_bound / upper_bound / sort 使用
+
+    // 元素 < 键值
+    struct value_key_less {
+        key_compare comp;
+        value_key_less(key_compare c) : comp(c) {}
+        bool operator()(const value_type& lhs, const key_type& rhs) const {
+            return comp(value_traits::get_key(lhs), rhs);
+        }
+    };
+
+    // 键值 < 元素
+    struct key_value_less {
+        key_compare comp;
+        key_value_less(key_compare c) : comp(c) {}
+        bool operator()(const key_type& lhs, const value_type& rhs) const {
+            return comp(lhs, value_traits::get_key(rhs));
+        }
+    };
+
+    // 元素 < 元素
+    struct value_less {
+        key_compare comp;
+        value_less(key_compare c) : comp(c) {}
+        bool operator()(const value_type& lhs, const value_type& rhs) const {
+            return comp(value_traits::get_key(lhs), value_traits::get_key(rhs));
+        }
+    };
+
+    // 在有序序列上判断相邻两元素键值相等，供 unique 使用
+    struct value_equal {
+        key_compare comp;
+        value_equal(key_compare c) : comp(c) {}
+        bool operator()(const value_type& lhs, const value_type& rhs) const {
+            return !comp(value_traits::get_key(lhs), value_traits::get_key(rhs));
+        }
+    };
+
+private:  // flat_tree 的数据成员
+    container_type data_;      // 有序存放的元素
+    key_compare    key_comp_;  // 键值比较准则
+
+public:  // 构造、复制、析构函数
+    flat_tree() = default;
+
+    flat_tree(const flat_tree& rhs) : data_(rhs.data_), key_comp_(rhs.key_comp_) {}
+    flat_tree(flat_tree&& rhs) noexcept
+        : data_(tinystl::move(rhs.data_)), key_comp_(rhs.key_comp_) {}
+
+    flat_tree& operator=(const flat_tree& rhs) {
+        if (this != &rhs) {
+            data_ = rhs.data_;
+            key_comp_ = rhs.key_comp_;
+        }
+        return *this;
+    }
+
+    flat_tree& operator=(flat_tree&& rhs) noexcept {
+        data_ = tinystl::move(rhs.data_);
+        key_comp_ = rhs.key_comp_;
+        return *this;
+    }
+
+    ~flat_tree() = default;
+
+public:  // 迭代器相关操作
+    iterator                begin()     noexcept        { return data_.begin(); }
+    const_iterator          begin()     const noexcept  { return data_.begin(); }
+    const_iterator          cbegin()    const noexcept  { return data_.cbegin(); }
+
+    iterator                end()       noexcept        { return data_.end(); }
+    const_iterator          end()       const noexcept  { return data_.end(); }
+    const_iterator          cend()      const noexcept  { return data_.cend(); }
+
+    reverse_iterator        rbegin()    noexcept        { return data_.rbegin(); }
+    const_reverse_iterator  rbegin()    const noexcept  { return data_.rbegin(); }
+    const_reverse_iterator  crbegin()   const noexcept  { return data_.crbegin(); }
+
+    reverse_iterator        rend()      noexcept        { return data_.rend(); }
+    const_reverse_iterator  rend()      const noexcept  { return data_.rend(); }
+    const_reverse_iterator  crend()     const noexcept  { return data_.crend(); }
+
+public:  // 容量相关操作
+    bool        empty()     const noexcept  { return data_.empty(); }
+    size_type   size()      const noexcept  { return data_.size(); }
+    size_type   max_size()  const noexcept  { return data_.max_size(); }
+    size_type   capacity()  const noexcept  { return data_.capacity(); }
+
+    void        reserve(size_type n)        { data_.reserve(n); }
+    void        shrink_to_fit()             { data_.shrink_to_fit(); }
+
+public:  // 元素相关操作
+
+    // ====================== emplace ====================== //
+    template <class ...Args>
+    iterator  emplace_multi(Args&& ...args) {
+        return insert_multi(value_type(tinystl::forward<Args>(args)...));
+    }
+
+    template <class ...Args>
+    tinystl::pair<iterator, bool> emplace_unique(Args&& ...args) {
+        return insert_unique(value_type(tinystl::forward<Args>(args)...));
+    }
+
+    template <class ...Args>
+    iterator  emplace_multi_use_hint(const_iterator hint, Args&& ...args) {
+        return insert_multi(hint, value_type(tinystl::forward<Args>(args)...));
+    }
+
+    template <class ...Args>
+    iterator  emplace_unique_use_hint(const_iterator hint, Args&& ...args) {
+        return insert_unique(hint, value_type(tinystl::forward<Args>(args)...));
+    }
+
+    // ====================== insert ====================== //
+    iterator  insert_multi(const value_type& value) {
+        return data_.insert(upper_bound(value_traits::get_key(value)), value);
+    }
+
+    iterator  insert_multi(value_type&& value) {
+        auto pos = upper_bound(value_traits::get_key(value));
+        return data_.insert(pos, tinystl::move(value));
+    }
+
+    iterator  insert_multi(const_iterator hint, const value_type& value) {
+        return data_.insert(get_insert_multi_pos(hint, value_traits::get_key(value)), value);
+    }
+
+    iterator  insert_multi(const_iterator hint, value_type&& value) {
+        auto pos = get_insert_multi_pos(hint, value_traits::get_key(value));
+        return data_.insert(pos, tinystl::move(value));
+    }
+
+    template <class InputIterator>
+    void      insert_multi(InputIterator first, InputIterator last);
+
+    tinystl::pair<iterator, bool> insert_unique(const value_type& value);
+    tinystl::pair<iterator, bool> insert_unique(value_type&& value);
+
+    iterator  insert_unique(const_iterator hint, const value_type& value);
+    iterator  insert_unique(const_iterator hint, value_type&& value);
+
+    template <class InputIterator>
+    void      insert_unique(InputIterator first, InputIterator last);
+
+    // ====================== erase ====================== //
+
+    iterator  erase(const_iterator pos)                       { return data_.erase(pos); }
+    iterator  erase(const_iterator first, const_iterator last) { return data_.erase(first, last); }
+
+    size_type erase_multi(const key_type& key);
+    size_type erase_unique(const key_type& key);
+
+    void      clear() { data_.clear(); }
+
+public:  // 查找相关操作
+    iterator              find(const key_type& key) {
+        auto it = lower_bound(key);
+        return (it == end() || key_comp_(key, value_traits::get_key(*it))) ? end() : it;
+    }
+
+    const_iterator        find(const key_type& key) const {
+        auto it = lower_bound(key);
+        return (it == end() || key_comp_(key, value_traits::get_key(*it))) ? end() : it;
+    }
+
+    size_type             count_multi(const key_type& key) const {
+        auto p = equal_range_multi(key);
+        return static_cast<size_type>(p.second - p.first);
+    }
+
+    size_type             count_unique(const key_type& key) const {
+        return find(key) == end() ? 0 : 1;
+    }
+
+    // 以下查找均落在 lbound_dispatch / ubound_dispatch 的 random_access_iterator_tag 版本上
+    iterator              lower_bound(const key_type& key) {
+        return tinystl::lower_bound(begin(), end(), key, value_key_less(key_comp_));
+    }
+
+    const_iterator        lower_bound(const key_type& key) const {
+        return tinystl::lower_bound(begin(), end(), key, value_key_less(key_comp_));
+    }
+
+    iterator              upper_bound(const key_type& key) {
+        return tinystl::upper_bound(begin(), end(), key, key_value_less(key_comp_));
+    }
+
+    const_iterator        upper_bound(const key_type& key) const {
+        return tinystl::upper_bound(begin(), end(), key, key_value_less(key_comp_));
+    }
+
+    tinystl::pair<iterator, iterator>
+    equal_range_multi(const key_type& key) {
+        auto first = lower_bound(key);
+        auto last = tinystl::upper_bound(first, end(), key, key_value_less(key_comp_));
+        return tinystl::pair<iterator, iterator>(first, last);
+    }
+
+    tinystl::pair<const_iterator, const_iterator>
+    equal_range_multi(const key_type& key) const {
+        auto first = lower_bound(key);
+        auto last = tinystl::upper_bound(first, end(), key, key_value_less(key_comp_));
+        return tinystl::pair<const_iterator, const_iterator>(first, last);
+    }
+
+    tinystl::pair<iterator, iterator>
+    equal_range_unique(const key_type& key) {
+        iterator it = find(key);
+        return it == end() ? tinystl::make_pair(it, it) : tinystl::make_pair(it, it + 1);
+    }
+
+    tinystl::pair<const_iterator, const_iterator>
+    equal_range_unique(const key_type& key) const {
+        const_iterator it = find(key);
+        return it == end() ? tinystl::make_pair(it, it) : tinystl::make_pair(it, it + 1);
+    }
+
+    void swap(flat_tree& rhs) noexcept {
+        if (this != &rhs) {
+            data_.swap(rhs.data_);
+            tinystl::swap(key_comp_, rhs.key_comp_);
+        }
+    }
+
+private:  // 辅助函数
+    iterator const_cast_iterator(const_iterator it) {
+        return begin() + (it - cbegin());
+    }
+
+    iterator get_insert_multi_pos(const_iterator hint, const key_type& key);
+    tinystl::pair<iterator, bool> get_insert_unique_pos(const_iterator hint, const key_type& key);
+};
+
+// ============================================ 函数实现 ================================================ //
+
+/// @brief 插入元素，键值不允许重复
+/// @return 返回一个 pair，其中 first 为插入位置，second 表示是否插入成功
+template <class T, class Compare, class Alloc>
+tinystl::pair<typename flat_tree<T, Compare, Alloc>::iterator, bool>
+flat_tree<T, Compare, Alloc>::insert_unique(const value_type& value) {
+    const key_type& key = value_traits::get_key(value);
+    auto pos = lower_bound(key);
+    if (pos != end() && !key_comp_(key, value_traits::get_key(*pos))) {
+        return tinystl::make_pair(pos, false);
+    }
+    return tinystl::make_pair(data_.insert(pos, value), true);
+}
+
+template <class T, class Compare, class Alloc>
+tinystl::pair<typename flat_tree<T, Compare, Alloc>::iterator, bool>
+flat_tree<T, Compare, Alloc>::insert_unique(value_type&& value) {
+    const key_type& key = value_traits::get_key(value);
+    auto pos = lower_bound(key);
+    if (pos != end() && !key_comp_(key, value_traits::get_key(*pos))) {
+        return tinystl::make_pair(pos, false);
+    }
+    return tinystl::make_pair(data_.insert(pos, tinystl::move(value)), true);
+}
+
+/// @brief 插入元素，键值不允许重复，当 hint 恰好为插入位置时省去一次二分查找
+template <class T, class Compare, class Alloc>
+typename flat_tree<T, Compare, Alloc>::iterator
+flat_tree<T, Compare, Alloc>::insert_unique(const_iterator hint, const value_type& value) {
+    auto res = get_insert_unique_pos(hint, value_traits::get_key(value));
+    return res.second ? data_.insert(res.first, value) : res.first;
+}
+
+template <class T, class Compare, class Alloc>
+typename flat_tree<T, Compare, Alloc>::iterator
+flat_tree<T, Compare, Alloc>::insert_unique(const_iterator hint, value_type&& value) {
+    auto res = get_insert_unique_pos(hint, value_traits::get_key(value));
+    return res.second ? data_.insert(res.first, tinystl::move(value)) : res.first;
+}
+
+/// @brief 批量插入 [first, last)，键值允许重复
+//  先将新元素追加到尾部并排序，再与原有序列做一次 inplace_merge，
+//  避免逐个插入时每次都搬移后半段元素；
+//  追加部分用 stable_sort 排序，键值相同的新元素保持输入中的次序，与逐个 insert 的结果一致
+template <class T, class Compare, class Alloc>
+template <class InputIterator>
+void flat_tree<T, Compare, Alloc>::insert_multi(InputIterator first, InputIterator last) {
+    const size_type old_size = size();
+    for (; first != last; ++first) {
+        data_.emplace_back(*first);
+    }
+    auto mid = begin() + old_size;
+    tinystl::stable_sort(mid, end(), value_less(key_comp_));
+    tinystl::inplace_merge(begin(), mid, end(), value_less(key_comp_));
+}
+
+/// @brief 批量插入 [first, last)，键值不允许重复
+//  stable_sort 与 inplace_merge 都是稳定的，原有元素总是排在键值相同的新元素之前，
+//  新元素之间保持输入中的次序，因此 unique 之后保留的是原有元素或输入中的第一个，与 map / set 相同
+template <class T, class Compare, class Alloc>
+template <class InputIterator>
+void flat_tree<T, Compare, Alloc>::insert_unique(InputIterator first, InputIterator last) {
+    insert_multi(first, last);
+    data_.erase(tinystl::unique(begin(), end(), value_equal(key_comp_)), end());
+}
+
+/// @brief 删除键值等于 key 的元素，返回删除的个数
+template <class T, class Compare, class Alloc>
+typename flat_tree<T, Compare, Alloc>::size_type
+flat_tree<T, Compare, Alloc>::erase_multi(const key_type& key) {
+    auto p = equal_range_multi(key);
+    const size_type n = static_cast<size_type>(p.second - p.first);
+    data_.erase(p.first, p.second);
+    return n;
+}
+
+/// @brief 删除键值等于 key 的元素，返回删除的个数
+template <class T, class Compare, class Alloc>
+typename flat_tree<T, Compare, Alloc>::size_type
+flat_tree<T, Compare, Alloc>::erase_unique(const key_type& key) {
+    auto it = find(key);
+    if (it == end()) return 0;
+    data_.erase(it);
+    return 1;
+}
+
+// ======================================= 辅助函数 ======================================= //
+
+/// @brief 获取插入位置，键值允许重复，若 hint 满足 *(hint - 1) <= key <= *hint 则直接使用 hint
+template <class T, class Compare, class Alloc>
+typename flat_tree<T, Compare, Alloc>::iterator
+flat_tree<T, Compare, Alloc>::get_insert_multi_pos(const_iterator hint, const key_type& key) {
+    if ((hint == cbegin() || !key_comp_(key, value_traits::get_key(*(hint - 1)))) &&
+        (hint == cend() || !key_comp_(value_traits::get_key(*hint), key))) {
+        return const_cast_iterator(hint);
+    }
+    return upper_bound(key);
+}
+
+/// @brief 获取插入位置，键值不允许重复，若 hint 满足 *(hint - 1) < key < *hint 则直接使用 hint
+/// @return 返回一个 pair，first 为插入位置（或键值相同的元素），second 表示是否可以插入
+template <class T, class Compare, class Alloc>
+tinystl::pair<typename flat_tree<T, Compare, Alloc>::iterator, bool>
+flat_tree<T, Compare, Alloc>::get_insert_unique_pos(const_iterator hint, const key_type& key) {
+    if ((hint == cbegin() || key_comp_(value_traits::get_key(*(hint - 1)), key)) &&
+        (hint == cend() || key_comp_(key, value_traits::get_key(*hint)))) {
+        return tinystl::make_pair(const_cast_iterator(hint), true);
+    }
+    auto pos = lower_bound(key);
+    if (pos != end() && !key_comp_(key, value_traits::get_key(*pos))) {
+        return tinystl::make_pair(pos, false);
+    }
+    return tinystl::make_pair(pos, true);
+}
+
+// ========================================= 重载比较操作符 ========================================= //
+
+template <class T, class Compare, class Alloc>
+bool operator==(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return lhs.size() == rhs.size() && tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Compare, class Alloc>
+bool operator<(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, class Compare, class Alloc>
+bool operator!=(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, class Compare, class Alloc>
+bool operator>(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, class Compare, class Alloc>
+bool operator<=(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, class Compare, class Alloc>
+bool operator>=(const flat_tree<T, Compare, Alloc>& lhs, const flat_tree<T, Compare, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
+
+// ========================================= 重载 swap ========================================= //
+
+template <class T, class Compare, class Alloc>
+void swap(flat_tree<T, Compare, Alloc>& lhs, flat_tree<T, Compare, Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_FLAT_TREE_H_
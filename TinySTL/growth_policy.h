@@ -0,0 +1,101 @@
+#ifndef TINYSTL_GROWTH_POLICY_H_
+#define TINYSTL_GROWTH_POLICY_H_
+
+// 这个头文件包含 vector 的几种增长策略
+// growth_factor     : 按固定比例增长，growth_1_5x（缺省）与 growth_2x 是它的两个实例
+// growth_page       : 小块按 1.5 倍增长，超过一页后按页取整，并可限制单次增长的字节数
+// growth_size_class : 按 1.5 倍增长，并把容量补满空间配置器实际分配的区块
+
+// notes:
+//
+// 增长策略是 vector 的第三个模板参数，只需提供一个静态成员函数模板：
+//
+//   template <class T, class Alloc>
+//   static size_t next_capacity(size_t old_cap, size_t required);
+//
+// old_cap 为当前容量（元素个数），required 为至少需要的容量，返回值不得小于 required。
+// vector 在调用前已经处理了溢出，返回值超过 max_size() 时会被截断。
+// 初始构造时以 old_cap = 0 调用，因此空容器的最小容量也由策略决定。
+
+#include <cstddef>
+
+#include "alloc.h"
+
+namespace tinystl {
+
+// ===================================== 空间配置器的尺寸等级 ===================================== //
+
+/// @brief 申请 bytes 字节时，空间配置器实际交付的区块大小，缺省认为与请求相同
+//  特化时须保证：按取整后的大小归还空间，与按原大小归还等价
+template <class Alloc>
+struct alloc_size_class {
+    static size_t round(size_t bytes) { return bytes; }
+};
+
+/// @brief alloc 的小型区块按 8 字节取整，大于 128 字节时直接使用 malloc，不做假设
+template <>
+struct alloc_size_class<alloc> {
+    static size_t round(size_t bytes) { return alloc::size_class(bytes); }
+};
+
+/// @brief 把 n 个 T 的容量补满配置器实际交付的区块
+template <class T, class Alloc>
+size_t round_to_size_class(size_t n) {
+    return n == 0 ? 0 : alloc_size_class<Alloc>::round(n * sizeof(T)) / sizeof(T);
+}
+
+// ========================================== 增长策略 ========================================== //
+
+/// @brief 按 Num / Den 的比例增长，空容器至少分配 MinElems 个元素
+template <size_t Num, size_t Den, size_t MinElems>
+struct growth_factor {
+    static_assert(Num > Den && Den > 0, "growth factor must be greater than 1");
+
+    template <class T, class Alloc>
+    static size_t next_capacity(size_t old_cap, size_t required) {
+        const size_t grown = old_cap == 0 ? MinElems : old_cap / Den * Num + old_cap % Den * Num / Den;
+        return grown > required ? grown : required;
+    }
+};
+
+typedef growth_factor<3, 2, 16> growth_1_5x;  // 缺省策略：1.5 倍，空容器至少 16 个元素
+typedef growth_factor<2, 1, 16> growth_2x;    // 2 倍，重新分配次数更少，峰值内存更大
+
+/// @brief 不足一页时按 1.5 倍增长；超过一页后按页取整，减少零散的尾部空间；
+//  MaxStepBytes 不为 0 时单次最多增长 MaxStepBytes 字节，避免很大的 vector 一次多占数百 MB
+template <size_t PageSize = 4096, size_t MaxStepBytes = 0>
+struct growth_page {
+    static_assert((PageSize & (PageSize - 1)) == 0, "PageSize must be a power of 2");
+
+    template <class T, class Alloc>
+    static size_t next_capacity(size_t old_cap, size_t required) {
+        size_t grown = old_cap + old_cap / 2;
+        if (MaxStepBytes != 0 && grown - old_cap > MaxStepBytes / sizeof(T)) {
+            grown = old_cap + (MaxStepBytes / sizeof(T) > 0 ? MaxStepBytes / sizeof(T) : 1);
+        }
+        if (grown < required) grown = required;
+        if (grown == 0) return 0;
+        const size_t bytes = grown * sizeof(T);
+        if (bytes < PageSize) {
+            return round_to_size_class<T, Alloc>(grown);
+        }
+        return ((bytes + PageSize - 1) & ~(PageSize - 1)) / sizeof(T);
+    }
+};
+
+/// @brief 按 1.5 倍增长，空容器至少分配 MinBytes 字节（而不是固定的元素个数），
+//  并把容量补满配置器实际分配的区块，小元素类型不再为固定的 16 个元素的下限浪费空间
+template <size_t MinBytes = 64>
+struct growth_size_class {
+    template <class T, class Alloc>
+    static size_t next_capacity(size_t old_cap, size_t required) {
+        const size_t min_elems = MinBytes / sizeof(T) > 0 ? MinBytes / sizeof(T) : 1;
+        size_t grown = old_cap == 0 ? min_elems : old_cap + old_cap / 2;
+        if (grown < required) grown = required;
+        return round_to_size_class<T, Alloc>(grown);
+    }
+};
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_GROWTH_POLICY_H_
@@ -4,8 +4,19 @@
 // 这个头文件包含了 heap 相关的算法
 // 严格意义上来讲heap并不是一个容器, 所以他没有实现自己的迭代器, 
 // 也就没有遍历操作, 它只是一种算法.
+// 除二叉堆外还提供 D 叉堆（push_dary_heap 等，节点 i 的子节点为 D*i+1 ... D*i+D），以及供
+// priority_queue 选择堆算法的策略类 binary_heap_policy / dary_heap_policy<D>
+
+// notes:
+//
+// D 叉堆的高度约为 log_D(n)，pop 时下沉的层数是二叉堆的 1/log2(D)，每层比较 D 个相邻的子节点。
+// 对 int 这样的小元素，4 叉 / 8 叉堆同一节点的子节点落在同一或相邻的缓存行内，每层的缓存缺失
+// 与二叉堆相同而层数更少，堆大于缓存时 pop 更快；堆能留在缓存中时，每层多出的 D - 2 次比较可能
+// 抵消层数的减少。push 每层只与父节点比较一次，层数少总是受益。
+// 数组从 first 开始存放，子节点组的起点是 D*i+1，不额外填充元素来对齐缓存行。
 
 #include "iterator.h"
+#include "functional.h"
 
 namespace tinystl {
 
@@ -233,6 +244,213 @@ void make_heap(RandomIterator first, RandomIterator last, Compared comp) {
     tinystl::make_heap_aux(first, last, distance_type(first), comp);
 }
 
+
+/*****************************************************************************************/
+// D 叉堆: push_dary_heap / pop_dary_heap / make_dary_heap / sort_dary_heap
+// 与二叉堆的版本语义相同，第一个模板参数为叉数 D（D >= 2），D == 2 时与二叉堆的布局一致
+/*****************************************************************************************/
+
+/// @brief D 叉堆的 percolate up，从 holeIndex 上浮到不小于 topIndex 的合适位置
+template <size_t D, class RandomIterator, class Distance, class T, class Compared>
+void dary_push_heap_aux(RandomIterator first, Distance holeIndex, Distance topIndex, T value, Compared comp) {
+    while (holeIndex > topIndex) {
+        auto parent = (holeIndex - 1) / static_cast<Distance>(D);
+        if (!comp(*(first + parent), value)) break;
+        *(first + holeIndex) = tinystl::move(*(first + parent));
+        holeIndex = parent;
+    }
+    *(first + holeIndex) = tinystl::move(value);
+}
+
+/// @brief D 叉堆的 percolate down：先沿较大的子节点下放到叶子，再上浮 value，与 adjust_heap 的做法相同
+template <size_t D, class RandomIterator, class Distance, class T, class Compared>
+void dary_adjust_heap(RandomIterator first, Distance holeIndex, Distance len, T value, Compared comp) {
+    static_assert(D >= 2, "the arity of a heap should be at least 2");
+    const Distance d = static_cast<Distance>(D);
+    auto topIndex = holeIndex;
+    auto child = d * holeIndex + 1;
+    // 子节点齐全的层，比较次数固定为 D - 1，编译器可以展开
+    while (child + d <= len) {
+        auto best = child;
+        for (Distance k = 1; k < d; ++k) {
+            if (comp(*(first + best), *(first + child + k))) best = child + k;
+        }
+        *(first + holeIndex) = tinystl::move(*(first + best));
+        holeIndex = best;
+        child = d * holeIndex + 1;
+    }
+    // 最后一个内部节点可能只有部分子节点
+    if (child < len) {
+        auto best = child;
+        for (auto k = child + 1; k < len; ++k) {
+            if (comp(*(first + best), *(first + k))) best = k;
+        }
+        *(first + holeIndex) = tinystl::move(*(first + best));
+        holeIndex = best;
+    }
+    tinystl::dary_push_heap_aux<D>(first, holeIndex, topIndex, tinystl::move(value), comp);
+}
+
+/// @brief D 叉堆的 percolate down，value 不小于所有子节点时立即停止
+/// @note  新值通常停在靠近堆顶的位置时（如 replace_top）比先下放到叶子再上浮的 dary_adjust_heap 省去上浮
+template <size_t D, class RandomIterator, class Distance, class T, class Compared>
+void dary_sift_down(RandomIterator first, Distance holeIndex, Distance len, T value, Compared comp) {
+    const Distance d = static_cast<Distance>(D);
+    for (auto child = d * holeIndex + 1; child < len; child = d * holeIndex + 1) {
+        const auto end = len - child > d ? child + d : len;
+        auto best = child;
+        for (auto k = child + 1; k < end; ++k) {
+            if (comp(*(first + best), *(first + k))) best = k;
+        }
+        if (!comp(value, *(first + best))) break;
+        *(first + holeIndex) = tinystl::move(*(first + best));
+        holeIndex = best;
+    }
+    *(first + holeIndex) = tinystl::move(value);
+}
+
+template <size_t D, class RandomIterator, class Compared>
+void push_dary_heap(RandomIterator first, RandomIterator last, Compared comp) {
+    typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+    typedef typename iterator_traits<RandomIterator>::value_type      T;
+    if (last - first < 2) return;
+    T value = tinystl::move(*(last - 1));
+    tinystl::dary_push_heap_aux<D>(first, static_cast<Distance>((last - first) - 1), static_cast<Distance>(0),
+                                   tinystl::move(value), comp);
+}
+
+template <size_t D, class RandomIterator>
+void push_dary_heap(RandomIterator first, RandomIterator last) {
+    tinystl::push_dary_heap<D>(first, last, tinystl::less<typename iterator_traits<RandomIterator>::value_type>());
+}
+
+/// @brief 将堆顶元素移到 last - 1，并把 [first, last - 1) 调整为 D 叉堆
+template <size_t D, class RandomIterator, class Compared>
+void pop_dary_heap(RandomIterator first, RandomIterator last, Compared comp) {
+    typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+    typedef typename iterator_traits<RandomIterator>::value_type      T;
+    if (last - first < 2) return;
+    --last;
+    T value = tinystl::move(*last);
+    *last = tinystl::move(*first);
+    tinystl::dary_adjust_heap<D>(first, static_cast<Distance>(0), static_cast<Distance>(last - first),
+                                 tinystl::move(value), comp);
+}
+
+template <size_t D, class RandomIterator>
+void pop_dary_heap(RandomIterator first, RandomIterator last) {
+    tinystl::pop_dary_heap<D>(first, last, tinystl::less<typename iterator_traits<RandomIterator>::value_type>());
+}
+
+/// @brief 从最后一个非叶节点开始逐个下沉，把 [first, last) 变为 D 叉堆
+template <size_t D, class RandomIterator, class Compared>
+void make_dary_heap(RandomIterator first, RandomIterator last, Compared comp) {
+    typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+    typedef typename iterator_traits<RandomIterator>::value_type      T;
+    const Distance len = last - first;
+    if (len < 2) return;
+    for (Distance holeIndex = (len - 2) / static_cast<Distance>(D) + 1; holeIndex-- > 0; ) {
+        T value = tinystl::move(*(first + holeIndex));
+        tinystl::dary_adjust_heap<D>(first, holeIndex, len, tinystl::move(value), comp);
+    }
+}
+
+template <size_t D, class RandomIterator>
+void make_dary_heap(RandomIterator first, RandomIterator last) {
+    tinystl::make_dary_heap<D>(first, last, tinystl::less<typename iterator_traits<RandomIterator>::value_type>());
+}
+
+template <size_t D, class RandomIterator, class Compared>
+void sort_dary_heap(RandomIterator first, RandomIterator last, Compared comp) {
+    while (last - first > 1) {
+        tinystl::pop_dary_heap<D>(first, last--, comp);
+    }
+}
+
+template <size_t D, class RandomIterator>
+void sort_dary_heap(RandomIterator first, RandomIterator last) {
+    tinystl::sort_dary_heap<D>(first, last, tinystl::less<typename iterator_traits<RandomIterator>::value_type>());
+}
+
+/// @brief 检查 [first, last) 是否为 D 叉堆
+template <size_t D, class RandomIterator, class Compared>
+bool is_dary_heap(RandomIterator first, RandomIterator last, Compared comp) {
+    typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+    const Distance len = last - first;
+    for (Distance child = 1; child < len; ++child) {
+        if (comp(*(first + (child - 1) / static_cast<Distance>(D)), *(first + child))) return false;
+    }
+    return true;
+}
+
+template <size_t D, class RandomIterator>
+bool is_dary_heap(RandomIterator first, RandomIterator last) {
+    return tinystl::is_dary_heap<D>(first, last, tinystl::less<typename iterator_traits<RandomIterator>::value_type>());
+}
+
+
+/*****************************************************************************************/
+// 堆算法策略
+// priority_queue 通过策略类选择堆算法，策略类提供静态的 push_heap / pop_heap / make_heap / replace_top
+/*****************************************************************************************/
+
+/// @brief 二叉堆，使用 push_heap / pop_heap / make_heap
+struct binary_heap_policy {
+    static constexpr size_t arity = 2;
+
+    template <class RandomIterator, class Compared>
+    static void push_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::push_heap(first, last, comp);
+    }
+
+    template <class RandomIterator, class Compared>
+    static void pop_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::pop_heap(first, last, comp);
+    }
+
+    template <class RandomIterator, class Compared>
+    static void make_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::make_heap(first, last, comp);
+    }
+
+    /// @brief 用 value 替换堆顶并下沉，二叉堆即 2 叉堆
+    template <class RandomIterator, class T, class Compared>
+    static void replace_top(RandomIterator first, RandomIterator last, T&& value, Compared& comp) {
+        typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+        tinystl::dary_sift_down<2>(first, static_cast<Distance>(0), static_cast<Distance>(last - first),
+                                   typename iterator_traits<RandomIterator>::value_type(tinystl::forward<T>(value)), comp);
+    }
+};
+
+/// @brief D 叉堆，使用 push_dary_heap / pop_dary_heap / make_dary_heap
+template <size_t D>
+struct dary_heap_policy {
+    static_assert(D >= 2, "the arity of a heap should be at least 2");
+    static constexpr size_t arity = D;
+
+    template <class RandomIterator, class Compared>
+    static void push_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::push_dary_heap<D>(first, last, comp);
+    }
+
+    template <class RandomIterator, class Compared>
+    static void pop_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::pop_dary_heap<D>(first, last, comp);
+    }
+
+    template <class RandomIterator, class Compared>
+    static void make_heap(RandomIterator first, RandomIterator last, Compared& comp) {
+        tinystl::make_dary_heap<D>(first, last, comp);
+    }
+
+    template <class RandomIterator, class T, class Compared>
+    static void replace_top(RandomIterator first, RandomIterator last, T&& value, Compared& comp) {
+        typedef typename iterator_traits<RandomIterator>::difference_type Distance;
+        tinystl::dary_sift_down<D>(first, static_cast<Distance>(0), static_cast<Distance>(last - first),
+                                   typename iterator_traits<RandomIterator>::value_type(tinystl::forward<T>(value)), comp);
+    }
+};
+
 }  // namespace tinystl
 
 #endif  // TINYSTL_HEAP_H_
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef TINYSTL_HUGE_PAGE_ALLOC_H_
+#define TINYSTL_HUGE_PAGE_ALLOC_H_
+
+// 这个头文件包含一个空间配置器 huge_page_alloc
+// huge_page_alloc : 大块内存从按 2MB 对齐的 mmap 区域分配并建议内核使用透明大页，可选绑定 NUMA 节点
+
+// notes:
+//
+// alloc 与 allocator 的大块内存都来自 malloc / operator new，按 4KB 页映射，数 GB 的查找表随机访问时
+// TLB 缺失占了不少时间。huge_page_alloc<Node> 可以直接作为容器的 Alloc 参数，例如
+// tinystl::vector<int, tinystl::huge_page_alloc<>>：
+//   * 不小于 HUGE_PAGE_SIZE 的请求按 HUGE_PAGE_SIZE 取整后用 mmap 分配，起始地址按 HUGE_PAGE_SIZE 对齐，
+//     并以 madvise(MADV_HUGEPAGE) 建议内核使用透明大页（/sys/kernel/mm/transparent_hugepage/enabled
+//     为 always 或 madvise 时生效）
+//   * Node >= 0 时用 mbind 把这段内存绑定到第 Node 个 NUMA 节点，不依赖 libnuma；Node 为 -1 时不绑定
+//   * 更小的请求（节点、deque 的缓冲区等）仍交给 alloc
+//   * 配合 vector 使用时，容量会补满最后一个大页（见 alloc_size_class）
+//
+// 不支持 MADV_HUGEPAGE / mbind 的平台上相应的步骤被忽略，Windows 下退化为按 HUGE_PAGE_SIZE 对齐的普通分配。
+
+#include <new>        // std::bad_alloc
+#include <cstddef>    // size_t
+#include <cstdint>    // uintptr_t
+#if !defined(_WIN32)
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <unistd.h>   // syscall
+#if defined(__linux__)
+#include <sys/syscall.h>  // SYS_mbind
+#endif
+#endif
+
+#include "alloc.h"
+#include "growth_policy.h"
+
+namespace tinystl {
+
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;  // x86-64 / AArch64 上透明大页的大小
+
+/// @brief 把 bytes 上调至 HUGE_PAGE_SIZE 的倍数
+inline size_t huge_page_round(size_t bytes) {
+    return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+/// @brief 分配 bytes（须为 HUGE_PAGE_SIZE 的倍数）字节、按 HUGE_PAGE_SIZE 对齐的匿名映射，node >= 0 时绑定 NUMA 节点
+inline void* huge_page_map(size_t bytes, int node) {
+#if defined(_WIN32)
+    (void)node;
+    return aligned_allocate(bytes, HUGE_PAGE_SIZE);
+#else
+    // 多映射一个大页，再把首尾多出的部分归还，得到对齐的区间
+    char* raw = static_cast<char*>(
+        mmap(nullptr, bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (raw == MAP_FAILED) throw std::bad_alloc();
+    char* p = reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(raw) + HUGE_PAGE_SIZE - 1) & ~static_cast<uintptr_t>(HUGE_PAGE_SIZE - 1));
+    const size_t head = static_cast<size_t>(p - raw);
+    if (head != 0) munmap(raw, head);
+    if (head != HUGE_PAGE_SIZE) munmap(p + bytes, HUGE_PAGE_SIZE - head);
+#if defined(MADV_HUGEPAGE)
+    madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+#if defined(__linux__) && defined(SYS_mbind)
+    if (node >= 0) {
+        enum { MPOL_BIND_MODE = 2 };  // 与 <numaif.h> 中的 MPOL_BIND 相同
+        const size_t bits = sizeof(unsigned long) * 8;
+        unsigned long mask[4] = { 0, 0, 0, 0 };
+        if (static_cast<size_t>(node) < bits * 4) {
+            mask[node / bits] = 1UL << (node % bits);
+            // 绑定失败（如节点不存在）时保持缺省的内存策略
+            syscall(SYS_mbind, p, bytes, MPOL_BIND_MODE, mask, bits * 4 + 1, 0);
+        }
+    }
+#else
+    (void)node;
+#endif
+    return p;
+#endif
+}
+
+inline void huge_page_unmap(void* p, size_t bytes) noexcept {
+#if defined(_WIN32)
+    (void)bytes;
+    aligned_deallocate(p);
+#else
+    munmap(p, bytes);
+#endif
+}
+
+// ====================================== huge_page_alloc ====================================== //
+
+/// @brief 大页空间配置器，接口与 alloc 相同，可作为 simple_alloc 的 Alloc 参数
+/// @tparam Node  绑定的 NUMA 节点，-1 表示不绑定
+template <int Node = -1>
+class huge_page_alloc {
+public:
+    static constexpr size_t threshold = HUGE_PAGE_SIZE;  // 不小于该值的请求使用大页
+
+    static void* allocate(size_t n, size_t align) {
+        if (n < threshold) return alloc::allocate(n, align);
+        return huge_page_map(huge_page_round(n), Node);
+    }
+
+    static void deallocate(void* p, size_t n, size_t align) {
+        if (n < threshold) alloc::deallocate(p, n, align);
+        else huge_page_unmap(p, huge_page_round(n));
+    }
+
+    static void* allocate(size_t n) { return allocate(n, static_cast<size_t>(__ALIGN)); }
+    static void  deallocate(void* p, size_t n) { deallocate(p, n, static_cast<size_t>(__ALIGN)); }
+};
+
+template <int Node>
+constexpr size_t huge_page_alloc<Node>::threshold;
+
+/// @brief 大块按大页取整，vector 可以用满最后一个大页；小块与 alloc 相同
+template <int Node>
+struct alloc_size_class<huge_page_alloc<Node>> {
+    static size_t round(size_t bytes) {
+        return bytes < huge_page_alloc<Node>::threshold ? alloc::size_class(bytes) : huge_page_round(bytes);
+    }
+};
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_HUGE_PAGE_ALLOC_H_
@@ -0,0 +1,334 @@
+#ifndef TINYSTL_INTRUSIVE_LIST_H_
+#define TINYSTL_INTRUSIVE_LIST_H_
+
+// 这个头文件包含一个模板类 intrusive_list
+// intrusive_list : 侵入式双向链表，链表指针（钩子）嵌入在元素之中，容器本身不分配任何内存
+
+// notes:
+//
+// 钩子就是 list 使用的 list_node_base<Tag>，元素类型公有继承 list_hook<Tag> 即可被链入 intrusive_list<T, Tag>。
+// 一个对象可以继承多个 Tag 不同的钩子，从而同时位于多个链表中（例如 LRU 链表与超时链表）：
+//   * 容器不拥有元素：插入只修改指针，erase / clear 只把元素从链表中摘下，既不析构也不释放元素
+//   * 元素位于链表中时不能被销毁或移动，同一个钩子同一时刻只能位于一个链表中
+//   * 头节点嵌入在容器对象中，构造、移动与 swap 都不分配内存，移动与 swap 需要把首尾节点重新指回头节点
+//   * 链接、拼接与交换使用与 list 相同的 list_link_nodes / list_unlink_nodes / list_transfer / list_swap_headers
+//   * iterator_to 由元素的引用在 O(1) 时间内得到迭代器，erase(iterator_to(x)) 即可把 x 摘下
+
+#include <cstddef>
+#include <type_traits>
+
+#include "list.h"
+#include "iterator.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+struct list_default_tag {};  // 未指定 Tag 时使用的钩子标签
+
+/// @brief intrusive_list 的钩子，元素公有继承它即可链入 intrusive_list<T, Tag>
+template <class Tag = list_default_tag>
+using list_hook = list_node_base<Tag>;
+
+// ==================================== intrusive_list 迭代器 ==================================== //
+
+template <class T, class Tag, class Ref, class Ptr>
+struct intrusive_list_iterator : public tinystl::iterator<tinystl::bidirectional_iterator_tag, T> {
+    typedef T                                                   value_type;
+    typedef Ptr                                                 pointer;
+    typedef Ref                                                 reference;
+    typedef list_node_base<Tag>*                                base_ptr;
+    typedef intrusive_list_iterator<T, Tag, T&, T*>             iterator;
+    typedef intrusive_list_iterator<T, Tag, const T&, const T*> const_iterator;
+    typedef intrusive_list_iterator                             self;
+
+    base_ptr node_;  // 指向当前元素的钩子
+
+    // 构造函数
+
+    intrusive_list_iterator() : node_(nullptr) {}
+    intrusive_list_iterator(base_ptr x) : node_(x) {}
+    intrusive_list_iterator(const iterator& rhs) : node_(rhs.node_) {}
+
+    intrusive_list_iterator& operator=(const intrusive_list_iterator&) = default;
+
+    // 重载操作符
+
+    reference operator*()  const { return static_cast<reference>(*node_); }
+    pointer   operator->() const { return &(operator*()); }
+
+    self& operator++() {
+        TINYSTL_DEBUG(node_ != nullptr);
+        node_ = node_->next;
+        return *this;
+    }
+
+    self operator++(int) {
+        self tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    self& operator--() {
+        TINYSTL_DEBUG(node_ != nullptr);
+        node_ = node_->prev;
+        return *this;
+    }
+
+    self operator--(int) {
+        self tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    // 重载比较操作符
+    bool operator==(const const_iterator& rhs) const { return node_ == rhs.node_; }
+    bool operator!=(const const_iterator& rhs) const { return node_ != rhs.node_; }
+};
+
+// ==================================== intrusive_list 结构 ==================================== //
+
+/// @brief 侵入式双向环形链表
+/// @tparam T    元素类型，须公有继承 list_hook<Tag>
+/// @tparam Tag  钩子标签，用于区分同一元素上的多个钩子
+template <class T, class Tag = list_default_tag>
+class intrusive_list {
+public:
+    typedef list_node_base<Tag>                       hook_type;
+    typedef hook_type*                                base_ptr;
+
+    typedef T                                         value_type;
+    typedef value_type*                               pointer;
+    typedef const value_type*                         const_pointer;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+    typedef size_t                                    size_type;
+    typedef ptrdiff_t                                 difference_type;
+
+    typedef intrusive_list_iterator<T, Tag, T&, T*>             iterator;
+    typedef intrusive_list_iterator<T, Tag, const T&, const T*> const_iterator;
+    typedef tinystl::reverse_iterator<iterator>       reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    static_assert(std::is_base_of<hook_type, T>::value, "intrusive_list<T, Tag> requires T to derive from list_hook<Tag>");
+
+private:
+    hook_type node_;  // 嵌入的头节点，end() 指向它
+    size_type size_;  // 元素个数
+
+public:  // 构造、移动、析构函数
+    intrusive_list() noexcept : size_(0) { node_.unlink(); }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    intrusive_list(Iter first, Iter last) : size_(0) {
+        node_.unlink();
+        insert(end(), first, last);
+    }
+
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    intrusive_list(intrusive_list&& rhs) noexcept : size_(0) {
+        node_.unlink();
+        swap(rhs);
+    }
+
+    intrusive_list& operator=(intrusive_list&& rhs) noexcept {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    ~intrusive_list() { clear(); }
+
+public:  // 迭代器相关操作
+    iterator               begin()   noexcept        { return node_.next; }
+    const_iterator         begin()   const noexcept  { return node_.next; }
+    const_iterator         cbegin()  const noexcept  { return begin(); }
+    iterator               end()     noexcept        { return header(); }
+    const_iterator         end()     const noexcept  { return header(); }
+    const_iterator         cend()    const noexcept  { return end(); }
+
+    reverse_iterator       rbegin()  noexcept        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin()  const noexcept  { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept  { return rbegin(); }
+    reverse_iterator       rend()    noexcept        { return reverse_iterator(begin()); }
+    const_reverse_iterator rend()    const noexcept  { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend()   const noexcept  { return rend(); }
+
+    /// @brief 由链表中元素的引用得到指向它的迭代器
+    static iterator       iterator_to(reference x) noexcept       { return static_cast<base_ptr>(&x); }
+    static const_iterator iterator_to(const_reference x) noexcept {
+        return const_cast<base_ptr>(static_cast<const hook_type*>(&x));
+    }
+
+public:  // 容量相关操作
+    bool      empty()    const noexcept { return size_ == 0; }
+    size_type size()     const noexcept { return size_; }
+    size_type max_size() const noexcept { return static_cast<size_type>(-1); }
+
+public:  // 访问元素相关操作
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return *begin();
+    }
+
+    const_reference front() const {
+        TINYSTL_DEBUG(!empty());
+        return *begin();
+    }
+
+    reference back() {
+        TINYSTL_DEBUG(!empty());
+        return *iterator(node_.prev);
+    }
+
+    const_reference back() const {
+        TINYSTL_DEBUG(!empty());
+        return *const_iterator(node_.prev);
+    }
+
+public:  // 修改容器相关操作
+    void push_front(reference x) noexcept { insert(begin(), x); }
+    void push_back(reference x)  noexcept { insert(end(), x); }
+
+    void pop_front() noexcept {
+        TINYSTL_DEBUG(!empty());
+        erase(begin());
+    }
+
+    void pop_back() noexcept {
+        TINYSTL_DEBUG(!empty());
+        erase(iterator(node_.prev));
+    }
+
+    /// @brief 把 x 链入 pos 之前，返回指向 x 的迭代器
+    iterator insert(const_iterator pos, reference x) noexcept {
+        base_ptr p = static_cast<base_ptr>(&x);
+        tinystl::list_link_nodes(pos.node_, p, p);
+        ++size_;
+        return p;
+    }
+
+    /// @brief 依次把 [first, last) 所引用的元素链入 pos 之前
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    void insert(const_iterator pos, Iter first, Iter last) {
+        for (; first != last; ++first) insert(pos, *first);
+    }
+
+    /// @brief 把 pos 处的元素从链表中摘下，返回其后继
+    iterator erase(const_iterator pos) noexcept {
+        TINYSTL_DEBUG(pos != end());
+        base_ptr next = pos.node_->next;
+        tinystl::list_unlink_nodes(pos.node_, pos.node_);
+        --size_;
+        return next;
+    }
+
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while (first != last) first = erase(first);
+        return last.node_;
+    }
+
+    /// @brief 摘下全部元素，O(1)，元素的钩子保持原值
+    void clear() noexcept {
+        node_.unlink();
+        size_ = 0;
+    }
+
+    void swap(intrusive_list& rhs) noexcept;
+
+public:  // list 相关操作
+    void splice(const_iterator pos, intrusive_list& x) noexcept;
+    void splice(const_iterator pos, intrusive_list& x, const_iterator it) noexcept;
+    void splice(const_iterator pos, intrusive_list& x, const_iterator first, const_iterator last) noexcept;
+
+    template <class UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred);
+
+    void reverse() noexcept;
+
+private:
+    /// @brief 头节点的指针，const 成员函数也需要它来构造迭代器
+    base_ptr header() const noexcept { return const_cast<base_ptr>(&node_); }
+};
+
+// ==================================== 函数实现 ==================================== //
+
+/// @brief 交换两个链表，只交换头节点的指针与元素个数
+template <class T, class Tag>
+void intrusive_list<T, Tag>::swap(intrusive_list& rhs) noexcept {
+    tinystl::list_swap_headers(node_, rhs.node_);
+    tinystl::swap(size_, rhs.size_);
+}
+
+/// @brief 将 x 的全部元素移动到 pos 之前
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list& x) noexcept {
+    TINYSTL_DEBUG(this != &x);
+    if (!x.empty()) {
+        tinystl::list_transfer(pos.node_, x.node_.next, x.header());
+        size_ += x.size_;
+        x.size_ = 0;
+    }
+}
+
+/// @brief 将 x 中 it 处的元素移动到 pos 之前
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list& x, const_iterator it) noexcept {
+    if (pos.node_ != it.node_ && pos.node_ != it.node_->next) {
+        tinystl::list_transfer(pos.node_, it.node_, it.node_->next);
+        ++size_;
+        --x.size_;
+    }
+}
+
+/// @brief 将 x 中 [first, last) 内的元素移动到 pos 之前，x 可以是自身（此时 pos 不能位于区间内）
+template <class T, class Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list& x,
+                                    const_iterator first, const_iterator last) noexcept {
+    if (first == last) return;
+    if (this != &x) {
+        const size_type n = static_cast<size_type>(tinystl::distance(first, last));
+        size_ += n;
+        x.size_ -= n;
+    }
+    tinystl::list_transfer(pos.node_, first.node_, last.node_);
+}
+
+/// @brief 摘下所有满足 pred 的元素，返回摘下的个数
+template <class T, class Tag>
+template <class UnaryPredicate>
+typename intrusive_list<T, Tag>::size_type
+intrusive_list<T, Tag>::remove_if(UnaryPredicate pred) {
+    size_type n = 0;
+    for (auto it = begin(); it != end(); ) {
+        if (pred(*it)) {
+            it = erase(it);
+            ++n;
+        }
+        else ++it;
+    }
+    return n;
+}
+
+/// @brief 反转链表：交换包括头节点在内的每个节点的 prev 与 next
+template <class T, class Tag>
+void intrusive_list<T, Tag>::reverse() noexcept {
+    base_ptr p = header();
+    do {
+        tinystl::swap(p->prev, p->next);
+        p = p->prev;
+    } while (p != header());
+}
+
+template <class T, class Tag>
+void swap(intrusive_list<T, Tag>& lhs, intrusive_list<T, Tag>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_INTRUSIVE_LIST_H_
@@ -0,0 +1,424 @@
+#ifndef TINYSTL_INTRUSIVE_RB_TREE_H_
+#define TINYSTL_INTRUSIVE_RB_TREE_H_
+
+// 这个头文件包含一个模板类 intrusive_rb_tree
+// intrusive_rb_tree : 侵入式红黑树，树节点（钩子）嵌入在元素之中，容器本身不分配任何内存
+
+// notes:
+//
+// 钩子就是 rb_tree 使用的 rb_tree_node_base<Tag>，元素类型公有继承 rb_tree_hook<Tag> 即可被链入
+// intrusive_rb_tree<T, KeyOfValue, Compare, Tag>，KeyOfValue 从元素中取出键值（缺省为元素本身）。
+//   * 容器不拥有元素：插入只修改指针，erase / clear 只把元素从树中摘下，既不析构也不释放元素
+//   * 元素位于树中时不能被销毁或移动，也不能修改参与比较的键值
+//   * header 嵌入在容器对象中，构造、移动与 swap 都不分配内存，移动与 swap 需要把根节点重新指回 header
+//   * 迭代器的前进后退（rb_tree_iterator_base）、插入与删除后的重新平衡（rb_tree_insert_rebalance /
+//     rb_tree_erase_rebalance）以及交换 header（rb_tree_swap_headers）与 rb_tree 共用同一份代码
+//   * 同一个对象可以继承多个 Tag 不同的钩子，同时位于多棵树或多个 intrusive_list 中，
+//     例如连接对象同时按 id 索引、按超时时间排序并位于 LRU 链表中
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "rb_tree.h"
+#include "functional.h"
+#include "iterator.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+struct rb_tree_default_tag {};  // 未指定 Tag 时使用的钩子标签
+
+/// @brief intrusive_rb_tree 的钩子，元素公有继承它即可链入 intrusive_rb_tree<T, ..., Tag>
+template <class Tag = rb_tree_default_tag>
+using rb_tree_hook = rb_tree_node_base<Tag>;
+
+/// @brief KeyOfValue 作用于 const T& 的结果类型，type 为去掉引用与 cv 限定后的键值类型
+template <class T, class KeyOfValue>
+struct intrusive_key_of {
+    typedef decltype(std::declval<const KeyOfValue&>()(std::declval<const T&>())) result_type;
+    typedef typename std::decay<result_type>::type                                  type;
+};
+
+// ================================= intrusive_rb_tree 迭代器 =================================== //
+
+template <class T, class Tag, class Ref, class Ptr>
+struct intrusive_rb_tree_iterator : public rb_tree_iterator_base<Tag> {
+    typedef T                                                      value_type;
+    typedef Ptr                                                    pointer;
+    typedef Ref                                                    reference;
+    typedef typename rb_tree_iterator_base<Tag>::base_ptr          base_ptr;
+    typedef intrusive_rb_tree_iterator<T, Tag, T&, T*>             iterator;
+    typedef intrusive_rb_tree_iterator<T, Tag, const T&, const T*> const_iterator;
+    typedef intrusive_rb_tree_iterator                             self;
+
+    using rb_tree_iterator_base<Tag>::node;
+
+    // 构造函数
+    intrusive_rb_tree_iterator() {}
+    intrusive_rb_tree_iterator(base_ptr x) { node = x; }
+    intrusive_rb_tree_iterator(const iterator& rhs) { node = rhs.node; }
+
+    intrusive_rb_tree_iterator& operator=(const intrusive_rb_tree_iterator&) = default;
+
+    // 重载操作符
+    reference operator*()  const { return static_cast<reference>(*node); }
+    pointer   operator->() const { return &(operator*()); }
+
+    self& operator++() {
+        this->inc();
+        return *this;
+    }
+
+    self operator++(int) {
+        self tmp(*this);
+        this->inc();
+        return tmp;
+    }
+
+    self& operator--() {
+        this->dec();
+        return *this;
+    }
+
+    self operator--(int) {
+        self tmp(*this);
+        this->dec();
+        return tmp;
+    }
+
+    bool operator==(const rb_tree_iterator_base<Tag>& rhs) const { return node == rhs.node; }
+    bool operator!=(const rb_tree_iterator_base<Tag>& rhs) const { return node != rhs.node; }
+};
+
+// ================================= intrusive_rb_tree 结构 =================================== //
+
+/// @brief 侵入式红黑树
+/// @tparam T           元素类型，须公有继承 rb_tree_hook<Tag>
+/// @tparam KeyOfValue  从元素中取出键值的仿函数
+/// @tparam Compare     键值比较准则
+/// @tparam Tag         钩子标签，用于区分同一元素上的多个钩子
+template <class T, class KeyOfValue = tinystl::identity<T>,
+          class Compare = tinystl::less<typename intrusive_key_of<T, KeyOfValue>::type>,
+          class Tag = rb_tree_default_tag>
+class intrusive_rb_tree {
+public:
+    typedef rb_tree_node_base<Tag>                        hook_type;
+    typedef hook_type*                                    base_ptr;
+
+    typedef typename intrusive_key_of<T, KeyOfValue>::type key_type;
+    typedef T                                             value_type;
+    typedef value_type*                                   pointer;
+    typedef const value_type*                             const_pointer;
+    typedef value_type&                                   reference;
+    typedef const value_type&                             const_reference;
+    typedef size_t                                        size_type;
+    typedef ptrdiff_t                                     difference_type;
+    typedef Compare                                       key_compare;
+    typedef KeyOfValue                                    key_of_value;
+
+    typedef intrusive_rb_tree_iterator<T, Tag, T&, T*>             iterator;
+    typedef intrusive_rb_tree_iterator<T, Tag, const T&, const T*> const_iterator;
+    typedef tinystl::reverse_iterator<iterator>           reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+    static_assert(std::is_base_of<hook_type, T>::value,
+                  "intrusive_rb_tree<T, ..., Tag> requires T to derive from rb_tree_hook<Tag>");
+
+private:
+    hook_type    header_;      // 嵌入的 header，与根节点互为父节点，left / right 指向最小 / 最大节点
+    size_type    node_count_;  // 元素个数
+    key_compare  key_comp_;    // 键值比较准则
+    key_of_value key_of_;      // 取键值的仿函数
+
+public:  // 构造、移动、析构函数
+    explicit intrusive_rb_tree(const key_compare& comp = key_compare(),
+                               const key_of_value& kov = key_of_value()) noexcept
+        : node_count_(0), key_comp_(comp), key_of_(kov) {
+        reset_header();
+    }
+
+    intrusive_rb_tree(const intrusive_rb_tree&) = delete;
+    intrusive_rb_tree& operator=(const intrusive_rb_tree&) = delete;
+
+    intrusive_rb_tree(intrusive_rb_tree&& rhs) noexcept
+        : node_count_(0), key_comp_(rhs.key_comp_), key_of_(rhs.key_of_) {
+        reset_header();
+        swap(rhs);
+    }
+
+    intrusive_rb_tree& operator=(intrusive_rb_tree&& rhs) noexcept {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    ~intrusive_rb_tree() { clear(); }
+
+public:  // 迭代器相关操作
+    iterator               begin()   noexcept        { return leftmost(); }
+    const_iterator         begin()   const noexcept  { return leftmost(); }
+    const_iterator         cbegin()  const noexcept  { return begin(); }
+    iterator               end()     noexcept        { return header(); }
+    const_iterator         end()     const noexcept  { return header(); }
+    const_iterator         cend()    const noexcept  { return end(); }
+
+    reverse_iterator       rbegin()  noexcept        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin()  const noexcept  { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept  { return rbegin(); }
+    reverse_iterator       rend()    noexcept        { return reverse_iterator(begin()); }
+    const_reverse_iterator rend()    const noexcept  { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend()   const noexcept  { return rend(); }
+
+    /// @brief 由树中元素的引用得到指向它的迭代器
+    static iterator       iterator_to(reference x) noexcept       { return static_cast<base_ptr>(&x); }
+    static const_iterator iterator_to(const_reference x) noexcept {
+        return const_cast<base_ptr>(static_cast<const hook_type*>(&x));
+    }
+
+public:  // 容量相关操作
+    bool         empty()    const noexcept { return node_count_ == 0; }
+    size_type    size()     const noexcept { return node_count_; }
+    size_type    max_size() const noexcept { return static_cast<size_type>(-1); }
+    key_compare  key_comp() const { return key_comp_; }
+
+public:  // 插入删除相关操作
+    iterator                       insert_multi(reference x);
+    tinystl::pair<iterator, bool>  insert_unique(reference x);
+
+    iterator  erase(const_iterator pos) noexcept;
+    iterator  erase(const_iterator first, const_iterator last) noexcept;
+    size_type erase_multi(const key_type& key);
+    size_type erase_unique(const key_type& key);
+
+    /// @brief 摘下全部元素，O(1)，元素的钩子保持原值
+    void clear() noexcept {
+        reset_header();
+        node_count_ = 0;
+    }
+
+    void swap(intrusive_rb_tree& rhs) noexcept;
+
+public:  // 查找相关操作
+    iterator       find(const key_type& key)        { return iterator(find_node(key)); }
+    const_iterator find(const key_type& key)  const { return const_iterator(find_node(key)); }
+
+    size_type count_multi(const key_type& key) const {
+        auto p = equal_range_multi(key);
+        return static_cast<size_type>(tinystl::distance(p.first, p.second));
+    }
+    size_type count_unique(const key_type& key) const { return find(key) != end() ? 1 : 0; }
+
+    iterator       lower_bound(const key_type& key)       { return iterator(lower_bound_node(key)); }
+    const_iterator lower_bound(const key_type& key) const { return const_iterator(lower_bound_node(key)); }
+    iterator       upper_bound(const key_type& key)       { return iterator(upper_bound_node(key)); }
+    const_iterator upper_bound(const key_type& key) const { return const_iterator(upper_bound_node(key)); }
+
+    tinystl::pair<iterator, iterator> equal_range_multi(const key_type& key) {
+        return tinystl::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+    tinystl::pair<const_iterator, const_iterator> equal_range_multi(const key_type& key) const {
+        return tinystl::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+private:
+    /// @brief header 的指针，const 成员函数也需要它来构造迭代器
+    base_ptr  header()    const noexcept { return const_cast<base_ptr>(&header_); }
+    /// @brief 获取根节点，根节点存放在 header_ 的父指针中
+    base_ptr  root()      const noexcept { return header_.parent(); }
+    void      set_root(base_ptr x) noexcept { header_.set_parent(x); }
+    base_ptr& leftmost()  const noexcept { return header()->left; }
+    base_ptr& rightmost() const noexcept { return header()->right; }
+
+    typedef typename intrusive_key_of<T, KeyOfValue>::result_type key_result;
+
+    /// @brief 取出节点所在元素的键值，KeyOfValue 按值返回时这里也按值返回
+    key_result node_key(base_ptr x) const { return key_of_(static_cast<const_reference>(*x)); }
+
+    /// @brief 置为空树，header_ 为红色，与根节点区分（见 rb_tree_iterator_base::dec）
+    void reset_header() noexcept {
+        header_.reset_parent(nullptr, rb_tree_red);
+        header_.left = header_.right = &header_;
+    }
+
+    base_ptr find_node(const key_type& key) const;
+    base_ptr lower_bound_node(const key_type& key) const;
+    base_ptr upper_bound_node(const key_type& key) const;
+
+    iterator insert_node_at(base_ptr x, base_ptr z, bool add_to_left) noexcept;
+};
+
+// ==================================== 函数实现 ==================================== //
+
+/// @brief 插入元素，键值允许重复，相等的键值插在已有元素之后
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::iterator
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::insert_multi(reference x) {
+    const key_type& k = key_of_(x);
+    base_ptr y = header();
+    base_ptr p = root();
+    bool add_to_left = true;
+    while (p != nullptr) {
+        y = p;
+        add_to_left = key_comp_(k, node_key(p));
+        p = add_to_left ? p->left : p->right;
+    }
+    return insert_node_at(y, static_cast<base_ptr>(&x), add_to_left);
+}
+
+/// @brief 插入元素，键值不允许重复，已有相同键值时返回指向它的迭代器与 false
+template <class T, class KeyOfValue, class Compare, class Tag>
+tinystl::pair<typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::iterator, bool>
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::insert_unique(reference x) {
+    const key_type& k = key_of_(x);
+    base_ptr y = header();
+    base_ptr p = root();
+    bool add_to_left = true;
+    while (p != nullptr) {
+        y = p;
+        add_to_left = key_comp_(k, node_key(p));
+        p = add_to_left ? p->left : p->right;
+    }
+    iterator it(y);  // y 为插入点的父节点
+    if (add_to_left) {
+        if (it == begin())
+            return tinystl::make_pair(insert_node_at(y, static_cast<base_ptr>(&x), true), true);
+        --it;
+    }
+    if (key_comp_(node_key(it.node), k))
+        return tinystl::make_pair(insert_node_at(y, static_cast<base_ptr>(&x), add_to_left), true);
+    return tinystl::make_pair(it, false);
+}
+
+/// @brief 把 z 作为 x 的左（右）子节点链入并重新平衡
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::iterator
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::insert_node_at(base_ptr x, base_ptr z, bool add_to_left) noexcept {
+    z->reset_parent(x, rb_tree_red);
+    z->left = z->right = nullptr;
+    if (x == header()) {
+        set_root(z);
+        leftmost() = z;
+        rightmost() = z;
+    }
+    else if (add_to_left) {
+        x->left = z;
+        if (x == leftmost()) leftmost() = z;
+    }
+    else {
+        x->right = z;
+        if (x == rightmost()) rightmost() = z;
+    }
+    base_ptr r = root();
+    rb_tree_insert_rebalance(z, r);
+    set_root(r);
+    ++node_count_;
+    return iterator(z);
+}
+
+/// @brief 把 pos 处的元素从树中摘下，返回其后继
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::iterator
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::erase(const_iterator pos) noexcept {
+    TINYSTL_DEBUG(pos != end());
+    iterator next(pos.node);
+    ++next;
+    base_ptr r = root();
+    rb_tree_erase_rebalance(pos.node, r, leftmost(), rightmost());
+    set_root(r);
+    --node_count_;
+    return next;
+}
+
+/// @brief 摘下 [first, last) 内的元素
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::iterator
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::erase(const_iterator first, const_iterator last) noexcept {
+    if (first == begin() && last == end()) {
+        clear();
+        return end();
+    }
+    while (first != last) first = erase(first);
+    return iterator(last.node);
+}
+
+/// @brief 摘下键值等于 key 的全部元素，返回摘下的个数
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::size_type
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::erase_multi(const key_type& key) {
+    auto p = equal_range_multi(key);
+    auto n = static_cast<size_type>(tinystl::distance(p.first, p.second));
+    erase(p.first, p.second);
+    return n;
+}
+
+/// @brief 摘下键值等于 key 的元素，返回摘下的个数
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::size_type
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::erase_unique(const key_type& key) {
+    auto it = find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+}
+
+/// @brief 交换两棵树，header 嵌入在对象中，交换后让根节点重新指回各自的 header
+template <class T, class KeyOfValue, class Compare, class Tag>
+void intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::swap(intrusive_rb_tree& rhs) noexcept {
+    if (this == &rhs) return;
+    rb_tree_swap_headers(header_, rhs.header_);
+    tinystl::swap(node_count_, rhs.node_count_);
+    tinystl::swap(key_comp_, rhs.key_comp_);
+    tinystl::swap(key_of_, rhs.key_of_);
+}
+
+/// @brief 查找键值为 key 的节点，找不到时返回 header
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::base_ptr
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::find_node(const key_type& key) const {
+    base_ptr y = lower_bound_node(key);
+    return (y == header() || key_comp_(key, node_key(y))) ? header() : y;
+}
+
+/// @brief 键值不小于 key 的第一个节点
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::base_ptr
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::lower_bound_node(const key_type& key) const {
+    base_ptr y = header();  // 最后一个不小于 key 的节点
+    base_ptr x = root();
+    while (x != nullptr) {
+        if (!key_comp_(node_key(x), key)) {
+            y = x;
+            x = x->left;
+        }
+        else x = x->right;
+    }
+    return y;
+}
+
+/// @brief 键值大于 key 的第一个节点
+template <class T, class KeyOfValue, class Compare, class Tag>
+typename intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::base_ptr
+intrusive_rb_tree<T, KeyOfValue, Compare, Tag>::upper_bound_node(const key_type& key) const {
+    base_ptr y = header();  // 最后一个大于 key 的节点
+    base_ptr x = root();
+    while (x != nullptr) {
+        if (key_comp_(key, node_key(x))) {
+            y = x;
+            x = x->left;
+        }
+        else x = x->right;
+    }
+    return y;
+}
+
+template <class T, class KeyOfValue, class Compare, class Tag>
+void swap(intrusive_rb_tree<T, KeyOfValue, Compare, Tag>& lhs,
+          intrusive_rb_tree<T, KeyOfValue, Compare, Tag>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_INTRUSIVE_RB_TREE_H_
@@ -4,6 +4,19 @@
 // 这个头文件包含了一个模板类 list
 // list : 双向链表
 
+// notes:
+//
+// sort：
+//   * 不构造任何临时 list。先把节点指针收集到一段连续的数组中，对指针数组做稳定的归并排序
+//     （先对每 LIST_SORT_RUN 个元素做插入排序，再自底向上两两归并），最后按数组顺序一次性重新链接
+//   * 节点数不超过 LIST_SORT_STACK_NODES 时数组放在栈上，否则向空间配置器申请一块 2n 个指针的缓冲区
+//   * 排序过程中不修改链表，comp 抛出异常或缓冲区分配失败时 list 保持原样（强异常安全保证）
+//
+// 末尾节点（哨兵）：
+//   * 嵌入在 list 对象中而不是单独分配，构造、移动与析构空 list 都不访问空间配置器，默认构造与移动为 noexcept，
+//     T 也不再需要默认构造函数
+//   * 移动与 swap 由 list_swap_headers 交换哨兵的指针，并把首尾节点重新指回各自的哨兵，被移动的 list 是合法的空 list
+
 #include <initializer_list>
 
 #include "iterator.h"
@@ -14,6 +27,16 @@
 
 namespace tinystl {
 
+// sort 时使用栈上数组的最大节点数
+#ifndef LIST_SORT_STACK_NODES
+#define LIST_SORT_STACK_NODES 64
+#endif
+
+// sort 时先做插入排序的小段长度
+#ifndef LIST_SORT_RUN
+#define LIST_SORT_RUN 16
+#endif
+
 template <class T> struct list_node_base;  // node 的 prev 与 next 指针结构
 template <class T> struct list_node;       // node 的结构，继承自 list_node_base，增加了 data 成员
 
@@ -197,6 +220,51 @@ struct list_const_iterator : public iterator<bidirectional_iterator_tag, T> {
 
 };
 
+// ==================================== 链接操作 ==================================== //
+// 只操作 list_node_base 的指针，list 与 intrusive_list 共用
+
+/// @brief 在 pos 之前连接 [first, last] 区间内的节点
+template <class T>
+void list_link_nodes(list_node_base<T>* pos, list_node_base<T>* first, list_node_base<T>* last) noexcept {
+    pos->prev->next = first;
+    first->prev = pos->prev;
+    pos->prev = last;
+    last->next = pos;
+}
+
+/// @brief 断开链表与 [first, last] 之间的部分的连接
+template <class T>
+void list_unlink_nodes(list_node_base<T>* first, list_node_base<T>* last) noexcept {
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+}
+
+/// @brief 交换两个嵌入在容器对象中的头节点，并让首尾节点重新指回各自的头节点
+template <class T>
+void list_swap_headers(list_node_base<T>& a, list_node_base<T>& b) noexcept {
+    tinystl::swap(a.prev, b.prev);
+    tinystl::swap(a.next, b.next);
+    // 空链表的头节点原本指向自身，交换后指向对方
+    if (a.next == &b) a.unlink();
+    else a.next->prev = a.prev->next = &a;
+    if (b.next == &a) b.unlink();
+    else b.next->prev = b.prev->next = &b;
+}
+
+/// @brief 将 [first, last) 内的节点移动到 pos 之前，[first, last) 可以来自另一个链表
+template <class T>
+void list_transfer(list_node_base<T>* pos, list_node_base<T>* first, list_node_base<T>* last) noexcept {
+    if (pos != last) {
+        last->prev->next = pos;          // (1) 将 last 之前的节点与 pos 连接
+        first->prev->next = last;        // (2) 将 first 之前的节点与 last 连接
+        pos->prev->next = first;         // (3) 将 pos 之前的节点与 first 连接
+        auto tmp = pos->prev;            // (4) 存储 pos 之前的节点
+        pos->prev = last->prev;          // (5) 将 pos 之前的节点与 last 之前的节点连接
+        last->prev = first->prev;        // (6) 将 last 之前的节点与 first 之前的节点连接
+        first->prev = tmp;               // (7) 将 first 之前的节点与 pos 之前的节点连接
+    }
+}
+
 
 // ==================================== list 结构 ==================================== //
 // SGI-STL 中的 list 为双向环形链表，其中尾节点为空节点，头节点为尾节点的前一个节点
@@ -213,7 +281,6 @@ public:
 
     typedef simple_alloc<T, Alloc>                    allocator_type;
     typedef simple_alloc<T, Alloc>                    data_allocator;
-    typedef simple_alloc<list_node_base<T>, Alloc>    base_allocator;
     typedef simple_alloc<list_node<T>, Alloc>         node_allocator;
 
     // typedef typename allocator_type::T                value_type;
@@ -244,12 +311,12 @@ public:
 
 private:
     
-    base_ptr node_;  // 指向末尾节点
-    size_type size_; // list 的大小
+    list_node_base<T> node_;  // 嵌入的末尾节点（哨兵），空 list 不需要分配内存
+    size_type size_;          // list 的大小
 
 public:  // 构造、复制、移动、析构函数
     
-    list() { fill_init(0, value_type()); }
+    list() noexcept : size_(0) { node_.unlink(); }
 
     explicit list(size_type n) { fill_init(n, value_type()); }
 
@@ -263,9 +330,9 @@ public:  // 构造、复制、移动、析构函数
 
     list(const list& x) { copy_init(x.cbegin(), x.cend()); }
 
-    list(list&& x) noexcept : node_(x.node_), size_(x.size_) {
-        x.node_ = nullptr;
-        x.size_ = 0;
+    list(list&& x) noexcept : size_(0) {
+        node_.unlink();
+        swap(x);
     }
 
     list& operator=(const list& x) {
@@ -285,26 +352,19 @@ public:  // 构造、复制、移动、析构函数
         return *this;
     }
 
-    ~list() {
-        if (node_ != nullptr) {
-            clear();
-            base_allocator::deallocate(node_);
-            node_ = nullptr;
-            size_ = 0;
-        }
-    }
+    ~list() { clear(); }
 
 public: // 迭代器相关操作
 
-    iterator               begin()   noexcept        { return node_->next; }
-    const_iterator         begin()   const noexcept  { return node_->next; }
+    iterator               begin()   noexcept        { return node_.next; }
+    const_iterator         begin()   const noexcept  { return node_.next; }
     const_iterator         cbegin()  const noexcept  { return begin(); }
     reverse_iterator       rbegin()  noexcept        { return reverse_iterator(end()); }
     const_reverse_iterator rbegin()  const noexcept  { return const_reverse_iterator(end()); }
     const_reverse_iterator crbegin() const noexcept  { return rbegin(); }
 
-    iterator               end()     noexcept        { return node_; }
-    const_iterator         end()     const noexcept  { return node_; }
+    iterator               end()     noexcept        { return header(); }
+    const_iterator         end()     const noexcept  { return header(); }
     const_iterator         cend()    const noexcept  { return end(); }
     reverse_iterator       rend()    noexcept        { return reverse_iterator(begin()); }
     const_reverse_iterator rend()    const noexcept  { return const_reverse_iterator(begin()); }
@@ -312,7 +372,7 @@ public: // 迭代器相关操作
 
 public: // 容量相关操作
 
-    bool      empty()    const noexcept  { return node_->next == node_; }
+    bool      empty()    const noexcept  { return node_.next == header(); }
     size_type size()     const noexcept  { return size_; }
     size_type max_size() const noexcept  { return static_cast<size_type>(-1); }
 
@@ -455,7 +515,7 @@ public: // 调整元素容器相关操作
 
     void pop_front() {
         TINYSTL_DEBUG(!empty());
-        auto del_node = node_->next;
+        auto del_node = node_.next;
         unlink_nodes(del_node, del_node);
         destroy_node(del_node->as_node());
         --size_;
@@ -463,7 +523,7 @@ public: // 调整元素容器相关操作
 
     void pop_back() {
         TINYSTL_DEBUG(!empty());
-        auto del_node = node_->prev;
+        auto del_node = node_.prev;
         unlink_nodes(del_node, del_node);
         destroy_node(del_node->as_node());
         --size_;
@@ -485,7 +545,7 @@ public: // 调整元素容器相关操作
     // swap
 
     void swap(list& x) noexcept {
-        tinystl::swap(node_, x.node_);
+        tinystl::list_swap_headers(node_, x.node_);
         tinystl::swap(size_, x.size_);
     }
 
@@ -523,6 +583,9 @@ public:  // list 相关操作
 
 private:  // 辅助函数
 
+    /// @brief 末尾节点的指针，const 成员函数也需要它来构造迭代器
+    base_ptr header() const noexcept { return const_cast<base_ptr>(&node_); }
+
     // create_node / destroy_node
 
     template <class ...Args>
@@ -564,6 +627,18 @@ private:  // 辅助函数
     template <class Compare>
     void list_sort(Compare comp);
 
+    template <class Compare>
+    static base_ptr* sort_nodes(base_ptr* first, size_type n, base_ptr* buf, Compare& comp);
+
+    template <class Compare>
+    static void insertion_sort_nodes(base_ptr* first, base_ptr* last, Compare& comp);
+
+    template <class Compare>
+    static void merge_nodes(base_ptr* first1, base_ptr* last1, base_ptr* first2, base_ptr* last2,
+                            base_ptr* result, Compare& comp);
+
+    void relink_nodes(base_ptr* first, base_ptr* last);
+
 };
 
 
@@ -610,11 +685,11 @@ list<T, Alloc>::erase(const_iterator first, const_iterator last) {
 template <class T, class Alloc>
 void list<T, Alloc>::clear() {
     if (size_ != 0) {
-        auto cur = node_->next;
-        for (base_ptr next = cur->next; cur != node_; cur = next, next = cur->next) {
+        auto cur = node_.next;
+        for (base_ptr next = cur->next; cur != header(); cur = next, next = cur->next) {
             destroy_node(cur->as_node());
         }
-        node_->unlink();
+        node_.unlink();
         size_ = 0;
     }
 }
@@ -632,24 +707,16 @@ void list<T, Alloc>::resize(size_type new_size, const value_type& value) {
     }
     // 跳出循环后只有两种情况
     // 1. 遍历到 new_size 个元素，此时需要删除后面的元素
-    if (len == new_size) erase(i, node_);
+    if (len == new_size) erase(i, header());
     // 2. 遍历到 end()，此时需要在尾部插入元素
-    else insert(node_, new_size - len, value);
+    else insert(header(), new_size - len, value);
 
 }
 
-// TODO: 注释
+/// @brief 将 [first, last) 内的节点移动到 pos 之前，见 list_transfer
 template <class T, class Alloc>
 void list<T, Alloc>::transfer(const_iterator pos, const_iterator first, const_iterator last) {
-    if (pos != last) {
-        last.node_->prev->next = pos.node_;        // (1) 将 last 之前的节点与 pos 连接
-        first.node_->prev->next = last.node_;      // (2) 将 first 之前的节点与 last 连接
-        pos.node_->prev->next = first.node_;       // (3) 将 pos 之前的节点与 first 连接
-        auto tmp = pos.node_->prev;                // (4) 存储 pos 之前的节点
-        pos.node_->prev = last.node_->prev;        // (5) 将 pos 之前的节点与 last 之前的节点连接
-        last.node_->prev = first.node_->prev;      // (6) 将 last 之前的节点与 first 之前的节点连接
-        first.node_->prev = tmp;                   // (7) 将 first 之前的节点与 pos 之前的节点连接
-    }
+    tinystl::list_transfer(pos.node_, first.node_, last.node_);
 }
 
 /// @brief 将 x 合并到 pos 之前
@@ -832,7 +899,7 @@ void list<T, Alloc>::reverse() noexcept {
     // }
     // tinystl::swap(e.node_->prev, e.node_->next);
 
-    if (node_->next == node_ || node_->next->next == node_) return;
+    if (node_.next == header() || node_.next->next == header()) return;
     auto first = begin();
     ++first;
     while (first != end()) {
@@ -883,8 +950,7 @@ void list<T, Alloc>::destroy_node(node_ptr p) {
 /// @param value  初始化的元素值
 template <class T, class Alloc>
 void list<T, Alloc>::fill_init(size_type n, const value_type& value) {
-    node_ = base_allocator::allocate(1);
-    node_->unlink();
+    node_.unlink();
     size_ = n;
     try {
         for (; n > 0; --n) {
@@ -894,8 +960,6 @@ void list<T, Alloc>::fill_init(size_type n, const value_type& value) {
     }
     catch (...) {
         clear();
-        base_allocator::deallocate(node_);
-        node_ = nullptr;
         throw;
     }
 }
@@ -907,8 +971,7 @@ void list<T, Alloc>::fill_init(size_type n, const value_type& value) {
 template <class T, class Alloc>
 template <class Iter>
 void list<T, Alloc>::copy_init(Iter first, Iter last) {
-    node_ = base_allocator::allocate(1);
-    node_->unlink();
+    node_.unlink();
     size_type n = tinystl::distance(first, last);
     size_ = n;
     try {
@@ -919,8 +982,6 @@ void list<T, Alloc>::copy_init(Iter first, Iter last) {
     }
     catch (...) {
         clear();
-        base_allocator::deallocate(node_);
-        node_ = nullptr;
         throw;
     }
 }
@@ -933,8 +994,8 @@ void list<T, Alloc>::copy_init(Iter first, Iter last) {
 template <class T, class Alloc>
 typename list<T, Alloc>::iterator
 list<T, Alloc>::link_iter_node(const_iterator pos, base_ptr node) {
-    if (pos == node_->next) link_nodes_at_front(node, node);
-    else if (pos == node_) link_nodes_at_back(node, node);
+    if (pos == node_.next) link_nodes_at_front(node, node);
+    else if (pos == header()) link_nodes_at_back(node, node);
     else link_nodes(pos.node_, node, node);
     return iterator(node);
 }
@@ -946,10 +1007,7 @@ list<T, Alloc>::link_iter_node(const_iterator pos, base_ptr node) {
 /// @param last  连接的结束位置
 template <class T, class Alloc>
 void list<T, Alloc>::link_nodes(base_ptr pos, base_ptr first, base_ptr last) {
-    pos->prev->next = first;
-    first->prev = pos->prev;
-    pos->prev = last;
-    last->next = pos;
+    tinystl::list_link_nodes(pos, first, last);
 }
 
 /// @brief 在 list 的头部连接 [first, last] 区间内的节点
@@ -959,11 +1017,11 @@ void list<T, Alloc>::link_nodes(base_ptr pos, base_ptr first, base_ptr last) {
 template <class T, class Alloc>
 void list<T, Alloc>::link_nodes_at_front(base_ptr first, base_ptr last) {
     // 将新的链表加入
-    first->prev = node_;
-    last->next = node_->next;
+    first->prev = header();
+    last->next = node_.next;
     // 断开原有连接
-    node_->next->prev = last;
-    node_->next = first;
+    node_.next->prev = last;
+    node_.next = first;
 }
 
 /// @brief 在 list 的尾部连接 [first, last] 区间内的节点
@@ -973,11 +1031,11 @@ void list<T, Alloc>::link_nodes_at_front(base_ptr first, base_ptr last) {
 template <class T, class Alloc>
 void list<T, Alloc>::link_nodes_at_back(base_ptr first, base_ptr last) {
     // 将新的链表加入
-    first->prev = node_->prev;
-    last->next = node_;
+    first->prev = node_.prev;
+    last->next = header();
     // 断开原有连接
-    node_->prev->next = first;
-    node_->prev = last;
+    node_.prev->next = first;
+    node_.prev = last;
 }
 
 /// @brief 断开链表与 [first, last] 之间的部分的连接 
@@ -986,8 +1044,7 @@ void list<T, Alloc>::link_nodes_at_back(base_ptr first, base_ptr last) {
 /// @param last 
 template <class T, class Alloc>
 void list<T, Alloc>::unlink_nodes(base_ptr first, base_ptr last) {
-    first->prev->next = last->next;
-    last->next->prev = first->prev;
+    tinystl::list_unlink_nodes(first, last);
 }
 
 /// @brief 用 n 个 value 为容器赋值
@@ -1100,51 +1157,97 @@ list<T, Alloc>::copy_insert(const_iterator pos, size_type n, Iter first) {
     return r;
 }
 
+/// @brief 按 comp 对 list 做稳定排序，只重新链接节点，不移动元素
+/// @tparam Compare  比较函数对象
 template <class T, class Alloc>
 template <class Compare>
 void list<T, Alloc>::list_sort(Compare comp) {
-    if (node_->next == node_ || node_->next->next == node_) return;
-
-    // 一些新的 lists 用于存储分割后的 lists
-    list<T, Alloc> carry;
-    list<T, Alloc> counter[64];  // 缓存表，第 i 层 list 存储长度为 2^i
-    int fill = 0;         // 记录最深层数，counter[fill] 为空
-
-    while (!empty()) {
-        // 运行到此处 carry 必然为空，因此一定可以处理下一个元素
-        // 1. 将当前 list 的头部元素取出，放入 carry 中
-        carry.splice(carry.begin(), *this, begin());
-        int i = 0;  // 记录经过的层数
-        
-        // 2. 从小往大不断合并非空层直至遇到空层或者到达当前最大归并层次
-        // 出这个循环，无论 i 是否超过最大层，counter[i] 必然是空的
-        // !counter[i].empty() 决定了 counter[i] 中存放的 list 的长度为 2^i
-        while (i < fill && !counter[i].empty()) {
-            // 将 carry 的元素与 counter[i] 的元素按顺序合并
-            counter[i].merge(carry, comp);
-            // 将合并后的结果放入 carry 中，i + 1，继续下一层的合并
-            // 这里使用了一些小技巧，实际上相当于：
-            // carry.swap(counter[i]);
-            // ++i;
-            carry.swap(counter[i++]);
-        }
+    if (node_.next == header() || node_.next->next == header()) return;
+
+    typedef simple_alloc<base_ptr, Alloc> buffer_allocator;
+
+    // 前一半存放节点指针，后一半作为归并时的辅助空间
+    base_ptr  stack_buf[2 * LIST_SORT_STACK_NODES];
+    const size_type n = size_;
+    base_ptr* buf = n <= LIST_SORT_STACK_NODES ? stack_buf : buffer_allocator::allocate(2 * n);
 
-        // 3. 将合并出的结果放入下一层中
-        // 根据上面循环的退出条件，count[i]必然是空的，
-        // 这里相当于将 carry 中归并的结果放入下一层，由于经过了 swap，因此 carry 必然为空
-        carry.swap(counter[i]);
+    auto p = buf;
+    for (auto cur = node_.next; cur != header(); cur = cur->next) *p++ = cur;
 
-        // 如果 i == fill，说明当前层是最大层，需要增加一层
-        if (i == fill) ++fill;
+    try {
+        auto sorted = sort_nodes(buf, n, buf + n, comp);
+        relink_nodes(sorted, sorted + n);
     }
+    catch (...) {
+        if (buf != stack_buf) buffer_allocator::deallocate(buf, 2 * n);
+        throw;
+    }
+    if (buf != stack_buf) buffer_allocator::deallocate(buf, 2 * n);
+}
 
-    // 将每一层的 list 依次合并，每一层保证有序
-    for (int i = 1; i < fill; ++i) {
-        counter[i].merge(counter[i - 1], comp);
+/// @brief 对 [first, first + n) 内的节点指针做稳定的归并排序，buf 为同样大小的辅助空间
+/// @return  返回存放结果的数组，为 first 或 buf
+template <class T, class Alloc>
+template <class Compare>
+typename list<T, Alloc>::base_ptr*
+list<T, Alloc>::sort_nodes(base_ptr* first, size_type n, base_ptr* buf, Compare& comp) {
+    const size_type run = LIST_SORT_RUN;
+    for (size_type lo = 0; lo < n; lo += run) {
+        insertion_sort_nodes(first + lo, first + tinystl::min(lo + run, n), comp);
+    }
+    // 自底向上归并，每一趟在 src 与 dst 之间交替
+    base_ptr* src = first;
+    base_ptr* dst = buf;
+    for (size_type width = run; width < n; width *= 2) {
+        for (size_type lo = 0; lo < n; lo += 2 * width) {
+            const size_type mid = tinystl::min(lo + width, n);
+            const size_type hi = tinystl::min(lo + 2 * width, n);
+            merge_nodes(src + lo, src + mid, src + mid, src + hi, dst + lo, comp);
+        }
+        tinystl::swap(src, dst);
     }
+    return src;
+}
 
-    // 将最终的结果交换到当前 list 中
-    swap(counter[fill - 1]);
+/// @brief 对 [first, last) 内的节点指针按节点的值做插入排序，相等的元素保持原有次序
+template <class T, class Alloc>
+template <class Compare>
+void list<T, Alloc>::insertion_sort_nodes(base_ptr* first, base_ptr* last, Compare& comp) {
+    if (first == last) return;
+    for (auto i = first + 1; i != last; ++i) {
+        auto node = *i;
+        auto j = i;
+        for (; j != first && comp(node->as_node()->data, (*(j - 1))->as_node()->data); --j) {
+            *j = *(j - 1);
+        }
+        *j = node;
+    }
+}
+
+/// @brief 把两段有序的节点指针归并到 result 开始处，相等时优先取第一段
+template <class T, class Alloc>
+template <class Compare>
+void list<T, Alloc>::merge_nodes(base_ptr* first1, base_ptr* last1, base_ptr* first2, base_ptr* last2,
+                                 base_ptr* result, Compare& comp) {
+    while (first1 != last1 && first2 != last2) {
+        if (comp((*first2)->as_node()->data, (*first1)->as_node()->data)) *result++ = *first2++;
+        else *result++ = *first1++;
+    }
+    while (first1 != last1) *result++ = *first1++;
+    while (first2 != last2) *result++ = *first2++;
+}
+
+/// @brief 按 [first, last) 中的顺序重新链接全部节点
+template <class T, class Alloc>
+void list<T, Alloc>::relink_nodes(base_ptr* first, base_ptr* last) {
+    base_ptr prev = header();
+    for (; first != last; ++first) {
+        prev->next = *first;
+        (*first)->prev = prev;
+        prev = *first;
+    }
+    prev->next = header();
+    node_.prev = prev;
 }
 
 // ==================================== 重载比较操作符 ==================================== //
@@ -23,7 +23,8 @@ namespace tinystl {
 /// @tparam Key  键值类型
 /// @tparam T  实值类型
 /// @tparam Compare  键值比较方式，缺省使用 tinystl::less
-template <class Key, class T, class Compare = tinystl::less<Key>>
+/// @tparam Alloc  节点的空间配置器，缺省使用 tinystl::alloc
+template <class Key, class T, class Compare = tinystl::less<Key>, class Alloc = alloc>
 class map {
 
 public:  // map 的嵌套型别定义
@@ -34,7 +35,7 @@ public:  // map 的嵌套型别定义
 
 public:  // 用于比较两个元素的仿函数
     class value_compare : public tinystl::binary_function<value_type, value_type, bool> {
-        friend class map<Key, T, Compare>;
+        friend class map<Key, T, Compare, Alloc>;
     private:
         Compare comp;
         value_compare(Compare c) : comp(c) {}
@@ -45,7 +46,7 @@ public:  // 用于比较两个元素的仿函数
     };
 
 private:  // 以 tinystl::rb_tree 作为底层机制
-    typedef tinystl::rb_tree<value_type, key_compare> base_type;
+    typedef tinystl::rb_tree<value_type, key_compare, Alloc> base_type;
     base_type tree_;  // 底层红黑树
 
 public:  // 使用 rb_tree 定义的型别
@@ -231,39 +232,39 @@ public:
 
 // 重载比较操作符
 
-template <class Key, class T, class Compare>
-bool operator==(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return lhs == rhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator<(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return lhs < rhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator!=(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class Key, class T, class Compare>
-bool operator>(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return rhs < lhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator<=(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return !(rhs < lhs);
 }
 
-template <class Key, class T, class Compare>
-bool operator>=(const map<Key, T, Compare>& lhs, const map<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
     return !(lhs < rhs);
 }
 
 // 重载 swap
-template <class Key, class T, class Compare>
-void swap(map<Key, T, Compare>& lhs, map<Key, T, Compare>& rhs) noexcept {
+template <class Key, class T, class Compare, class Alloc>
+void swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
@@ -274,7 +275,8 @@ void swap(map<Key, T, Compare>& lhs, map<Key, T, Compare>& rhs) noexcept {
 /// @tparam Key  键值类型
 /// @tparam T  实值类型
 /// @tparam Compare  键值比较方式，缺省使用 tinystl::less
-template <class Key, class T, class Compare = tinystl::less<Key>>
+/// @tparam Alloc  节点的空间配置器，缺省使用 tinystl::alloc
+template <class Key, class T, class Compare = tinystl::less<Key>, class Alloc = alloc>
 class multimap {
 
 public:  // multimap 的嵌套型别定义
@@ -285,7 +287,7 @@ public:  // multimap 的嵌套型别定义
 
 public:  // 用于比较两个元素的仿函数
     class value_compare : public tinystl::binary_function<value_type, value_type, bool> {
-        friend class multimap<Key, T, Compare>;
+        friend class multimap<Key, T, Compare, Alloc>;
     private:
         Compare comp;
         value_compare(Compare c) : comp(c) {}
@@ -296,7 +298,7 @@ public:  // 用于比较两个元素的仿函数
     };
 
 private:  // 以 tinystl::rb_tree 作为底层机制
-    typedef tinystl::rb_tree<value_type, key_compare> base_type;
+    typedef tinystl::rb_tree<value_type, key_compare, Alloc> base_type;
     base_type tree_;  // 底层红黑树
 
 public:  // 使用 rb_tree 定义的型别
@@ -442,39 +444,39 @@ public:
 
 // 重载比较操作符
 
-template <class Key, class T, class Compare>
-bool operator==(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator==(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return lhs == rhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator<(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator<(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return lhs < rhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator!=(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator!=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class Key, class T, class Compare>
-bool operator>(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator>(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return rhs < lhs;
 }
 
-template <class Key, class T, class Compare>
-bool operator<=(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator<=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return !(rhs < lhs);
 }
 
-template <class Key, class T, class Compare>
-bool operator>=(const multimap<Key, T, Compare>& lhs, const multimap<Key, T, Compare>& rhs) {
+template <class Key, class T, class Compare, class Alloc>
+bool operator>=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs) {
     return !(lhs < rhs);
 }
 
 // 重载 swap
-template <class Key, class T, class Compare>
-void swap(multimap<Key, T, Compare>& lhs, multimap<Key, T, Compare>& rhs) noexcept {
+template <class Key, class T, class Compare, class Alloc>
+void swap(multimap<Key, T, Compare, Alloc>& lhs, multimap<Key, T, Compare, Alloc>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
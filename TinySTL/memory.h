@@ -69,7 +69,8 @@ private:
 
 template <class ForwardIterator, class T>
 temporary_buffer<ForwardIterator, T>::
-temporary_buffer(ForwardIterator first, ForwardIterator last) {
+temporary_buffer(ForwardIterator first, ForwardIterator last)
+    : original_len(0), len(0), buffer(nullptr) {
     try {
         len = tinystl::distance(first, last);
         allocate_buffer();
@@ -77,7 +78,7 @@ temporary_buffer(ForwardIterator first, ForwardIterator last) {
             initialize_buffer(*first, std::is_trivially_default_constructible<T>());
         }
     } catch (...) {
-        free(buffer);
+        free(buffer);  // 尚未分配时 buffer 为 nullptr，free 为空操作
         buffer = nullptr;
         len = 0;
     }
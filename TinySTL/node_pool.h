@@ -0,0 +1,253 @@
+#ifndef TINYSTL_NODE_POOL_H_
+#define TINYSTL_NODE_POOL_H_
+
+// 这个头文件包含一个模板类 node_pool 和一个空间配置器 pool_alloc
+// node_pool  : 定长节点内存池，从大块 slab 中切分节点，slab 完全空闲时归还给系统
+// pool_alloc : 以 node_pool 为基础的空间配置器，可作为 list / rb_tree 等节点式容器的 Alloc 参数
+
+// notes:
+//
+// alloc 把所有类型的小区块按 8 字节粒度混在同一组 free-lists 中，并且从不归还内存。
+// pool_alloc 为每一种节点类型（按大小与对齐区分）维护一个独立的 node_pool：
+//   * 每个 slab 大小为 NODE_POOL_SLAB_SIZE 且按此对齐，由节点地址即可找到它所属的 slab
+//   * 每个 slab 有自己的侵入式 free-list 和一段未切分的区域，分配与回收节点只需几次指针操作
+//   * 同一类型的节点集中在少数几个 slab 中，遍历容器时的局部性更好
+//   * 完全空闲的 slab 最多缓存 NODE_POOL_MAX_EMPTY 个，超出的立即归还给系统，
+//     也可以调用 node_pool::trim() 主动归还全部空闲 slab
+//
+// 与 alloc 一样，这里不考虑多线程情况
+
+#include <new>        // std::bad_alloc
+#include <cstddef>    // size_t
+#include <cstdint>    // uintptr_t
+
+#include "allocator.h"
+#include "alloc.h"
+
+namespace tinystl {
+
+enum { NODE_POOL_SLAB_SIZE = 64 * 1024 };  // 每个 slab 的大小，同时也是 slab 的对齐边界
+enum { NODE_POOL_MIN_NODES = 8 };          // 一个 slab 至少能切出的节点数，否则直接使用 allocator
+enum { NODE_POOL_MAX_EMPTY = 16 };         // 每个池最多缓存的空闲 slab 个数
+
+/// @brief 申请一块大小与对齐均为 NODE_POOL_SLAB_SIZE 的内存
+inline void* slab_allocate() {
+    return aligned_allocate(NODE_POOL_SLAB_SIZE, NODE_POOL_SLAB_SIZE);
+}
+
+inline void slab_deallocate(void* p) {
+    aligned_deallocate(p);
+}
+
+// ========================================= node_pool ========================================= //
+
+/// @brief 定长节点内存池，所有成员均为静态，每一种 <NodeSize, NodeAlign> 组合对应一个独立的池
+/// @tparam NodeSize  节点大小
+/// @tparam NodeAlign  节点的对齐要求
+template <size_t NodeSize, size_t NodeAlign>
+class node_pool {
+
+private:
+    // 空闲节点复用自身的空间保存 next 指针
+    struct free_node {
+        free_node* next;
+    };
+
+    // slab 头部，位于 slab 的起始位置
+    struct slab {
+        slab*      prev;     // partial 链表中的前一个 slab
+        slab*      next;     // partial 链表中的后一个 slab
+        free_node* free;     // 本 slab 中已回收的节点
+        char*      bump;     // 尚未切分区域的起始位置
+        size_t     live;     // 已分配出去的节点个数
+        bool       partial;  // 是否位于 partial 链表中
+    };
+
+public:
+    static constexpr size_t node_align = NodeAlign > alignof(free_node) ? NodeAlign : alignof(free_node);
+    static constexpr size_t node_size =
+        ((NodeSize > sizeof(free_node) ? NodeSize : sizeof(free_node)) + node_align - 1) & ~(node_align - 1);
+    static constexpr size_t header_size = (sizeof(slab) + node_align - 1) & ~(node_align - 1);
+    static constexpr size_t nodes_per_slab =
+        header_size >= NODE_POOL_SLAB_SIZE ? 0 : (NODE_POOL_SLAB_SIZE - header_size) / node_size;
+    static constexpr bool   use_slab = nodes_per_slab >= NODE_POOL_MIN_NODES;
+
+private:
+    static slab*  partial_;     // 尚有空闲节点的 slab 组成的双向链表，分配总是从表头取
+    static size_t slab_count_;  // 当前持有的 slab 个数
+    static size_t empty_count_; // 其中完全空闲的 slab 个数
+
+public:
+    static void*  allocate();
+    static void   deallocate(void* p);
+    static void   trim();
+
+    static size_t slab_count() { return slab_count_; }
+
+private:
+    static slab*  new_slab();
+    static void   push_front(slab* s);
+    static void   unlink(slab* s);
+    static slab*  slab_of(void* p) {
+        return reinterpret_cast<slab*>(
+            reinterpret_cast<uintptr_t>(p) & ~static_cast<uintptr_t>(NODE_POOL_SLAB_SIZE - 1));
+    }
+};
+
+template <size_t NodeSize, size_t NodeAlign>
+constexpr size_t node_pool<NodeSize, NodeAlign>::node_align;
+
+template <size_t NodeSize, size_t NodeAlign>
+constexpr size_t node_pool<NodeSize, NodeAlign>::node_size;
+
+template <size_t NodeSize, size_t NodeAlign>
+constexpr size_t node_pool<NodeSize, NodeAlign>::header_size;
+
+template <size_t NodeSize, size_t NodeAlign>
+constexpr size_t node_pool<NodeSize, NodeAlign>::nodes_per_slab;
+
+template <size_t NodeSize, size_t NodeAlign>
+constexpr bool node_pool<NodeSize, NodeAlign>::use_slab;
+
+template <size_t NodeSize, size_t NodeAlign>
+typename node_pool<NodeSize, NodeAlign>::slab* node_pool<NodeSize, NodeAlign>::partial_ = nullptr;
+
+template <size_t NodeSize, size_t NodeAlign>
+size_t node_pool<NodeSize, NodeAlign>::slab_count_ = 0;
+
+template <size_t NodeSize, size_t NodeAlign>
+size_t node_pool<NodeSize, NodeAlign>::empty_count_ = 0;
+
+/// @brief 分配一个节点：优先复用 free-list 中的节点，其次从未切分区域切出一个
+template <size_t NodeSize, size_t NodeAlign>
+void* node_pool<NodeSize, NodeAlign>::allocate() {
+    if (!use_slab) return allocator<char, NodeAlign>::allocate(NodeSize);
+
+    slab* s = partial_;
+    if (s == nullptr) s = new_slab();
+    else if (s->live == 0) --empty_count_;
+
+    void* p;
+    if (s->free != nullptr) {
+        p = s->free;
+        s->free = s->free->next;
+    }
+    else {
+        p = s->bump;
+        s->bump += node_size;
+    }
+    // slab 已满，移出 partial 链表，直到有节点被回收
+    if (++s->live == nodes_per_slab) unlink(s);
+    return p;
+}
+
+/// @brief 回收一个节点，若其所属的 slab 因此完全空闲且空闲 slab 已缓存足够多，则归还给系统
+template <size_t NodeSize, size_t NodeAlign>
+void node_pool<NodeSize, NodeAlign>::deallocate(void* p) {
+    if (p == nullptr) return;
+    if (!use_slab) {
+        allocator<char, NodeAlign>::deallocate(static_cast<char*>(p));
+        return;
+    }
+
+    slab* s = slab_of(p);
+    free_node* n = static_cast<free_node*>(p);
+    n->next = s->free;
+    s->free = n;
+    if (!s->partial) push_front(s);
+
+    if (--s->live == 0) {
+        if (empty_count_ < NODE_POOL_MAX_EMPTY) {
+            ++empty_count_;
+        }
+        else {
+            unlink(s);
+            slab_deallocate(s);
+            --slab_count_;
+        }
+    }
+}
+
+/// @brief 将缓存的空闲 slab 全部归还给系统
+template <size_t NodeSize, size_t NodeAlign>
+void node_pool<NodeSize, NodeAlign>::trim() {
+    slab* s = partial_;
+    while (s != nullptr) {
+        slab* next = s->next;
+        if (s->live == 0) {
+            unlink(s);
+            slab_deallocate(s);
+            --slab_count_;
+        }
+        s = next;
+    }
+    empty_count_ = 0;
+}
+
+/// @brief 申请一个新的 slab 并放到 partial 链表头部
+template <size_t NodeSize, size_t NodeAlign>
+typename node_pool<NodeSize, NodeAlign>::slab* node_pool<NodeSize, NodeAlign>::new_slab() {
+    slab* s = static_cast<slab*>(slab_allocate());
+    s->prev = s->next = nullptr;
+    s->free = nullptr;
+    s->bump = reinterpret_cast<char*>(s) + header_size;
+    s->live = 0;
+    s->partial = false;
+    push_front(s);
+    ++slab_count_;
+    return s;
+}
+
+template <size_t NodeSize, size_t NodeAlign>
+void node_pool<NodeSize, NodeAlign>::push_front(slab* s) {
+    s->prev = nullptr;
+    s->next = partial_;
+    if (partial_ != nullptr) partial_->prev = s;
+    partial_ = s;
+    s->partial = true;
+}
+
+template <size_t NodeSize, size_t NodeAlign>
+void node_pool<NodeSize, NodeAlign>::unlink(slab* s) {
+    if (s->prev != nullptr) s->prev->next = s->next;
+    else partial_ = s->next;
+    if (s->next != nullptr) s->next->prev = s->prev;
+    s->prev = s->next = nullptr;
+    s->partial = false;
+}
+
+// ========================================= pool_alloc ========================================= //
+
+/// @brief 节点池空间配置器，仅作为 simple_alloc 的标签使用，例如 tinystl::list<int, tinystl::pool_alloc>
+//  单个对象从 node_pool<sizeof(T), alignof(T)> 中分配，多个对象的连续空间直接使用 allocator<T>
+class pool_alloc {};
+
+template <class T>
+class simple_alloc<T, pool_alloc> {
+private:
+    typedef node_pool<sizeof(T), alignof(T)> pool;
+
+public:
+    static T* allocate(size_t n) {
+        if (n == 0) return 0;
+        return n == 1 ? static_cast<T*>(pool::allocate())
+                      : allocator<T>::allocate(n);
+    }
+
+    static T* allocate(void) {
+        return static_cast<T*>(pool::allocate());
+    }
+
+    static void deallocate(T* p, size_t n) {
+        if (n == 1) pool::deallocate(p);
+        else if (n != 0) allocator<T>::deallocate(p, n);
+    }
+
+    static void deallocate(T* p) {
+        pool::deallocate(p);
+    }
+};
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_NODE_POOL_H_
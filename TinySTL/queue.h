@@ -14,6 +14,7 @@ namespace tinystl {
 
 // 模板类 queue
 // 参数一代表数据类型，参数二代表底层容器类型，缺省使用 deque 作为底层容器
+// 只做 FIFO 时可用 ring_buffer<T>（见 ring_buffer.h）作为底层容器，push / pop 只是一次按位与和一次自增
 template <class T, class Container = tinystl::deque<T>>
 class queue {
 
@@ -136,14 +137,17 @@ void swap(queue<T, Container>& lhs, queue<T, Container>& rhs) noexcept(noexcept(
 // 模板类 priority_queue
 // 参数一代表数据类型，参数二代表容器类型，缺省使用 mystl::vector 作为底层容器
 // 参数三代表比较权值的方式，缺省使用 mystl::less 作为比较方式
+// 参数四代表堆算法的策略，缺省使用二叉堆，dary_heap_policy<4> / dary_heap_policy<8> 使用 D 叉堆
 
 template <class T, class Container = tinystl::vector<T>,
-          class Compare = tinystl::less<typename Container::value_type>>
+          class Compare = tinystl::less<typename Container::value_type>,
+          class HeapPolicy = tinystl::binary_heap_policy>
 class priority_queue {
 
 public:
     typedef Container                           container_type;
     typedef Compare                             value_compare;
+    typedef HeapPolicy                          heap_policy;
     // 使用底层容器的型别
     typedef typename Container::value_type      value_type;
     typedef typename Container::size_type       size_type;
@@ -159,53 +163,37 @@ private:
 public:  // 构造、复制、移动函数
     priority_queue() = default;
     priority_queue(const Compare& c) : c_(), comp_(c) {}
-    explicit priority_queue(size_type n) : c_(n) { tinystl::make_heap(c_.begin(), c_.end(), comp_); }
+    explicit priority_queue(size_type n) : c_(n) { heap_policy::make_heap(c_.begin(), c_.end(), comp_); }
     priority_queue(size_type n, const value_type& value) : c_(n, value) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
     }
 
     template <class InputIterator>
     priority_queue(InputIterator first, InputIterator last) : c_(first, last) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
     }
 
     priority_queue(std::initializer_list<value_type> ilist) : c_(ilist) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
     }
 
     priority_queue(const Container& c) : c_(c) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
     }
 
     priority_queue(Container&& c) : c_(tinystl::move(c)) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
     }
 
-    priority_queue(const priority_queue& rhs) : c_(rhs.c_), comp_(rhs.comp_) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
-    }
-
-    priority_queue(priority_queue&& rhs) : c_(tinystl::move(rhs.c_)), comp_(rhs.comp_) {
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
-    }
-
-    priority_queue& operator=(const priority_queue& rhs) {
-        c_ = rhs.c_;
-        comp_ = rhs.comp_;
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
-        return *this;
-    }
-
-    priority_queue& operator=(priority_queue&& rhs) {
-        c_ = tinystl::move(rhs.c_);
-        comp_ = rhs.comp_;
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
-        return *this;
-    }
+    // rhs 的底层容器已经是堆，复制与移动时无需重新 make_heap
+    priority_queue(const priority_queue& rhs) = default;
+    priority_queue(priority_queue&& rhs) = default;
+    priority_queue& operator=(const priority_queue& rhs) = default;
+    priority_queue& operator=(priority_queue&& rhs) = default;
 
     priority_queue& operator=(std::initializer_list<value_type> ilist) {
         c_ = ilist;
-        tinystl::make_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::make_heap(c_.begin(), c_.end(), comp_);
         return *this;
     }
 
@@ -219,30 +207,58 @@ public:  // 元素相关操作
     template <class... Args>
     void emplace(Args&&... args) {
         c_.emplace_back(tinystl::forward<Args>(args)...);
-        tinystl::push_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::push_heap(c_.begin(), c_.end(), comp_);
     }
 
     void push(const value_type& value) {
         c_.push_back(value);
-        tinystl::push_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::push_heap(c_.begin(), c_.end(), comp_);
     }
 
     void push(value_type&& value) {
         c_.push_back(tinystl::move(value));
-        tinystl::push_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::push_heap(c_.begin(), c_.end(), comp_);
     }
 
     void pop() {
-        tinystl::pop_heap(c_.begin(), c_.end(), comp_);
+        heap_policy::pop_heap(c_.begin(), c_.end(), comp_);
         c_.pop_back();
     }
 
-    void clear() {
-        while (!empty()) {
-            pop();
+    /// @brief 一次性加入 [first, last) 内的元素：批量不少于原有元素时整体 make_heap，否则逐个上浮
+    /// @note  make_heap 约 2n 次比较；随机数据的上浮平均只需常数次比较，最坏 log(n) 次，
+    ///        因此只在批量至少使堆翻倍时才重建
+    template <class InputIterator>
+    void push_range(InputIterator first, InputIterator last) {
+        const size_type old_size = c_.size();
+        c_.insert(c_.end(), first, last);
+        const size_type n = c_.size();
+        if (n - old_size >= old_size) {
+            heap_policy::make_heap(c_.begin(), c_.end(), comp_);
+        }
+        else {
+            for (size_type i = old_size + 1; i <= n; ++i) {
+                heap_policy::push_heap(c_.begin(), c_.begin() + i, comp_);
+            }
         }
     }
 
+    void push_range(std::initializer_list<value_type> ilist) { push_range(ilist.begin(), ilist.end()); }
+
+    /// @brief 相当于 pop 后再 push(value)，但只做一次下沉
+    void replace_top(const value_type& value) {
+        TINYSTL_DEBUG(!empty());
+        heap_policy::replace_top(c_.begin(), c_.end(), value, comp_);
+    }
+
+    void replace_top(value_type&& value) {
+        TINYSTL_DEBUG(!empty());
+        heap_policy::replace_top(c_.begin(), c_.end(), tinystl::move(value), comp_);
+    }
+
+    /// @brief 清空底层容器即可，空容器本身就是堆
+    void clear() { c_.clear(); }
+
     void swap(priority_queue& rhs) noexcept(noexcept(tinystl::swap(c_, rhs.c_)) &&
                                             noexcept(tinystl::swap(comp_, rhs.comp_))) {
         tinystl::swap(c_, rhs.c_);
@@ -262,21 +278,21 @@ public:
 
 // ============================= 重载比较操作符 ============================= //
 
-template <class T, class Container, class Compare>
-bool operator==(const priority_queue<T, Container, Compare>& lhs,
-                const priority_queue<T, Container, Compare>& rhs) {
+template <class T, class Container, class Compare, class HeapPolicy>
+bool operator==(const priority_queue<T, Container, Compare, HeapPolicy>& lhs,
+                const priority_queue<T, Container, Compare, HeapPolicy>& rhs) {
     return lhs == rhs;
 }
 
-template <class T, class Container, class Compare>
-bool operator!=(const priority_queue<T, Container, Compare>& lhs,
-                const priority_queue<T, Container, Compare>& rhs) {
+template <class T, class Container, class Compare, class HeapPolicy>
+bool operator!=(const priority_queue<T, Container, Compare, HeapPolicy>& lhs,
+                const priority_queue<T, Container, Compare, HeapPolicy>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class T, class Container, class Compare>
-void swap(priority_queue<T, Container, Compare>& lhs,
-          priority_queue<T, Container, Compare>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+template <class T, class Container, class Compare, class HeapPolicy>
+void swap(priority_queue<T, Container, Compare, HeapPolicy>& lhs,
+          priority_queue<T, Container, Compare, HeapPolicy>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
     lhs.swap(rhs);
 }
 
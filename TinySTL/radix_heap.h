@@ -0,0 +1,165 @@
+#ifndef TINYSTL_RADIX_HEAP_H_
+#define TINYSTL_RADIX_HEAP_H_
+
+// 这个头文件包含一个模板类 radix_heap
+// radix_heap : 单调基数堆，键为整数且弹出的键单调不减的小顶堆
+
+// notes:
+//
+// 时间戳、Dijkstra 的距离这类整数优先级只会向前推进：新加入的键不小于最后一次弹出的键 last。
+// radix_heap 利用这一点按键与 last 最高的不同二进制位分桶，而不做比较排序：
+//   * 桶 0 存放等于 last 的键，桶 i（i >= 1）存放与 last 最高的不同位为第 i - 1 位的键
+//   * push 只计算桶号并追加到桶尾，O(1)
+//   * 桶 0 为空时找到第一个非空的桶，以其中最小的键为新的 last，把整个桶重新分到更低的桶中；
+//     每个元素只会往更低的桶移动，至多移动 bit 数次，均摊 O(log C)，C 为键的取值范围
+//   * 接口与 priority_queue 相同（push / top / pop / size / empty），top 为最小的键
+//   * 有符号的键翻转符号位后按无符号数处理，顺序不变
+//   * 违反单调性（push 的键小于最后一次弹出的键）是未定义行为，调试模式下会断言
+
+#include <type_traits>
+
+#include "vector.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+/// @brief 单调基数堆
+/// @tparam Key    整数类型的键
+/// @tparam Value  与键一同存放的值
+template <class Key, class Value>
+class radix_heap {
+    static_assert(std::is_integral<Key>::value, "the key of radix_heap should be an integral type");
+
+public:
+    typedef Key                       key_type;
+    typedef Value                     mapped_type;
+    typedef tinystl::pair<Key, Value> value_type;
+    typedef size_t                    size_type;
+    typedef const value_type&         const_reference;
+
+private:
+    typedef typename std::make_unsigned<Key>::type ukey_type;
+
+    static constexpr size_type key_bits     = sizeof(Key) * 8;
+    static constexpr size_type bucket_count = key_bits + 1;
+
+    // top 可能需要把元素重新分桶，这不改变堆中的内容，所以桶与 last_ 为 mutable
+    mutable tinystl::vector<value_type> buckets_[bucket_count];
+    mutable ukey_type                   last_;  // 最后一次弹出（或重新分桶时选出）的最小键
+    size_type                           size_;
+
+public:  // 构造、复制、移动、析构函数
+    radix_heap() : last_(0), size_(0) {}
+
+    radix_heap(const radix_heap&) = default;
+    radix_heap& operator=(const radix_heap&) = default;
+
+    radix_heap(radix_heap&& rhs) noexcept : last_(rhs.last_), size_(rhs.size_) {
+        for (size_type i = 0; i < bucket_count; ++i) buckets_[i].swap(rhs.buckets_[i]);
+        rhs.last_ = 0;
+        rhs.size_ = 0;
+    }
+
+    radix_heap& operator=(radix_heap&& rhs) noexcept {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    ~radix_heap() = default;
+
+public:  // 元素相关操作
+    bool      empty() const noexcept { return size_ == 0; }
+    size_type size()  const noexcept { return size_; }
+
+    /// @brief 键最小的元素
+    const_reference top() const {
+        TINYSTL_DEBUG(!empty());
+        if (buckets_[0].empty()) pull();
+        return buckets_[0].back();
+    }
+
+    const key_type& top_key() const { return top().first; }
+
+    template <class... Args>
+    void emplace(const key_type& key, Args&&... args) {
+        const ukey_type k = encode(key);
+        TINYSTL_DEBUG(k >= last_);
+        buckets_[bucket_of(k)].emplace_back(key, mapped_type(tinystl::forward<Args>(args)...));
+        ++size_;
+    }
+
+    void push(const key_type& key, const mapped_type& value) { emplace(key, value); }
+    void push(const key_type& key, mapped_type&& value)      { emplace(key, tinystl::move(value)); }
+    void push(const value_type& value)                       { emplace(value.first, value.second); }
+
+    void pop() {
+        TINYSTL_DEBUG(!empty());
+        if (buckets_[0].empty()) pull();
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    /// @brief 清空元素并重置单调性的下界，桶的内存保留以供复用
+    void clear() noexcept {
+        for (size_type i = 0; i < bucket_count; ++i) buckets_[i].clear();
+        last_ = 0;
+        size_ = 0;
+    }
+
+    void swap(radix_heap& rhs) noexcept {
+        for (size_type i = 0; i < bucket_count; ++i) buckets_[i].swap(rhs.buckets_[i]);
+        tinystl::swap(last_, rhs.last_);
+        tinystl::swap(size_, rhs.size_);
+    }
+
+private:  // 辅助函数
+    /// @brief 把键映射为保持顺序的无符号数：有符号的键翻转符号位
+    static ukey_type encode(const key_type& key) noexcept {
+        return std::is_signed<Key>::value
+            ? static_cast<ukey_type>(static_cast<ukey_type>(key) ^ (ukey_type(1) << (key_bits - 1)))
+            : static_cast<ukey_type>(key);
+    }
+
+    /// @brief 键 k 所在的桶：0 表示等于 last_，否则为 k ^ last_ 的位宽
+    size_type bucket_of(ukey_type k) const noexcept {
+        const unsigned long long x = static_cast<unsigned long long>(k ^ last_);
+        if (x == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - static_cast<size_type>(__builtin_clzll(x));
+#else
+        size_type r = 0;
+        for (unsigned long long y = x; y != 0; y >>= 1) ++r;
+        return r;
+#endif
+    }
+
+    /// @brief 桶 0 为空时，以第一个非空桶中最小的键为新的 last_，把该桶重新分到更低的桶中
+    void pull() const {
+        size_type i = 1;
+        while (buckets_[i].empty()) ++i;
+        auto& b = buckets_[i];
+        ukey_type m = encode(b[0].first);
+        for (size_type j = 1; j < b.size(); ++j) {
+            const ukey_type k = encode(b[j].first);
+            if (k < m) m = k;
+        }
+        last_ = m;
+        for (auto& x : b) {
+            buckets_[bucket_of(encode(x.first))].push_back(tinystl::move(x));
+        }
+        b.clear();
+    }
+};
+
+// ==================================== 重载 swap ==================================== //
+
+template <class Key, class Value>
+void swap(radix_heap<Key, Value>& lhs, radix_heap<Key, Value>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_RADIX_HEAP_H_
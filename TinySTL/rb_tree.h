@@ -4,9 +4,16 @@
 // 这个头文件包含一个模板类 rb_tree
 // rb_tree : 红黑树
 
+// notes:
+//
+// header_ 嵌入在 rb_tree 对象中而不是单独分配，构造、移动与析构空树都不访问空间配置器，默认构造与移动为 noexcept。
+// 移动与 swap 由 rb_tree_swap_headers 交换 header_ 的内容，并把根节点的父指针重新指回各自的 header_，
+// 被移动的 rb_tree 是合法的空树。
+
 #include <initializer_list>
 
 #include <cassert>
+#include <cstdint>
 
 #include "functional.h"
 #include "iterator.h"
@@ -109,10 +116,38 @@ struct rb_tree_node_base {
     typedef rb_tree_node_base<T>*               base_ptr;
     typedef rb_tree_node<T>*                    node_ptr;
 
-    base_ptr   parent;      // 父节点
-    base_ptr   left;        // 左子节点
-    base_ptr   right;       // 右子节点
-    color_type color;       // 节点颜色
+    // 节点指针至少按 2 字节对齐，最低位恒为 0，用来存放节点颜色，
+    // 这样每个节点只需要三个指针的额外开销（x86-64 下为 24 字节）
+    uintptr_t  parent_color_;  // 父节点指针 | 节点颜色
+    base_ptr   left;           // 左子节点
+    base_ptr   right;          // 右子节点
+
+    static constexpr uintptr_t color_mask = 1;
+
+    /// @brief 获取父节点
+    base_ptr parent() const noexcept {
+        return reinterpret_cast<base_ptr>(parent_color_ & ~color_mask);
+    }
+
+    /// @brief 设置父节点，保留节点颜色
+    void set_parent(base_ptr p) noexcept {
+        parent_color_ = reinterpret_cast<uintptr_t>(p) | (parent_color_ & color_mask);
+    }
+
+    /// @brief 获取节点颜色
+    color_type color() const noexcept {
+        return static_cast<color_type>(parent_color_ & color_mask);
+    }
+
+    /// @brief 设置节点颜色，保留父节点
+    void set_color(color_type c) noexcept {
+        parent_color_ = (parent_color_ & ~color_mask) | static_cast<uintptr_t>(c);
+    }
+
+    /// @brief 同时设置父节点与颜色，用于初始化未构造的节点
+    void reset_parent(base_ptr p, color_type c) noexcept {
+        parent_color_ = reinterpret_cast<uintptr_t>(p) | static_cast<uintptr_t>(c);
+    }
 
     // base_ptr get_base_ptr() {
     //     return &*this;
@@ -189,10 +224,10 @@ struct rb_tree_iterator_base : public tinystl::iterator<tinystl::bidirectional_i
         }
         // 如果没有右子节点
         else {
-            auto p = node->parent;
+            auto p = node->parent();
             while (node == p->right) {
                 node = p;
-                p = p->parent;
+                p = p->parent();
             }
             // // 应对“寻找根节点的下一节点，而根节点没有右子节点”的特殊情况
             if (node->right != p) {
@@ -204,7 +239,7 @@ struct rb_tree_iterator_base : public tinystl::iterator<tinystl::bidirectional_i
     // 使迭代器后退
     void dec() {
         // 如果 node 为 header，则指向整棵树的 max 节点
-        if (node->parent->parent == node && rb_tree_is_red(node)) {
+        if (node->parent()->parent() == node && rb_tree_is_red(node)) {
             node = node->right;  // 指向整棵树的 max 节点
         }
         else if (node->left != nullptr) {
@@ -212,10 +247,10 @@ struct rb_tree_iterator_base : public tinystl::iterator<tinystl::bidirectional_i
         }
         // 非 header 节点，也无左子节点
         else {
-            auto p = node->parent;
+            auto p = node->parent();
             while (node == p->left) {
                 node = p;
-                p = p->parent;
+                p = p->parent();
             }
             node = p;
         }
@@ -355,33 +390,46 @@ NodePtr rb_tree_max(NodePtr x) noexcept {
 /// @brief 判断该节点是否为左儿子
 template <class NodePtr>
 bool rb_tree_is_lchild(NodePtr x) noexcept {
-    return x == x->parent->left;
+    return x == x->parent()->left;
 }
 
 /// @brief 判断该节点的颜色是否为红色
 template <class NodePtr>
 bool rb_tree_is_red(NodePtr x) noexcept {
-    return x->color == rb_tree_red;
+    return x->color() == rb_tree_red;
 }
 
 /// @brief 将节点染成黑色
 template <class NodePtr>
 void rb_tree_set_black(NodePtr x) noexcept {
-    x->color = rb_tree_black;
+    x->set_color(rb_tree_black);
 }
 
 /// @brief 将节点染成红色
 template <class NodePtr>
 void rb_tree_set_red(NodePtr x) noexcept {
-    x->color = rb_tree_red;
+    x->set_color(rb_tree_red);
 }
 
 /// @brief 获得 rb-tree 的下一个节点
 template <class NodePtr>
 NodePtr rb_tree_next(NodePtr x) noexcept {
     if (x->right != nullptr) return rb_tree_min(x->right);
-    while (!rb_tree_is_lchild(x)) x = x->parent;
-    return x->parent;
+    while (!rb_tree_is_lchild(x)) x = x->parent();
+    return x->parent();
+}
+
+/// @brief 交换两棵树嵌入在容器对象中的 header，并让根节点重新指回各自的 header
+template <class NodeBase>
+void rb_tree_swap_headers(NodeBase& a, NodeBase& b) noexcept {
+    tinystl::swap(a.parent_color_, b.parent_color_);  // header 都为红色，相当于只交换根节点
+    tinystl::swap(a.left, b.left);
+    tinystl::swap(a.right, b.right);
+    // 空树的 leftmost / rightmost 原本指向自身，交换后指向对方
+    if (a.parent() == nullptr) a.left = a.right = &a;
+    else a.parent()->set_parent(&a);
+    if (b.parent() == nullptr) b.left = b.right = &b;
+    else b.parent()->set_parent(&b);
 }
 
 // ============== rb-tree rotate ============== //
@@ -402,17 +450,17 @@ template <class NodePtr>
 void rb_tree_rotate_left(NodePtr x, NodePtr& root) noexcept {
     auto y = x->right;
     x->right = y->left;
-    if (y->left != nullptr) y->left->parent = x;
-    y->parent = x->parent;
+    if (y->left != nullptr) y->left->set_parent(x);
+    y->set_parent(x->parent());
 
     // 如果 x 为根节点，让 y 顶替 x 成为根节点
     if (x == root) root = y;
-    else if (rb_tree_is_lchild(x)) x->parent->left = y;
-    else x->parent->right = y;
+    else if (rb_tree_is_lchild(x)) x->parent()->left = y;
+    else x->parent()->right = y;
 
     // 调整 x 与 y 的关系
     y->left = x;
-    x->parent = y;
+    x->set_parent(y);
 }
 
 /*----------------------------------------*\
@@ -429,17 +477,17 @@ template <class NodePtr>
 void rb_tree_rotate_right(NodePtr x, NodePtr& root) noexcept {
     auto y = x->left;
     x->left = y->right;
-    if (y->right != nullptr) y->right->parent = x;
-    y->parent = x->parent;
+    if (y->right != nullptr) y->right->set_parent(x);
+    y->set_parent(x->parent());
 
     // 如果 x 为根节点，让 y 顶替 x 成为根节点
     if (x == root) root = y;
-    else if (rb_tree_is_lchild(x)) x->parent->left = y;
-    else x->parent->right = y;
+    else if (rb_tree_is_lchild(x)) x->parent()->left = y;
+    else x->parent()->right = y;
 
     // 调整 x 与 y 的关系
     y->right = x;
-    x->parent = y;
+    x->set_parent(y);
 }
 
 // ================== rb-tree insert ================== //
@@ -457,52 +505,52 @@ template <class NodePtr>
 void rb_tree_insert_rebalance(NodePtr x, NodePtr& root) noexcept {
     rb_tree_set_red(x);  // 新增节点为红色
     // 父节点为黑色不用处理，case2
-    while (x != root && rb_tree_is_red(x->parent)) {
+    while (x != root && rb_tree_is_red(x->parent())) {
         // 如果父节点为左子节点
-        if (rb_tree_is_lchild(x->parent)) {
-            auto uncle = x->parent->parent->right;  // 叔叔节点
+        if (rb_tree_is_lchild(x->parent())) {
+            auto uncle = x->parent()->parent()->right;  // 叔叔节点
             // uncle 红色，case3.1
             if (uncle != nullptr && rb_tree_is_red(uncle)) {
-                rb_tree_set_black(x->parent);  // 父节点变为黑色
+                rb_tree_set_black(x->parent());  // 父节点变为黑色
                 rb_tree_set_black(uncle);      // 叔叔节点变为黑色
+                x = x->parent()->parent();     // 祖父节点变为当前节点
                 rb_tree_set_red(x);            // 祖父节点变为红色
-                x = x->parent->parent;         // 祖父节点变为当前节点
             }
             // 无叔叔节点或叔叔节点为黑
             else {
                 // LR, case3.3 转化为 case3.2
                 if (!rb_tree_is_lchild(x)) {
-                    x = x->parent;                 // 父节点变为当前节点
+                    x = x->parent();                 // 父节点变为当前节点
                     rb_tree_rotate_left(x, root);  // 左旋
                 }
                 // case 3.2
-                rb_tree_set_black(x->parent);        // 父节点变为黑色
-                rb_tree_set_red(x->parent->parent);  // 祖父节点变为红色
-                rb_tree_rotate_right(x->parent->parent, root);  // 右旋
+                rb_tree_set_black(x->parent());        // 父节点变为黑色
+                rb_tree_set_red(x->parent()->parent());  // 祖父节点变为红色
+                rb_tree_rotate_right(x->parent()->parent(), root);  // 右旋
                 break;
             }
         }
         // 对称处理
         else {
-            auto uncle = x->parent->parent->left;    // 叔叔节点
+            auto uncle = x->parent()->parent()->left;    // 叔叔节点
             // uncle 红色，case3.1
             if (uncle != nullptr && rb_tree_is_red(uncle)) {
-                rb_tree_set_black(x->parent);  // 父节点变为黑色
+                rb_tree_set_black(x->parent());  // 父节点变为黑色
                 rb_tree_set_black(uncle);      // 叔叔节点变为黑色
-                x = x->parent->parent;         // 祖父节点变为当前节点
+                x = x->parent()->parent();     // 祖父节点变为当前节点
                 rb_tree_set_red(x);            // 祖父节点变为红色
             }
             // 无叔叔节点或叔叔节点为黑
             else {
                 // RL, case3.3 转化为 case3.2
                 if (rb_tree_is_lchild(x)) {
-                    x = x->parent;                  // 父节点变为当前节点
+                    x = x->parent();                  // 父节点变为当前节点
                     rb_tree_rotate_right(x, root);  // 右旋
                 }
                 // case 3.2
-                rb_tree_set_black(x->parent);        // 父节点变为黑色
-                rb_tree_set_red(x->parent->parent);  // 祖父节点变为红色
-                rb_tree_rotate_left(x->parent->parent, root);  // 左旋
+                rb_tree_set_black(x->parent());        // 父节点变为黑色
+                rb_tree_set_red(x->parent()->parent());  // 祖父节点变为红色
+                rb_tree_rotate_left(x->parent()->parent(), root);  // 左旋
                 break;
             }
         }
@@ -532,40 +580,42 @@ NodePtr rb_tree_erase_rebalance(NodePtr z, NodePtr& root, NodePtr& leftmost, Nod
     // y != z 说明 z 有两个非空子节点，此时 y 是 z 的后继节点，x 指向 y 的非空子节点。
     // 用 y 顶替 z 的位置，用 x 顶替 y 的位置，最后用 y 指向 z
     if (y != z) {
-        z->left->parent = y;
+        z->left->set_parent(y);
         y->left = z->left;
 
         // 如果 y 不是 z 的右子节点，那么 z 的右子节点一定有左孩子
         // x 替换 y 的位置
         if (y != z->right) {
-            xp = y->parent;
-            if (x != nullptr) x->parent = y->parent;
-            y->parent->left = x;
+            xp = y->parent();
+            if (x != nullptr) x->set_parent(y->parent());
+            y->parent()->left = x;
             y->right = z->right;
-            z->right->parent = y;
+            z->right->set_parent(y);
         }
         else xp = y;
 
         // 连接 y 与 z 的父节点
         if (root == z) root = y;
-        else if (z->parent->left == z) z->parent->left = y;
-        else z->parent->right = y;
+        else if (z->parent()->left == z) z->parent()->left = y;
+        else z->parent()->right = y;
 
-        y->parent = z->parent;
-        tinystl::swap(y->color, z->color);
+        y->set_parent(z->parent());
+        auto y_color = y->color();
+        y->set_color(z->color());
+        z->set_color(y_color);
         y = z;
     }
 
     // case1、case2
     // y == z 说明 z 至多只有一个孩子
     else {
-        xp = y->parent;
-        if (x) x->parent = y->parent;
+        xp = y->parent();
+        if (x) x->set_parent(y->parent());
 
         // 连接 x 与 z 的父节点
         if (root == z) root = x;
-        else if (z->parent->left == z) z->parent->left = x;
-        else z->parent->right = x;
+        else if (z->parent()->left == z) z->parent()->left = x;
+        else z->parent()->right = x;
 
         // 此时 z 有可能是最左节点或最右节点，更新数据
         if (leftmost == z) leftmost = x == nullptr ? xp : rb_tree_min(x);
@@ -604,7 +654,7 @@ NodePtr rb_tree_erase_rebalance(NodePtr z, NodePtr& root, NodePtr& leftmost, Nod
                     (brother->right == nullptr || !rb_tree_is_red(brother->right))) {
                     rb_tree_set_red(brother);          // 兄弟节点变为红色
                     x = xp;                            // 父节点成为当前节点
-                    xp = xp->parent;                   // 父节点的父节点成为父节点
+                    xp = xp->parent();                   // 父节点的父节点成为父节点
                     // 此时如果 p 为红色会直接跳出循环
                 }
                 else {
@@ -618,7 +668,7 @@ NodePtr rb_tree_erase_rebalance(NodePtr z, NodePtr& root, NodePtr& leftmost, Nod
                     }
                     // 处理之后变为 case6
                     // case6: 兄弟节点的同侧节点为红色
-                    brother->color = xp->color;                // 兄弟节点变为父节点的颜色
+                    brother->set_color(xp->color());           // 兄弟节点变为父节点的颜色
                     rb_tree_set_black(xp);                     // 父节点变为黑色
                     if (brother->right != nullptr) 
                         rb_tree_set_black(brother->right);     // 兄弟节点的右子节点变为黑色
@@ -641,7 +691,7 @@ NodePtr rb_tree_erase_rebalance(NodePtr z, NodePtr& root, NodePtr& leftmost, Nod
                     (brother->right == nullptr || !rb_tree_is_red(brother->right))) {
                     rb_tree_set_red(brother);
                     x = xp;
-                    xp = xp->parent;
+                    xp = xp->parent();
                 }
                 else {
                     // case 3
@@ -653,7 +703,7 @@ NodePtr rb_tree_erase_rebalance(NodePtr z, NodePtr& root, NodePtr& leftmost, Nod
                         brother = xp->left;
                     }
                     // 转为 case 4
-                    brother->color = xp->color;
+                    brother->set_color(xp->color());
                     rb_tree_set_black(xp);
                     if (brother->left != nullptr) 
                         rb_tree_set_black(brother->left);
@@ -698,7 +748,6 @@ public:  // rb_tree 的嵌套型别定义
 
     typedef simple_alloc<T, Alloc>                          allocator_type;
     typedef simple_alloc<T, Alloc>                          data_allocator;
-    typedef simple_alloc<base_type, Alloc>                  base_allocator;
     typedef simple_alloc<node_type, Alloc>                  node_allocator;
 
     // typedef typename allocator_type::pointer                pointer;
@@ -724,20 +773,24 @@ public:  // rb_tree 的嵌套型别定义
     key_compare    key_comp()      const { return key_comp_; }
 
 private:  // rb_tree 的数据成员
-    base_ptr    header_;      // 特殊节点，与根节点互为父节点
+    base_type   header_;      // 嵌入的特殊节点，与根节点互为父节点，空树不需要分配内存
     size_type   node_count_;  // 节点数量
     key_compare key_comp_;    // 节点键值比较准则
 
 private:
-    /// @brief 获取根节点
-    base_ptr& root()      const { return header_->parent; }
+    /// @brief 获取根节点，根节点存放在 header_ 的父指针中，与 header_ 的颜色共用一个字
+    base_ptr  root()      const { return header_.parent(); }
+    /// @brief 设置根节点
+    void      set_root(base_ptr x) { header_.set_parent(x); }
     /// @brief 获取最小节点
-    base_ptr& leftmost()  const { return header_->left; }
+    base_ptr& leftmost()  const { return header()->left; }
     /// @brief 获取最大节点
-    base_ptr& rightmost() const { return header_->right; }
+    base_ptr& rightmost() const { return header()->right; }
+    /// @brief header_ 的指针，const 成员函数也需要它来构造迭代器
+    base_ptr  header()    const noexcept { return const_cast<base_ptr>(&header_); }
 
 public:  // 构造、复制、析构函数
-    rb_tree() { rb_tree_init(); }
+    rb_tree() noexcept : key_comp_() { rb_tree_init(); }
 
     rb_tree(const rb_tree& rhs);
     rb_tree(rb_tree&& rhs) noexcept;
@@ -752,8 +805,8 @@ public:  // 迭代器相关操作
     const_iterator          begin()     const noexcept  { return leftmost(); }
     const_iterator          cbegin()    const noexcept  { return begin(); }
 
-    iterator                end()       noexcept        { return header_; }
-    const_iterator          end()       const noexcept  { return header_; }
+    iterator                end()       noexcept        { return header(); }
+    const_iterator          end()       const noexcept  { return header(); }
     const_iterator          cend()      const noexcept  { return end(); }
 
     reverse_iterator        rbegin()    noexcept        { return reverse_iterator(end()); }
@@ -895,8 +948,7 @@ private:  // 辅助函数
     void     destroy_node(node_ptr x);
 
     // init / reset
-    void     rb_tree_init();
-    void     reset();
+    void     rb_tree_init() noexcept;
 
     // get_insert_pos
     tinystl::pair<base_ptr, bool> get_insert_multi_pos(const key_type& key);
@@ -923,7 +975,7 @@ template <class T, class Compare, class Alloc>
 rb_tree<T, Compare, Alloc>::rb_tree(const rb_tree& rhs) {
     rb_tree_init();
     if (rhs.node_count_ != 0) {
-        root() = copy_from(rhs.root(), header_);
+        set_root(copy_from(rhs.root(), header()));
         leftmost() = rb_tree_min(root());
         rightmost() = rb_tree_max(root());
     }
@@ -934,10 +986,9 @@ rb_tree<T, Compare, Alloc>::rb_tree(const rb_tree& rhs) {
 /// @brief 移动构造函数
 template <class T, class Compare, class Alloc>
 rb_tree<T, Compare, Alloc>::rb_tree(rb_tree&& rhs) noexcept 
-    : header_(tinystl::move(rhs.header_)), 
-    node_count_(rhs.node_count_), 
-    key_comp_(rhs.key_comp_) {
-    rhs.reset();
+    : key_comp_(rhs.key_comp_) {
+    rb_tree_init();
+    swap(rhs);
 } 
 
 /// @brief 复制赋值运算符
@@ -946,7 +997,7 @@ rb_tree<T, Compare, Alloc>& rb_tree<T, Compare, Alloc>::operator=(const rb_tree&
     if (this != &rhs) {
         clear();
         if (rhs.node_count_ != 0) {
-            root() = copy_from(rhs.root(), header_);
+            set_root(copy_from(rhs.root(), header()));
             leftmost() = rb_tree_min(root());
             rightmost() = rb_tree_max(root());
         }
@@ -960,10 +1011,7 @@ rb_tree<T, Compare, Alloc>& rb_tree<T, Compare, Alloc>::operator=(const rb_tree&
 template <class T, class Compare, class Alloc>
 rb_tree<T, Compare, Alloc>& rb_tree<T, Compare, Alloc>::operator=(rb_tree&& rhs) noexcept {
     clear();
-    header_ = tinystl::move(rhs.header_);
-    node_count_ = rhs.node_count_;
-    key_comp_ = rhs.key_comp_;
-    rhs.reset();
+    swap(rhs);
     return *this;
 }
 
@@ -1006,7 +1054,7 @@ rb_tree<T, Compare, Alloc>::emplace_multi_use_hint(iterator hint, Args&& ...args
     key_type key  = value_traits::get_key(node->value);
 
     if (node_count_ == 0) {
-        return insert_node_at(header_, node, true);
+        return insert_node_at(header(), node, true);
     }
 
     if (hint == begin()) {
@@ -1042,7 +1090,7 @@ rb_tree<T, Compare, Alloc>::emplace_unique_use_hint(iterator hint, Args&& ...arg
     key_type key  = value_traits::get_key(node->value);
 
     if (node_count_ == 0) {
-        return insert_node_at(header_, node, true);
+        return insert_node_at(header(), node, true);
     }
     if (hint == begin()) {
         if (key_comp_(key, value_traits::get_key(*hint))) {
@@ -1107,7 +1155,9 @@ rb_tree<T, Compare, Alloc>::erase(iterator hint) {
     iterator next(node);
     ++next;
     // 重新平衡
-    rb_tree_erase_rebalance(hint.node, root(), leftmost(), rightmost());
+    base_ptr r = root();
+    rb_tree_erase_rebalance(hint.node, r, leftmost(), rightmost());
+    set_root(r);
     destroy_node(node);
     --node_count_;
     return next;
@@ -1147,9 +1197,9 @@ template <class T, class Compare, class Alloc>
 void rb_tree<T, Compare, Alloc>::clear() {
     if (node_count_ != 0) {
         erase_since(root());
-        leftmost() = header_;
-        root() = nullptr;
-        rightmost() = header_;
+        leftmost() = header();
+        set_root(nullptr);
+        rightmost() = header();
         node_count_ = 0;
     }
 }
@@ -1158,7 +1208,7 @@ void rb_tree<T, Compare, Alloc>::clear() {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::iterator
 rb_tree<T, Compare, Alloc>::find(const key_type& key) {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于等于 x 键值，向左走
@@ -1181,7 +1231,7 @@ rb_tree<T, Compare, Alloc>::find(const key_type& key) {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::const_iterator
 rb_tree<T, Compare, Alloc>::find(const key_type& key) const {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于等于 x 键值，向左走
@@ -1204,7 +1254,7 @@ rb_tree<T, Compare, Alloc>::find(const key_type& key) const {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::iterator
 rb_tree<T, Compare, Alloc>::lower_bound(const key_type& key) {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于等于 x 键值，向左走
@@ -1224,7 +1274,7 @@ rb_tree<T, Compare, Alloc>::lower_bound(const key_type& key) {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::const_iterator
 rb_tree<T, Compare, Alloc>::lower_bound(const key_type& key) const {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于等于 x 键值，向左走
@@ -1244,7 +1294,7 @@ rb_tree<T, Compare, Alloc>::lower_bound(const key_type& key) const {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::iterator
 rb_tree<T, Compare, Alloc>::upper_bound(const key_type& key) {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于 x 键值，向左走
@@ -1264,7 +1314,7 @@ rb_tree<T, Compare, Alloc>::upper_bound(const key_type& key) {
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::const_iterator
 rb_tree<T, Compare, Alloc>::upper_bound(const key_type& key) const {
-    auto y = header_;  // 最后一个不小于 key 的节点
+    auto y = header();  // 最后一个不小于 key 的节点
     auto x = root();   // 当前节点
     while (x != nullptr) {
         // key 小于 x 键值，向左走
@@ -1284,7 +1334,7 @@ rb_tree<T, Compare, Alloc>::upper_bound(const key_type& key) const {
 template <class T, class Compare, class Alloc>
 void rb_tree<T, Compare, Alloc>::swap(rb_tree& rhs) noexcept {
     if (this != &rhs) {
-        tinystl::swap(header_, rhs.header_);
+        rb_tree_swap_headers(header_, rhs.header_);
         tinystl::swap(node_count_, rhs.node_count_);
         tinystl::swap(key_comp_, rhs.key_comp_);
     }
@@ -1301,7 +1351,7 @@ rb_tree<T, Compare, Alloc>::create_node(Args&& ...args) {
     try {
         // 在节点位置构造元素
         tinystl::construct(tinystl::address_of(tmp->value), tinystl::forward<Args>(args)...);
-        tmp->parent = nullptr;
+        tmp->reset_parent(nullptr, rb_tree_red);
         tmp->left = nullptr;
         tmp->right = nullptr;
     }
@@ -1318,7 +1368,7 @@ typename rb_tree<T, Compare, Alloc>::node_ptr
 rb_tree<T, Compare, Alloc>::clone_node(base_ptr x) {
     // auto tmp = create_node(x->get_node_ptr()->value);
     auto tmp = create_node(static_cast<node_ptr>(x)->value);
-    tmp->color = x->color;
+    tmp->set_color(x->color());
     tmp->left = nullptr;
     tmp->right = nullptr;
     return tmp;
@@ -1334,19 +1384,10 @@ void rb_tree<T, Compare, Alloc>::destroy_node(node_ptr x) {
 
 /// @brief 初始化 rb-tree
 template <class T, class Compare, class Alloc>
-void rb_tree<T, Compare, Alloc>::rb_tree_init() {
-    header_ = base_allocator::allocate(1);
-    header_->color = rb_tree_red;  // header_ 为红色，与 root 区分
-    root() = nullptr;
-    leftmost() = header_;
-    rightmost() = header_;
-    node_count_ = 0;
-}
-
-/// @brief 重置 rb-tree
-template <class T, class Compare, class Alloc>
-void rb_tree<T, Compare, Alloc>::reset() {
-    header_ = nullptr;
+void rb_tree<T, Compare, Alloc>::rb_tree_init() noexcept {
+    header_.reset_parent(nullptr, rb_tree_red);  // header_ 为红色，与 root 区分
+    leftmost() = header();
+    rightmost() = header();
     node_count_ = 0;
 }
 
@@ -1355,7 +1396,7 @@ template <class T, class Compare, class Alloc>
 tinystl::pair<typename rb_tree<T, Compare, Alloc>::base_ptr, bool>
 rb_tree<T, Compare, Alloc>::get_insert_multi_pos(const key_type& key) {
     auto x = root();
-    auto y = header_;
+    auto y = header();
     bool add_to_left = true;
     while (x != nullptr) {
         y = x;
@@ -1374,7 +1415,7 @@ template <class T, class Compare, class Alloc>
 tinystl::pair<tinystl::pair<typename rb_tree<T, Compare, Alloc>::base_ptr, bool>, bool>
 rb_tree<T, Compare, Alloc>::get_insert_unique_pos(const key_type& key) {
     auto x = root();
-    auto y = header_;
+    auto y = header();
     bool add_to_left = true;  // 树为空时也在 header_ 左边插入
     while (x != nullptr) {
         y = x;
@@ -1411,11 +1452,11 @@ template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::iterator
 rb_tree<T, Compare, Alloc>::insert_value_at(base_ptr x, const value_type& value, bool add_to_left) {
     node_ptr node = create_node(value);
-    node->parent = x;
+    node->set_parent(x);
     // auto base_node = node->get_base_ptr();
     auto base_node = static_cast<base_ptr>(node);
-    if (x == header_) {
-        root() = base_node;
+    if (x == header()) {
+        set_root(base_node);
         leftmost() = base_node;
         rightmost() = base_node;
     }
@@ -1427,7 +1468,9 @@ rb_tree<T, Compare, Alloc>::insert_value_at(base_ptr x, const value_type& value,
         x->right = base_node;
         if (x == rightmost()) rightmost() = base_node;
     }
-    rb_tree_insert_rebalance(base_node, root());
+    base_ptr r = root();
+    rb_tree_insert_rebalance(base_node, r);
+    set_root(r);
     ++node_count_;
     return iterator(node);
 }
@@ -1436,11 +1479,11 @@ rb_tree<T, Compare, Alloc>::insert_value_at(base_ptr x, const value_type& value,
 template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::iterator
 rb_tree<T, Compare, Alloc>::insert_node_at(base_ptr x, node_ptr node, bool add_to_left) {
-    node->parent = x;
+    node->set_parent(x);
     // auto base_node = node->get_base_ptr();
     auto base_node = static_cast<base_ptr>(node);
-    if (x == header_) {
-        root() = base_node;
+    if (x == header()) {
+        set_root(base_node);
         leftmost() = base_node;
         rightmost() = base_node;
     }
@@ -1452,7 +1495,9 @@ rb_tree<T, Compare, Alloc>::insert_node_at(base_ptr x, node_ptr node, bool add_t
         x->right = base_node;
         if (x == rightmost()) rightmost() = base_node;
     }
-    rb_tree_insert_rebalance(base_node, root());
+    base_ptr r = root();
+    rb_tree_insert_rebalance(base_node, r);
+    set_root(r);
     ++node_count_;
     return iterator(node);
 }
@@ -1515,7 +1560,7 @@ template <class T, class Compare, class Alloc>
 typename rb_tree<T, Compare, Alloc>::base_ptr
 rb_tree<T, Compare, Alloc>::copy_from(base_ptr x, base_ptr p) {
     auto top = clone_node(x);
-    top->parent = p;
+    top->set_parent(p);
     try {
         // 若有右子树，则递归复制
         if (x->right) top->right = copy_from(x->right, top);
@@ -1524,7 +1569,7 @@ rb_tree<T, Compare, Alloc>::copy_from(base_ptr x, base_ptr p) {
         while (x != nullptr) {
             auto y = clone_node(x);
             p->left = y;
-            y->parent = p;
+            y->set_parent(p);
             if (x->right) y->right = copy_from(x->right, y);
             p = y;
             x = x->left;
@@ -0,0 +1,485 @@
+#ifndef TINYSTL_RING_BUFFER_H_
+#define TINYSTL_RING_BUFFER_H_
+
+// 这个头文件包含一个模板类 ring_buffer
+// ring_buffer : 环形缓冲区，容量为 2 的幂的连续存储，可作为 queue 的底层容器
+
+// notes:
+//
+// deque 作为 FIFO 使用时要维护缓冲区的 map（reserve_map_at_back / reallocate_map），并且每个缓冲区
+// 单独分配。ring_buffer 只有一块连续的内存：
+//   * head_ / tail_ 是只增不减的计数器，元素个数为 tail_ - head_，下标为 计数器 & (容量 - 1)，
+//     push_back / pop_front 只是一次按位与、一次构造或析构和一次自增
+//   * Growable 为 true（缺省）时，满了按两倍扩容并把元素按顺序搬到新缓冲区的开头；
+//     为 false 时容量固定，只能由 reserve 改变，满时 push_back 抛出 length_error，try_push_back 返回 false
+//   * 元素在内存中至多分成两段：array_one() 为 [front, 缓冲区末尾) 部分，array_two() 为回绕到缓冲区开头的部分，
+//     free_one() / free_two() 为尾部之后的空闲空间，配合 commit_back / consume_front 做批量 I/O
+//   * 扩容时元素按 uninitialized_relocate 搬移，可平凡重定位的类型（见 is_trivially_relocatable）两段各一次 memmove；
+//     新元素先在新缓冲区中构造，参数引用容器内的元素也是安全的
+//   * 可以直接用作 queue<T, ring_buffer<T>>
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "iterator.h"
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+// ==================================== ring_buffer 迭代器 ==================================== //
+
+/// @brief ring_buffer 的随机访问迭代器，保存缓冲区、掩码与绝对位置
+template <class T, class Ref, class Ptr>
+struct ring_buffer_iterator : public tinystl::iterator<tinystl::random_access_iterator_tag, T> {
+    typedef T                                          value_type;
+    typedef Ptr                                        pointer;
+    typedef Ref                                        reference;
+    typedef size_t                                     size_type;
+    typedef ptrdiff_t                                  difference_type;
+    typedef ring_buffer_iterator<T, T&, T*>             iterator;
+    typedef ring_buffer_iterator<T, const T&, const T*> const_iterator;
+    typedef ring_buffer_iterator                       self;
+
+    T*        buf_;   // 缓冲区
+    size_type mask_;  // 容量 - 1
+    size_type pos_;   // 绝对位置，与 ring_buffer 的 head_ / tail_ 同一计数
+
+    ring_buffer_iterator() noexcept : buf_(nullptr), mask_(0), pos_(0) {}
+    ring_buffer_iterator(T* b, size_type m, size_type p) noexcept : buf_(b), mask_(m), pos_(p) {}
+    ring_buffer_iterator(const iterator& rhs) noexcept : buf_(rhs.buf_), mask_(rhs.mask_), pos_(rhs.pos_) {}
+
+    ring_buffer_iterator& operator=(const ring_buffer_iterator&) = default;
+
+    reference operator*()  const { return buf_[pos_ & mask_]; }
+    pointer   operator->() const { return &(operator*()); }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    self& operator++() { ++pos_; return *this; }
+    self& operator--() { --pos_; return *this; }
+    self  operator++(int) { self tmp = *this; ++pos_; return tmp; }
+    self  operator--(int) { self tmp = *this; --pos_; return tmp; }
+
+    self& operator+=(difference_type n) { pos_ += static_cast<size_type>(n); return *this; }
+    self& operator-=(difference_type n) { pos_ -= static_cast<size_type>(n); return *this; }
+    self  operator+(difference_type n) const { self tmp = *this; return tmp += n; }
+    self  operator-(difference_type n) const { self tmp = *this; return tmp -= n; }
+
+    // 计数器可能回绕，差值按有符号数解释
+    difference_type operator-(const self& rhs) const { return static_cast<difference_type>(pos_ - rhs.pos_); }
+
+    bool operator==(const self& rhs) const noexcept { return pos_ == rhs.pos_; }
+    bool operator!=(const self& rhs) const noexcept { return pos_ != rhs.pos_; }
+    bool operator< (const self& rhs) const noexcept { return *this - rhs < 0; }
+    bool operator> (const self& rhs) const noexcept { return rhs < *this; }
+    bool operator<=(const self& rhs) const noexcept { return !(rhs < *this); }
+    bool operator>=(const self& rhs) const noexcept { return !(*this < rhs); }
+};
+
+template <class T, class Ref, class Ptr>
+ring_buffer_iterator<T, Ref, Ptr> operator+(ptrdiff_t n, const ring_buffer_iterator<T, Ref, Ptr>& it) {
+    return it + n;
+}
+
+// ==================================== ring_buffer 结构 ==================================== //
+
+/// @brief 环形缓冲区
+/// @tparam T         元素类型
+/// @tparam Growable  满时是否按两倍扩容
+/// @tparam Alloc     空间配置器
+template <class T, bool Growable = true, class Alloc = alloc>
+class ring_buffer {
+public:
+    typedef simple_alloc<T, Alloc>                    data_allocator;
+    typedef simple_alloc<T, Alloc>                    allocator_type;
+
+    typedef T                                         value_type;
+    typedef value_type*                               pointer;
+    typedef const value_type*                         const_pointer;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+    typedef size_t                                    size_type;
+    typedef ptrdiff_t                                 difference_type;
+
+    typedef ring_buffer_iterator<T, T&, T*>             iterator;
+    typedef ring_buffer_iterator<T, const T&, const T*> const_iterator;
+    typedef tinystl::reverse_iterator<iterator>       reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    typedef tinystl::pair<pointer, size_type>         segment;        // 一段连续的内存：首地址与元素个数
+    typedef tinystl::pair<const_pointer, size_type>   const_segment;
+
+    static constexpr size_type min_capacity = 8;  // 第一次扩容时的容量
+
+    allocator_type get_allocator() { return allocator_type(); }
+
+private:
+    T*        buf_;    // 缓冲区，容量为 0 时为 nullptr
+    size_type mask_;   // 容量 - 1，容量为 0 时也为 0
+    size_type cap_;    // 容量，0 或 2 的幂
+    size_type head_;   // 首元素的绝对位置
+    size_type tail_;   // 尾元素之后的绝对位置
+
+public:  // 构造、复制、移动、析构函数
+    ring_buffer() noexcept : buf_(nullptr), mask_(0), cap_(0), head_(0), tail_(0) {}
+
+    explicit ring_buffer(size_type n) : ring_buffer() {
+        reserve(n);
+        for (; n > 0; --n) emplace_back();
+    }
+
+    ring_buffer(size_type n, const value_type& value) : ring_buffer() {
+        reserve(n);
+        for (; n > 0; --n) push_back(value);
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    ring_buffer(Iter first, Iter last) : ring_buffer() { copy_init(first, last, iterator_category(first)); }
+
+    ring_buffer(std::initializer_list<value_type> ilist) : ring_buffer(ilist.begin(), ilist.end()) {}
+
+    ring_buffer(const ring_buffer& rhs) : ring_buffer() {
+        reserve(rhs.size());
+        for (const auto& x : rhs) push_back(x);
+    }
+
+    ring_buffer(ring_buffer&& rhs) noexcept : ring_buffer() { swap(rhs); }
+
+    ring_buffer& operator=(const ring_buffer& rhs) {
+        if (this != &rhs) {
+            ring_buffer tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ring_buffer& operator=(ring_buffer&& rhs) noexcept {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    ring_buffer& operator=(std::initializer_list<value_type> ilist) {
+        ring_buffer tmp(ilist);
+        swap(tmp);
+        return *this;
+    }
+
+    ~ring_buffer() {
+        clear();
+        if (buf_ != nullptr) data_allocator::deallocate(buf_, cap_);
+    }
+
+public:  // 迭代器相关操作
+    iterator               begin()   noexcept       { return iterator(buf_, mask_, head_); }
+    const_iterator         begin()   const noexcept { return const_iterator(buf_, mask_, head_); }
+    const_iterator         cbegin()  const noexcept { return begin(); }
+    iterator               end()     noexcept       { return iterator(buf_, mask_, tail_); }
+    const_iterator         end()     const noexcept { return const_iterator(buf_, mask_, tail_); }
+    const_iterator         cend()    const noexcept { return end(); }
+
+    reverse_iterator       rbegin()  noexcept       { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator       rend()    noexcept       { return reverse_iterator(begin()); }
+    const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend()   const noexcept { return rend(); }
+
+public:  // 容量相关操作
+    bool      empty()    const noexcept { return head_ == tail_; }
+    bool      full()     const noexcept { return size() == cap_; }
+    size_type size()     const noexcept { return tail_ - head_; }
+    size_type capacity() const noexcept { return cap_; }
+    size_type max_size() const noexcept { return (static_cast<size_type>(-1) >> 1) / sizeof(T) + 1; }
+
+    /// @brief 把容量调整为不小于 n 的 2 的幂，元素按顺序搬到新缓冲区的开头
+    void reserve(size_type n);
+
+public:  // 访问元素相关操作
+    reference       operator[](size_type n)       { return buf_[(head_ + n) & mask_]; }
+    const_reference operator[](size_type n) const { return buf_[(head_ + n) & mask_]; }
+
+    reference at(size_type n) {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "ring_buffer<T>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    const_reference at(size_type n) const {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "ring_buffer<T>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return buf_[head_ & mask_];
+    }
+
+    const_reference front() const {
+        TINYSTL_DEBUG(!empty());
+        return buf_[head_ & mask_];
+    }
+
+    reference back() {
+        TINYSTL_DEBUG(!empty());
+        return buf_[(tail_ - 1) & mask_];
+    }
+
+    const_reference back() const {
+        TINYSTL_DEBUG(!empty());
+        return buf_[(tail_ - 1) & mask_];
+    }
+
+public:  // 分段访问
+    /// @brief 元素的第一段：从首元素到缓冲区末尾（或尾元素）
+    segment array_one() noexcept {
+        const size_type h = head_ & mask_;
+        return segment(buf_ + h, tinystl::min(size(), cap_ - h));
+    }
+
+    /// @brief 元素的第二段：回绕到缓冲区开头的部分，没有回绕时长度为 0
+    segment array_two() noexcept {
+        const size_type first = array_one().second;
+        return segment(buf_, size() - first);
+    }
+
+    const_segment array_one() const noexcept {
+        const size_type h = head_ & mask_;
+        return const_segment(buf_ + h, tinystl::min(size(), cap_ - h));
+    }
+
+    const_segment array_two() const noexcept {
+        const size_type first = array_one().second;
+        return const_segment(buf_, size() - first);
+    }
+
+    /// @brief 空闲空间的第一段：从尾元素之后到缓冲区末尾（或首元素）
+    segment free_one() noexcept {
+        const size_type t = tail_ & mask_;
+        return segment(buf_ + t, tinystl::min(cap_ - size(), cap_ - t));
+    }
+
+    /// @brief 空闲空间的第二段：回绕到缓冲区开头、首元素之前的部分
+    segment free_two() noexcept {
+        const size_type first = free_one().second;
+        return segment(buf_, cap_ - size() - first);
+    }
+
+    /// @brief 把调用者已在 free_one() / free_two() 中依次构造好的 n 个元素并入尾部
+    void commit_back(size_type n) noexcept {
+        TINYSTL_DEBUG(n <= cap_ - size());
+        tail_ += n;
+    }
+
+    /// @brief 从头部删除 n 个元素，通常在批量取走 array_one() / array_two() 中的数据之后调用
+    void consume_front(size_type n) noexcept {
+        TINYSTL_DEBUG(n <= size());
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_type i = 0; i < n; ++i) tinystl::destroy(buf_ + ((head_ + i) & mask_));
+        }
+        head_ += n;
+    }
+
+public:  // 修改容器相关操作
+    template <class... Args>
+    void emplace_back(Args&&... args) {
+        if (full()) {
+            realloc_emplace_back(tinystl::forward<Args>(args)...);
+            return;
+        }
+        tinystl::construct(buf_ + (tail_ & mask_), tinystl::forward<Args>(args)...);
+        ++tail_;
+    }
+
+    template <class... Args>
+    void emplace_front(Args&&... args) {
+        if (full()) {
+            realloc_emplace_front(tinystl::forward<Args>(args)...);
+            return;
+        }
+        tinystl::construct(buf_ + ((head_ - 1) & mask_), tinystl::forward<Args>(args)...);
+        --head_;
+    }
+
+    void push_back(const value_type& value)  { emplace_back(value); }
+    void push_back(value_type&& value)       { emplace_back(tinystl::move(value)); }
+    void push_front(const value_type& value) { emplace_front(value); }
+    void push_front(value_type&& value)      { emplace_front(tinystl::move(value)); }
+
+    /// @brief 不扩容的 push_back，满时返回 false
+    bool try_push_back(const value_type& value) {
+        if (full()) return false;
+        tinystl::construct(buf_ + (tail_ & mask_), value);
+        ++tail_;
+        return true;
+    }
+
+    bool try_push_back(value_type&& value) {
+        if (full()) return false;
+        tinystl::construct(buf_ + (tail_ & mask_), tinystl::move(value));
+        ++tail_;
+        return true;
+    }
+
+    void pop_front() {
+        TINYSTL_DEBUG(!empty());
+        tinystl::destroy(buf_ + (head_ & mask_));
+        ++head_;
+    }
+
+    void pop_back() {
+        TINYSTL_DEBUG(!empty());
+        --tail_;
+        tinystl::destroy(buf_ + (tail_ & mask_));
+    }
+
+    /// @brief 删除全部元素，保留缓冲区
+    void clear() noexcept {
+        consume_front(size());
+        head_ = tail_ = 0;
+    }
+
+    void swap(ring_buffer& rhs) noexcept {
+        tinystl::swap(buf_, rhs.buf_);
+        tinystl::swap(mask_, rhs.mask_);
+        tinystl::swap(cap_, rhs.cap_);
+        tinystl::swap(head_, rhs.head_);
+        tinystl::swap(tail_, rhs.tail_);
+    }
+
+private:  // 辅助函数
+    size_type next_capacity() const {
+        THROW_LENGTH_ERROR_IF(!Growable, "ring_buffer<T> is full");
+        return cap_ == 0 ? min_capacity : cap_ * 2;
+    }
+
+    void relocate_to(T* new_buf, size_type new_cap, size_type offset);
+
+    template <class... Args>
+    void realloc_emplace_back(Args&&... args);
+
+    template <class... Args>
+    void realloc_emplace_front(Args&&... args);
+
+    template <class Iter>
+    void copy_init(Iter first, Iter last, input_iterator_tag) {
+        for (; first != last; ++first) emplace_back(*first);
+    }
+
+    template <class Iter>
+    void copy_init(Iter first, Iter last, forward_iterator_tag) {
+        reserve(static_cast<size_type>(tinystl::distance(first, last)));
+        for (; first != last; ++first) emplace_back(*first);
+    }
+};
+
+template <class T, bool Growable, class Alloc>
+constexpr typename ring_buffer<T, Growable, Alloc>::size_type ring_buffer<T, Growable, Alloc>::min_capacity;
+
+// ==================================== 函数实现 ==================================== //
+
+template <class T, bool Growable, class Alloc>
+void ring_buffer<T, Growable, Alloc>::reserve(size_type n) {
+    if (n <= cap_) return;
+    THROW_LENGTH_ERROR_IF(n > max_size(), "ring_buffer<T>'s size too big");
+    size_type new_cap = min_capacity;
+    while (new_cap < n) new_cap <<= 1;
+    relocate_to(data_allocator::allocate(new_cap), new_cap, 0);
+}
+
+/// @brief 把两段元素依次搬到新缓冲区中从绝对位置 offset 开始的地方，归还旧缓冲区并改用新缓冲区
+template <class T, bool Growable, class Alloc>
+void ring_buffer<T, Growable, Alloc>::relocate_to(T* new_buf, size_type new_cap, size_type offset) {
+    const size_type n = size();
+    if (buf_ != nullptr) {
+        const segment one = array_one();
+        const segment two = array_two();
+        T* p = tinystl::uninitialized_relocate(one.first, one.first + one.second,
+                                               new_buf + (offset & (new_cap - 1)));
+        tinystl::uninitialized_relocate(two.first, two.first + two.second, p);
+        data_allocator::deallocate(buf_, cap_);
+    }
+    buf_ = new_buf;
+    cap_ = new_cap;
+    mask_ = new_cap - 1;
+    head_ = offset;
+    tail_ = offset + n;
+}
+
+/// @brief 满时在尾部构造元素：先在新缓冲区中构造（参数可能引用旧元素），再搬移旧元素
+template <class T, bool Growable, class Alloc>
+template <class... Args>
+void ring_buffer<T, Growable, Alloc>::realloc_emplace_back(Args&&... args) {
+    const size_type new_cap = next_capacity();
+    T* new_buf = data_allocator::allocate(new_cap);
+    try {
+        tinystl::construct(new_buf + size(), tinystl::forward<Args>(args)...);
+    }
+    catch (...) {
+        data_allocator::deallocate(new_buf, new_cap);
+        throw;
+    }
+    relocate_to(new_buf, new_cap, 0);
+    ++tail_;
+}
+
+/// @brief 满时在头部构造元素：新元素放在新缓冲区的最后一格，旧元素从开头放起，回绕后正好相接
+template <class T, bool Growable, class Alloc>
+template <class... Args>
+void ring_buffer<T, Growable, Alloc>::realloc_emplace_front(Args&&... args) {
+    const size_type new_cap = next_capacity();
+    T* new_buf = data_allocator::allocate(new_cap);
+    try {
+        tinystl::construct(new_buf + (new_cap - 1), tinystl::forward<Args>(args)...);
+    }
+    catch (...) {
+        data_allocator::deallocate(new_buf, new_cap);
+        throw;
+    }
+    relocate_to(new_buf, new_cap, new_cap);
+    --head_;
+}
+
+// ==================================== 重载比较操作符 ==================================== //
+
+template <class T, bool Growable, class Alloc>
+bool operator==(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return lhs.size() == rhs.size() && tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, bool Growable, class Alloc>
+bool operator<(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, bool Growable, class Alloc>
+bool operator!=(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, bool Growable, class Alloc>
+bool operator>(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, bool Growable, class Alloc>
+bool operator<=(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, bool Growable, class Alloc>
+bool operator>=(const ring_buffer<T, Growable, Alloc>& lhs, const ring_buffer<T, Growable, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
+
+// ==================================== 重载 swap ==================================== //
+
+template <class T, bool Growable, class Alloc>
+void swap(ring_buffer<T, Growable, Alloc>& lhs, ring_buffer<T, Growable, Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_RING_BUFFER_H_
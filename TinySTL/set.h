@@ -22,7 +22,8 @@ namespace tinystl {
 /// @brief 模板类 set，键值不允许重复
 /// @tparam Key  键值类型
 /// @tparam Compare  键值比较方式，缺省使用 tinystl::less
-template <class Key, class Compare = tinystl::less<Key>>
+/// @tparam Alloc  节点的空间配置器，缺省使用 tinystl::alloc
+template <class Key, class Compare = tinystl::less<Key>, class Alloc = alloc>
 class set {
 
 public:  // set 的型别定义
@@ -33,7 +34,7 @@ public:  // set 的型别定义
 
 private:  // 内部型别定义
     // 以 tinystl::rb_tree 作为底层机制
-    typedef tinystl::rb_tree<value_type, key_compare> base_type;
+    typedef tinystl::rb_tree<value_type, key_compare, Alloc> base_type;
     base_type tree_;  // 底层红黑树
 
 public:  // 使用 rb_tree 定义的型别
@@ -175,39 +176,39 @@ public:
 };
 
 // 重载比较操作符
-template <class Key, class Compare>
-bool operator==(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator==(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return lhs == rhs;
 }
 
-template <class Key, class Compare>
-bool operator<(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator<(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return lhs < rhs;
 }
 
-template <class Key, class Compare>
-bool operator!=(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator!=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class Key, class Compare>
-bool operator>(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator>(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return rhs < lhs;
 }
 
-template <class Key, class Compare>
-bool operator<=(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator<=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return !(rhs < lhs);
 }
 
-template <class Key, class Compare>
-bool operator>=(const set<Key, Compare>& lhs, const set<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator>=(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) {
     return !(lhs < rhs);
 }
 
 // 重载 swap
-template <class Key, class Compare>
-void swap(set<Key, Compare>& lhs, set<Key, Compare>& rhs) noexcept {
+template <class Key, class Compare, class Alloc>
+void swap(set<Key, Compare, Alloc>& lhs, set<Key, Compare, Alloc>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
@@ -217,7 +218,8 @@ void swap(set<Key, Compare>& lhs, set<Key, Compare>& rhs) noexcept {
 /// @brief 模板类 multiset，键值允许重复
 /// @tparam Key  键值类型
 /// @tparam Compare  键值比较方式，缺省使用 tinystl::less
-template <class Key, class Compare = tinystl::less<Key>>
+/// @tparam Alloc  节点的空间配置器，缺省使用 tinystl::alloc
+template <class Key, class Compare = tinystl::less<Key>, class Alloc = alloc>
 class multiset {
 
 public:  // multiset 的型别定义
@@ -228,7 +230,7 @@ public:  // multiset 的型别定义
 
 private:  // 内部型别定义
     // 以 tinystl::rb_tree 作为底层机制
-    typedef tinystl::rb_tree<value_type, key_compare> base_type;
+    typedef tinystl::rb_tree<value_type, key_compare, Alloc> base_type;
     base_type tree_;  // 底层红黑树
 
 public:  // 使用 rb_tree 定义的型别
@@ -370,39 +372,39 @@ public:
 };
 
 // 重载比较操作符
-template <class Key, class Compare>
-bool operator==(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator==(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return lhs == rhs;
 }
 
-template <class Key, class Compare>
-bool operator<(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator<(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return lhs < rhs;
 }
 
-template <class Key, class Compare>
-bool operator!=(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator!=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class Key, class Compare>
-bool operator>(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator>(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return rhs < lhs;
 }
 
-template <class Key, class Compare>
-bool operator<=(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator<=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return !(rhs < lhs);
 }
 
-template <class Key, class Compare>
-bool operator>=(const multiset<Key, Compare>& lhs, const multiset<Key, Compare>& rhs) {
+template <class Key, class Compare, class Alloc>
+bool operator>=(const multiset<Key, Compare, Alloc>& lhs, const multiset<Key, Compare, Alloc>& rhs) {
     return !(lhs < rhs);
 }
 
 // 重载 mystl 的 swap
-template <class Key, class Compare>
-void swap(multiset<Key, Compare>& lhs, multiset<Key, Compare>& rhs) noexcept {
+template <class Key, class Compare, class Alloc>
+void swap(multiset<Key, Compare, Alloc>& lhs, multiset<Key, Compare, Alloc>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
@@ -0,0 +1,704 @@
+#ifndef TINYSTL_SMALL_VECTOR_H_
+#define TINYSTL_SMALL_VECTOR_H_
+
+// 这个头文件包含一个模板类 small_vector
+// small_vector : 带有内联存储的 vector，不超过 N 个元素时不申请堆内存
+
+// notes:
+//
+// small_vector<T, N> 的接口与 vector 相同，迭代器同样是普通指针，可以直接用于 tinystl 的各种算法。
+// 对象内部预留了 N 个元素的未初始化空间：
+//   * 元素个数不超过 N 时，begin_ 指向内联空间，构造、push_back、析构都不涉及空间配置器
+//   * 超过 N 时与 vector 一样按 1.5 倍申请堆空间，并把元素搬过去；之后 clear 也不会回到内联空间，
+//     调用 shrink_to_fit 且 size() <= N 时才会搬回
+//   * 内联空间位于对象内部，因此移动构造 / 移动赋值 / swap 在内联状态下需要逐个移动元素，
+//     而不是像 vector 那样只交换指针；迭代器在这些操作后同样失效
+//
+// 元素搬移遵循 vector 的约定：可平凡重定位的类型（见 is_trivially_relocatable）直接按字节复制。
+//
+// 异常保证：
+// 与 vector 相同，emplace_back / push_back / insert 单个元素满足强异常安全保证。
+
+#include <initializer_list>  // std::initializer_list
+#include <type_traits>       // std::aligned_storage
+
+#include "iterator.h"
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+#include "algo.h"
+#include "alloc.h"
+
+namespace tinystl {
+
+/// @brief 模板类 small_vector
+/// @tparam T  元素类型
+/// @tparam N  内联存储的元素个数
+/// @tparam Alloc  超出内联容量后使用的空间配置器
+template <class T, size_t N, class Alloc = alloc>
+class small_vector {
+
+static_assert(N > 0, "small_vector requires N > 0, use vector instead");
+static_assert(!std::is_same<bool, T>::value, "small_vector<bool> is abandoned in tinystl");
+
+public:
+    // small_vector 的嵌套型别定义
+    typedef simple_alloc<T, Alloc>                       data_allocator;
+    typedef simple_alloc<T, Alloc>                       allocator_type;
+
+    typedef T                  value_type;
+    typedef value_type*        pointer;
+    typedef const value_type*  const_pointer;
+    typedef value_type&        reference;
+    typedef const value_type&  const_reference;
+    typedef size_t             size_type;
+    typedef ptrdiff_t          difference_type;
+
+    typedef value_type*                                   iterator;
+    typedef const value_type*                             const_iterator;
+    typedef tinystl::reverse_iterator<iterator>           reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+    static constexpr size_type inline_capacity = N;  // 内联存储的容量
+
+    allocator_type get_allocator() { return data_allocator(); }
+
+private:
+    static constexpr bool relocatable = tinystl::is_trivially_relocatable<T>::value;
+
+    iterator begin_;        // 表示目前使用空间的头
+    iterator end_;          // 表示目前使用空间的尾
+    iterator cap_;          // 表示目前可用空间的尾
+
+    // 内联存储，仅提供大小与对齐，元素在其上按需构造
+    typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type buf_;
+
+public:
+
+    // =========================  构造函数  ========================= //
+
+    small_vector() noexcept { reset_inline(); }
+
+    explicit small_vector(size_type n) {
+        reset_inline();
+        guarded_init([&] { resize(n); });
+    }
+
+    small_vector(size_type n, const value_type& value) {
+        reset_inline();
+        guarded_init([&] { insert(end_, n, value); });
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    small_vector(Iter first, Iter last) {
+        reset_inline();
+        guarded_init([&] { insert(end_, first, last); });
+    }
+
+    small_vector(const small_vector& rhs) {
+        reset_inline();
+        guarded_init([&] { insert(end_, rhs.begin_, rhs.end_); });
+    }
+
+    small_vector(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        reset_inline();
+        take(rhs);
+    }
+
+    small_vector(std::initializer_list<value_type> ilist) {
+        reset_inline();
+        guarded_init([&] { insert(end_, ilist.begin(), ilist.end()); });
+    }
+
+    // =========================  赋值运算符  ========================= //
+
+    small_vector& operator=(const small_vector& rhs) {
+        if (this != &rhs) {
+            assign(rhs.begin_, rhs.end_);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &rhs) {
+            release();
+            take(rhs);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    // =========================  析构函数  ========================= //
+
+    ~small_vector() { release(); }
+
+public:
+    // =========================  迭代器相关操作  ====================== //
+
+    iterator begin() noexcept { return begin_; }
+    const_iterator begin() const noexcept { return begin_; }
+    iterator end() noexcept { return end_; }
+    const_iterator end() const noexcept { return end_; }
+
+    reverse_iterator rbegin() noexcept
+        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept
+        { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept
+        { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept
+        { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator crbegin() const noexcept
+        { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept
+        { return const_reverse_iterator(begin()); }
+
+    // =========================  容量相关操作  ====================== //
+
+    bool empty() const noexcept { return begin_ == end_; }
+
+    size_type size() const noexcept
+        { return static_cast<size_type>(end_ - begin_); }
+
+    size_type max_size() const noexcept
+        { return static_cast<size_type>(-1) / sizeof(T); }
+
+    size_type capacity() const noexcept
+        { return static_cast<size_type>(cap_ - begin_); }
+
+    // 元素是否存放在内联空间中
+    bool is_inline() const noexcept { return begin_ == inline_data(); }
+
+    void reserve(size_type n) {
+        if (capacity() < n) {
+            THROW_LENGTH_ERROR_IF(n > max_size(),
+                "n can not larger than max_size() in small_vector<T, N>::reserve(n)");
+            reallocate(n);
+        }
+    }
+
+    void shrink_to_fit();
+
+    // =========================  元素访问相关操作  ====================== //
+
+    reference operator[](size_type n) {
+        TINYSTL_DEBUG(n < size());
+        return *(begin_ + n);
+    }
+
+    const_reference operator[](size_type n) const {
+        TINYSTL_DEBUG(n < size());
+        return *(begin_ + n);
+    }
+
+    reference at(size_type n) {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "small_vector<T, N>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    const_reference at(size_type n) const {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "small_vector<T, N>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return *begin_;
+    }
+
+    const_reference front() const {
+        TINYSTL_DEBUG(!empty());
+        return *begin_;
+    }
+
+    reference back() {
+        TINYSTL_DEBUG(!empty());
+        return *(end_ - 1);
+    }
+
+    const_reference back() const {
+        TINYSTL_DEBUG(!empty());
+        return *(end_ - 1);
+    }
+
+    pointer data() noexcept { return begin_; }
+    const_pointer data() const noexcept { return begin_; }
+
+    // =========================  修改容器相关操作  ====================== //
+
+    // assign
+
+    void assign(size_type n, const value_type& value) {
+        const value_type value_copy = value;  // value 可能是容器内的元素
+        clear();
+        insert(end_, n, value_copy);
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    void assign(Iter first, Iter last) {
+        clear();
+        insert(end_, first, last);
+    }
+
+    void assign(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    // emplace / emplace_back
+
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+
+    template <class... Args>
+    void emplace_back(Args&&... args) {
+        if (end_ != cap_) {
+            tinystl::construct(end_, tinystl::forward<Args>(args)...);
+            ++end_;
+        }
+        else {
+            grow_emplace_back(tinystl::forward<Args>(args)...);
+        }
+    }
+
+    // push_back / pop_back
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(tinystl::move(value)); }
+
+    void pop_back() {
+        TINYSTL_DEBUG(!empty());
+        --end_;
+        tinystl::destroy(end_);
+    }
+
+    // insert
+
+    iterator insert(const_iterator pos, const value_type& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, tinystl::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const value_type& value);
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    iterator insert(const_iterator pos, Iter first, Iter last) {
+        TINYSTL_DEBUG(pos >= begin() && pos <= end());
+        return range_insert(const_cast<iterator>(pos), first, last, tinystl::iterator_category(first));
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    // erase / clear
+
+    iterator erase(const_iterator pos) {
+        TINYSTL_DEBUG(pos >= begin() && pos < end());
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last);
+
+    void clear() noexcept {
+        tinystl::destroy(begin_, end_);
+        end_ = begin_;
+    }
+
+    // resize / reverse
+
+    void resize(size_type new_size);
+    void resize(size_type new_size, const value_type& value);
+
+    void reverse() { tinystl::reverse(begin(), end()); }
+
+    // swap
+
+    void swap(small_vector& rhs);
+
+private:
+    // =========================  辅助函数  ====================== //
+
+    pointer inline_data() noexcept { return reinterpret_cast<pointer>(&buf_); }
+    const_pointer inline_data() const noexcept { return reinterpret_cast<const_pointer>(&buf_); }
+
+    void reset_inline() noexcept {
+        begin_ = end_ = inline_data();
+        cap_ = begin_ + N;
+    }
+
+    // 构造函数中途抛出异常时析构函数不会被调用，需要自行释放已构造的元素和堆空间
+    template <class F>
+    void guarded_init(F f) {
+        try {
+            f();
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    // 析构全部元素并归还堆空间，之后回到空的内联状态
+    void release() noexcept {
+        tinystl::destroy(begin_, end_);
+        if (!is_inline()) {
+            data_allocator::deallocate(begin_, capacity());
+        }
+        reset_inline();
+    }
+
+    // 接管 rhs 的元素：rhs 在堆上时直接接管指针，否则逐个搬到自身的内联空间；要求自身为空的内联状态
+    void take(small_vector& rhs) {
+        if (!rhs.is_inline()) {
+            begin_ = rhs.begin_;
+            end_ = rhs.end_;
+            cap_ = rhs.cap_;
+        }
+        else {
+            end_ = tinystl::uninitialized_relocate(rhs.begin_, rhs.end_, begin_);
+        }
+        rhs.reset_inline();
+    }
+
+    size_type get_new_cap(size_type add_size) const;
+
+    void reallocate(size_type new_cap);
+    void move_to(pointer new_begin, size_type new_cap);
+
+    template <class... Args>
+    void grow_emplace_back(Args&&... args);
+
+    // relocate，仅用于可平凡重定位的元素
+    void open_gap(iterator pos, size_type n) {
+        tinystl::relocate_bytes(pos + n, pos, static_cast<size_type>(end_ - pos));
+        end_ += n;
+    }
+
+    void close_gap(iterator pos, size_type n) {
+        tinystl::relocate_bytes(pos, pos + n, static_cast<size_type>(end_ - pos) - n);
+        end_ -= n;
+    }
+
+    template <class InputIter>
+    iterator range_insert(iterator pos, InputIter first, InputIter last, tinystl::input_iterator_tag);
+
+    template <class ForwardIter>
+    iterator range_insert(iterator pos, ForwardIter first, ForwardIter last, tinystl::forward_iterator_tag);
+
+};  // class small_vector
+
+template <class T, size_t N, class Alloc>
+constexpr typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+
+template <class T, size_t N, class Alloc>
+constexpr bool small_vector<T, N, Alloc>::relocatable;
+
+// =========================  函数实现  ====================== //
+
+/// @brief 释放多余空间，元素个数不超过 N 时搬回内联空间
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::shrink_to_fit() {
+    if (is_inline() || end_ == cap_) return;
+    if (size() <= N) {
+        move_to(inline_data(), N);
+    }
+    else {
+        reallocate(size());
+    }
+}
+
+/// @brief 在 pos 处就地构造元素
+/// @return  返回指向新构造元素的迭代器
+template <class T, size_t N, class Alloc>
+template <class... Args>
+typename small_vector<T, N, Alloc>::iterator
+small_vector<T, N, Alloc>::emplace(const_iterator pos, Args&&... args) {
+    TINYSTL_DEBUG(pos >= begin() && pos <= end());
+    const size_type n = static_cast<size_type>(pos - begin_);
+    if (pos == end_) {
+        emplace_back(tinystl::forward<Args>(args)...);
+        return begin_ + n;
+    }
+    value_type tmp(tinystl::forward<Args>(args)...);  // 先构造，参数可能引用容器内的元素
+    if (end_ == cap_) {
+        reallocate(get_new_cap(1));
+    }
+    iterator xpos = begin_ + n;
+    if (relocatable) {
+        open_gap(xpos, 1);
+        try {
+            tinystl::construct(xpos, tinystl::move(tmp));
+        }
+        catch (...) {
+            close_gap(xpos, 1);
+            throw;
+        }
+    }
+    else {
+        tinystl::construct(end_, tinystl::move(*(end_ - 1)));
+        ++end_;
+        tinystl::move_backward(xpos, end_ - 2, end_ - 1);
+        *xpos = tinystl::move(tmp);
+    }
+    return xpos;
+}
+
+/// @brief 在 pos 处插入 n 个 value
+/// @return  返回指向第一个新元素的迭代器
+template <class T, size_t N, class Alloc>
+typename small_vector<T, N, Alloc>::iterator
+small_vector<T, N, Alloc>::insert(const_iterator pos, size_type n, const value_type& value) {
+    TINYSTL_DEBUG(pos >= begin() && pos <= end());
+    const size_type off = static_cast<size_type>(pos - begin_);
+    if (n == 0) return begin_ + off;
+    const value_type value_copy = value;  // value 可能是容器内的元素
+    if (static_cast<size_type>(cap_ - end_) < n) {
+        reallocate(get_new_cap(n));
+    }
+    iterator xpos = begin_ + off;
+    if (relocatable) {
+        open_gap(xpos, n);
+        try {
+            tinystl::uninitialized_fill_n(xpos, n, value_copy);
+        }
+        catch (...) {
+            close_gap(xpos, n);
+            throw;
+        }
+    }
+    else {
+        // 先追加到尾部，再旋转到 pos 处
+        auto old_end = end_;
+        end_ = tinystl::uninitialized_fill_n(end_, n, value_copy);
+        tinystl::rotate(xpos, old_end, end_);
+    }
+    return xpos;
+}
+
+/// @brief 删除 [first, last) 区间上的元素
+/// @return  返回指向被删除区间的下一个元素的迭代器
+template <class T, size_t N, class Alloc>
+typename small_vector<T, N, Alloc>::iterator
+small_vector<T, N, Alloc>::erase(const_iterator first, const_iterator last) {
+    TINYSTL_DEBUG(first >= begin() && last <= end() && !(last < first));
+    iterator xfirst = begin_ + (first - begin_);
+    const size_type n = static_cast<size_type>(last - first);
+    if (n == 0) return xfirst;
+    if (relocatable) {
+        tinystl::destroy(xfirst, xfirst + n);
+        close_gap(xfirst, n);
+    }
+    else {
+        auto new_end = tinystl::move(xfirst + n, end_, xfirst);
+        tinystl::destroy(new_end, end_);
+        end_ = new_end;
+    }
+    return xfirst;
+}
+
+/// @brief 重置容器大小，新增的元素值初始化
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::resize(size_type new_size) {
+    if (new_size < size()) {
+        erase(begin_ + new_size, end_);
+    }
+    else {
+        reserve(new_size);
+        while (end_ != begin_ + new_size) {
+            tinystl::construct(end_);
+            ++end_;
+        }
+    }
+}
+
+/// @brief 重置容器大小，新增的元素为 value 的副本
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::resize(size_type new_size, const value_type& value) {
+    if (new_size < size()) {
+        erase(begin_ + new_size, end_);
+    }
+    else {
+        insert(end_, new_size - size(), value);
+    }
+}
+
+/// @brief 与 rhs 交换内容，两者都在堆上时只交换指针，否则逐个移动元素
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::swap(small_vector& rhs) {
+    if (this == &rhs) return;
+    if (!is_inline() && !rhs.is_inline()) {
+        tinystl::swap(begin_, rhs.begin_);
+        tinystl::swap(end_, rhs.end_);
+        tinystl::swap(cap_, rhs.cap_);
+        return;
+    }
+    small_vector tmp(tinystl::move(rhs));
+    rhs = tinystl::move(*this);
+    *this = tinystl::move(tmp);
+}
+
+/// @brief 计算扩容后的容量，每次增加 1.5 倍，与 vector 不同，没有 16 个元素的下限
+template <class T, size_t N, class Alloc>
+typename small_vector<T, N, Alloc>::size_type
+small_vector<T, N, Alloc>::get_new_cap(size_type add_size) const {
+    const auto old_size = capacity();
+    THROW_LENGTH_ERROR_IF(old_size > max_size() - add_size,
+        "small_vector<T, N>'s size too big");
+    if (old_size > max_size() - old_size / 2) {
+        return old_size + add_size;
+    }
+    return tinystl::max(old_size + old_size / 2, size() + add_size);
+}
+
+/// @brief 申请 new_cap 大小的堆空间并把元素搬过去
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::reallocate(size_type new_cap) {
+    auto new_begin = data_allocator::allocate(new_cap);
+    try {
+        move_to(new_begin, new_cap);
+    }
+    catch (...) {
+        data_allocator::deallocate(new_begin, new_cap);
+        throw;
+    }
+}
+
+/// @brief 把元素搬到 new_begin 开始的空间（堆空间或内联空间），并归还原来的堆空间
+template <class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::move_to(pointer new_begin, size_type new_cap) {
+    const size_type n = size();
+    if (relocatable) {
+        tinystl::relocate_bytes(new_begin, begin_, n);
+    }
+    else {
+        tinystl::uninitialized_move(begin_, end_, new_begin);
+        tinystl::destroy(begin_, end_);
+    }
+    if (!is_inline()) {
+        data_allocator::deallocate(begin_, capacity());
+    }
+    begin_ = new_begin;
+    end_ = new_begin + n;
+    cap_ = new_begin + new_cap;
+}
+
+/// @brief 空间已满时在尾部构造元素：先在新空间中构造（参数可能引用旧元素），再搬移旧元素
+template <class T, size_t N, class Alloc>
+template <class... Args>
+void small_vector<T, N, Alloc>::grow_emplace_back(Args&&... args) {
+    const size_type new_cap = get_new_cap(1);
+    const size_type n = size();
+    auto new_begin = data_allocator::allocate(new_cap);
+    try {
+        tinystl::construct(new_begin + n, tinystl::forward<Args>(args)...);
+    }
+    catch (...) {
+        data_allocator::deallocate(new_begin, new_cap);
+        throw;
+    }
+    move_to(new_begin, new_cap);
+    ++end_;
+}
+
+/// @brief 在 pos 处插入 [first, last)，输入迭代器只能逐个追加到尾部，再旋转到 pos 处
+template <class T, size_t N, class Alloc>
+template <class InputIter>
+typename small_vector<T, N, Alloc>::iterator
+small_vector<T, N, Alloc>::range_insert(iterator pos, InputIter first, InputIter last,
+    tinystl::input_iterator_tag) {
+    const size_type off = static_cast<size_type>(pos - begin_);
+    const size_type old_size = size();
+    for (; first != last; ++first) {
+        emplace_back(*first);
+    }
+    tinystl::rotate(begin_ + off, begin_ + old_size, end_);
+    return begin_ + off;
+}
+
+/// @brief 在 pos 处插入 [first, last)，一次预留足够的空间
+template <class T, size_t N, class Alloc>
+template <class ForwardIter>
+typename small_vector<T, N, Alloc>::iterator
+small_vector<T, N, Alloc>::range_insert(iterator pos, ForwardIter first, ForwardIter last,
+    tinystl::forward_iterator_tag) {
+    const size_type off = static_cast<size_type>(pos - begin_);
+    const size_type n = static_cast<size_type>(tinystl::distance(first, last));
+    if (n == 0) return begin_ + off;
+    if (static_cast<size_type>(cap_ - end_) < n) {
+        reallocate(get_new_cap(n));
+    }
+    iterator xpos = begin_ + off;
+    if (relocatable) {
+        open_gap(xpos, n);
+        try {
+            tinystl::uninitialized_copy(first, last, xpos);
+        }
+        catch (...) {
+            close_gap(xpos, n);
+            throw;
+        }
+    }
+    else {
+        auto old_end = end_;
+        end_ = tinystl::uninitialized_copy(first, last, end_);
+        tinystl::rotate(xpos, old_end, end_);
+    }
+    return xpos;
+}
+
+// =========================  比较操作符  ====================== //
+
+template <class T, size_t N, class Alloc>
+bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return lhs.size() == rhs.size() &&
+        tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, size_t N, class Alloc>
+bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, size_t N, class Alloc>
+bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, size_t N, class Alloc>
+bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, size_t N, class Alloc>
+bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, size_t N, class Alloc>
+bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+    return !(lhs < rhs);
+}
+
+// =========================  重载 swap  ====================== //
+
+template <class T, size_t N, class Alloc>
+void swap(small_vector<T, N, Alloc>& lhs, small_vector<T, N, Alloc>& rhs) {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_SMALL_VECTOR_H_
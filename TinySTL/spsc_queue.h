@@ -0,0 +1,225 @@
+#ifndef TINYSTL_SPSC_QUEUE_H_
+#define TINYSTL_SPSC_QUEUE_H_
+
+// 这个头文件包含一个模板类 spsc_queue
+// spsc_queue : 单生产者单消费者的无锁有界队列，用于连接两个线程
+
+// notes:
+//
+// queue 与 stack 只是单线程容器的配接器，跨线程使用时需要外加互斥锁，消息频繁时锁的开销占了大头。
+// spsc_queue 限定只有一个线程 push、一个线程 pop，于是不需要锁，也不需要 CAS：
+//   * 容量为 2 的幂的环形缓冲区，head_ / tail_ 是只增不减的计数器，下标为 计数器 & (容量 - 1)
+//   * tail_ 只由生产者写，head_ 只由消费者写；写入对方可见的计数器用 release，读取对方的计数器用 acquire，
+//     元素的构造 / 析构由这一对同步关系保证先于对方看到新的计数器
+//   * 两个计数器以及各自一方缓存的对方计数器分别放在不同的缓存行（SPSC_QUEUE_CACHE_LINE）中，避免伪共享；
+//     生产者在缓存的 head 显示已满时才重新读取 head_，消费者同理，多数操作不触碰对方的缓存行
+//   * try_push_n / try_pop_n 一次搬运多个元素，只发布一次计数器
+//   * push / front / pop 与 queue 的用法相同：push 在队列满时让出线程直到有空位，
+//     front / pop 要求队列非空（消费者先用 empty() 检查），也可以使用 try_push / try_pop
+//   * 只使用 acquire / release 与 relaxed 的读写，不使用读-改-写操作与 seq_cst
+//   * 生产者的函数：try_push, try_emplace, push, emplace, try_push_n
+//     消费者的函数：empty, front, pop, try_pop, try_pop_n
+//     size 只是某一时刻的近似值
+
+#include <atomic>
+#include <thread>
+
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+// 计数器之间的间隔，取两个缓存行以免相邻缓存行预取造成伪共享
+#ifndef SPSC_QUEUE_CACHE_LINE
+#define SPSC_QUEUE_CACHE_LINE 128
+#endif
+
+/// @brief 单生产者单消费者的无锁有界队列
+/// @tparam T      元素类型
+/// @tparam Alloc  空间配置器
+template <class T, class Alloc = alloc>
+class spsc_queue {
+public:
+    typedef simple_alloc<T, Alloc>  data_allocator;
+    typedef simple_alloc<T, Alloc>  allocator_type;
+
+    typedef T                       value_type;
+    typedef value_type*             pointer;
+    typedef value_type&             reference;
+    typedef const value_type&       const_reference;
+    typedef size_t                  size_type;
+
+    allocator_type get_allocator() { return allocator_type(); }
+
+private:
+    // 消费者一侧：消费者写 head_，cached_tail_ 是消费者已知的 tail_ 下界，始终不小于 head_
+    alignas(SPSC_QUEUE_CACHE_LINE) std::atomic<size_type> head_;
+    mutable size_type                                    cached_tail_;
+
+    // 生产者一侧：生产者写 tail_，cached_head_ 是生产者最近一次读到的 head_
+    alignas(SPSC_QUEUE_CACHE_LINE) std::atomic<size_type> tail_;
+    size_type                                            cached_head_;
+
+    // 构造后只读
+    alignas(SPSC_QUEUE_CACHE_LINE) T* buf_;
+    size_type                         mask_;
+
+public:  // 构造、析构函数
+    /// @brief 容量为不小于 n 的 2 的幂，至少为 2
+    explicit spsc_queue(size_type n) : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+        THROW_LENGTH_ERROR_IF(n > (static_cast<size_type>(-1) >> 1) / sizeof(T), "spsc_queue<T>'s size too big");
+        size_type cap = 2;
+        while (cap < n) cap <<= 1;
+        buf_ = data_allocator::allocate(cap);
+        mask_ = cap - 1;
+    }
+
+    // 两个线程共享同一个对象，不允许复制与移动
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue& operator=(const spsc_queue&) = delete;
+
+    ~spsc_queue() {
+        const size_type t = tail_.load(std::memory_order_acquire);
+        for (size_type h = head_.load(std::memory_order_relaxed); h != t; ++h) {
+            tinystl::destroy(buf_ + (h & mask_));
+        }
+        data_allocator::deallocate(buf_, mask_ + 1);
+    }
+
+public:  // 容量相关操作
+    size_type capacity() const noexcept { return mask_ + 1; }
+
+    /// @brief 是否没有可读的元素，由消费者调用
+    bool empty() const noexcept {
+        const size_type h = head_.load(std::memory_order_relaxed);
+        if (h != cached_tail_) return false;
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        return h == cached_tail_;
+    }
+
+    /// @brief 近似的元素个数
+    size_type size() const noexcept {
+        const size_type h = head_.load(std::memory_order_acquire);
+        const size_type t = tail_.load(std::memory_order_acquire);
+        return t - h;
+    }
+
+public:  // 生产者
+    template <class... Args>
+    bool try_emplace(Args&&... args) {
+        const size_type t = tail_.load(std::memory_order_relaxed);
+        if (t - cached_head_ == capacity()) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (t - cached_head_ == capacity()) return false;
+        }
+        tinystl::construct(buf_ + (t & mask_), tinystl::forward<Args>(args)...);
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value)      { return try_emplace(tinystl::move(value)); }
+
+    /// @brief 队列满时让出线程，直到放入为止
+    template <class... Args>
+    void emplace(Args&&... args) {
+        // 只有放入成功时参数才会被使用，所以可以反复转发
+        while (!try_emplace(tinystl::forward<Args>(args)...)) std::this_thread::yield();
+    }
+
+    void push(const value_type& value) { emplace(value); }
+    void push(value_type&& value)      { emplace(tinystl::move(value)); }
+
+    /// @brief 从 first 开始至多放入 n 个元素，返回实际放入的个数；构造抛出异常时一个也不放入
+    template <class InputIter>
+    size_type try_push_n(InputIter first, size_type n);
+
+public:  // 消费者
+    /// @brief 队首元素，要求队列非空
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return buf_[head_.load(std::memory_order_relaxed) & mask_];
+    }
+
+    /// @brief 删除队首元素，要求队列非空
+    void pop() {
+        TINYSTL_DEBUG(!empty());
+        const size_type h = head_.load(std::memory_order_relaxed);
+        tinystl::destroy(buf_ + (h & mask_));
+        if (cached_tail_ == h) cached_tail_ = h + 1;  // 队列非空说明 tail_ 至少为 h + 1
+        head_.store(h + 1, std::memory_order_release);
+    }
+
+    /// @brief 队列非空时把队首元素移动到 value 并删除，返回是否成功
+    bool try_pop(value_type& value) {
+        const size_type h = head_.load(std::memory_order_relaxed);
+        if (h == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (h == cached_tail_) return false;
+        }
+        T* p = buf_ + (h & mask_);
+        value = tinystl::move(*p);
+        tinystl::destroy(p);
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief 至多取出 n 个元素依次移动到 result，返回实际取出的个数
+    template <class OutputIter>
+    size_type try_pop_n(OutputIter result, size_type n);
+};
+
+// ==================================== 函数实现 ==================================== //
+
+template <class T, class Alloc>
+template <class InputIter>
+typename spsc_queue<T, Alloc>::size_type
+spsc_queue<T, Alloc>::try_push_n(InputIter first, size_type n) {
+    const size_type t = tail_.load(std::memory_order_relaxed);
+    size_type space = capacity() - (t - cached_head_);
+    if (space < n) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        space = capacity() - (t - cached_head_);
+    }
+    const size_type m = tinystl::min(n, space);
+    size_type i = 0;
+    try {
+        for (; i < m; ++i, ++first) {
+            tinystl::construct(buf_ + ((t + i) & mask_), *first);
+        }
+    }
+    catch (...) {
+        // 已构造的元素尚未发布，析构后 tail_ 不变，下次放入时这些槽位仍是未初始化的
+        for (size_type k = 0; k < i; ++k) {
+            tinystl::destroy(buf_ + ((t + k) & mask_));
+        }
+        throw;
+    }
+    if (m != 0) tail_.store(t + m, std::memory_order_release);
+    return m;
+}
+
+template <class T, class Alloc>
+template <class OutputIter>
+typename spsc_queue<T, Alloc>::size_type
+spsc_queue<T, Alloc>::try_pop_n(OutputIter result, size_type n) {
+    const size_type h = head_.load(std::memory_order_relaxed);
+    size_type avail = cached_tail_ - h;
+    if (avail < n) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        avail = cached_tail_ - h;
+    }
+    const size_type m = tinystl::min(n, avail);
+    for (size_type i = 0; i < m; ++i, ++result) {
+        T* p = buf_ + ((h + i) & mask_);
+        *result = tinystl::move(*p);
+        tinystl::destroy(p);
+    }
+    if (m != 0) head_.store(h + m, std::memory_order_release);
+    return m;
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_SPSC_QUEUE_H_
@@ -38,6 +38,29 @@ namespace tinystl {
     template <class T1, class T2>
     struct is_pair<tinystl::pair<T1, T2>> : tinystl::m_true_type {};
 
+    // ================================================================== // 
+
+    // is_trivially_relocatable
+    // 若把一个对象按字节复制到新地址、并且不再对原对象调用析构函数，结果与“移动构造 + 析构原对象”等价，
+    // 则称该类型可平凡重定位。vector / deque 搬移这类元素时直接使用 memcpy / memmove。
+    // 缺省只包含平凡移动构造且平凡析构的类型；只持有指针的句柄类（如 unique_ptr 式的资源句柄、
+    // 不含自引用指针的字符串）也满足这一性质，可以通过特化主动声明：
+    //
+    //   namespace tinystl {
+    //   template <> struct is_trivially_relocatable<my_handle> : std::true_type {};
+    //   }
+    //
+    // 含有指向自身的指针，或者其地址被其他对象记录的类型不可声明为可平凡重定位。
+
+    template <class T>
+    struct is_trivially_relocatable : std::integral_constant<bool,
+        std::is_trivially_move_constructible<T>::value &&
+        std::is_trivially_destructible<T>::value> {};
+
+    template <class T1, class T2>
+    struct is_trivially_relocatable<tinystl::pair<T1, T2>> : std::integral_constant<bool,
+        is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
+
 }  // namespace tinystl
 
 #endif  // !MYTINYSTL_TYPE_TRAITS_H_
\ No newline at end of file
@@ -8,6 +8,7 @@
 // 2. std::is_trivially_copy_assignable
 
 #include <new>          // std::true_type, std::false_type
+#include <cstring>      // std::memmove
 #include "algobase.h"   // copy, copy_n, copy_backward 
 #include "construct.h"
 #include "iterator.h"
@@ -57,9 +58,11 @@ template <class InputIterator, class ForwardIteraotr>
 ForwardIteraotr uninitialized_copy(InputIterator first, InputIterator last, 
     ForwardIteraotr result) {
     // 判断是否为 POD 类型，这里使用了 std::is_trivially_copy_assignable
+    // 源类型与目标类型都需要判断：例如以 int 区间构造 string，不能对未初始化的 string 直接赋值
     return tinystl::__uninitialized_copy(first, last, result, 
-        std::is_trivially_copy_assignable<typename iterator_traits<InputIterator>::value_type>{});
-    // MyTinySTL 中这里判断的是 ForwardIterator 的 value_type，感觉有点问题
+        std::integral_constant<bool,
+            std::is_trivially_copy_assignable<typename iterator_traits<InputIterator>::value_type>::value &&
+            std::is_trivially_copy_assignable<typename iterator_traits<ForwardIteraotr>::value_type>::value>{});
 }
 
 
@@ -95,7 +98,9 @@ template <class InputIterator, class Size, class ForwardIterator>
 ForwardIterator uninitialized_copy_n(InputIterator first, Size n, 
     ForwardIterator result) {
         return tinystl::__uninitialized_copy_n(first, n, result, 
-            std::is_trivially_copy_assignable<typename iterator_traits<InputIterator>::value_type>{});
+            std::integral_constant<bool,
+                std::is_trivially_copy_assignable<typename iterator_traits<InputIterator>::value_type>::value &&
+                std::is_trivially_copy_assignable<typename iterator_traits<ForwardIterator>::value_type>::value>{});
     }
 
 
@@ -169,6 +174,39 @@ ForwardIterator uninitialized_fill_n(ForwardIterator first, Size n, const T& val
 }
 
 
+/*****************************************************************************************/
+// uninitialized_default_n
+// 从 first 位置开始，默认初始化 n 个元素，返回结束的位置
+// 平凡默认构造的类型（int、char 等）不做任何事，元素的值不确定
+/*****************************************************************************************/
+
+template <class ForwardIterator, class Size>
+ForwardIterator __uninitialized_default_n(ForwardIterator first, Size n, std::true_type) {
+    return first + n;
+}
+
+template <class ForwardIterator, class Size>
+ForwardIterator __uninitialized_default_n(ForwardIterator first, Size n, std::false_type) {
+    typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+    auto cur = first;
+    try {
+        for (; n > 0; --n, ++cur) {
+            ::new (static_cast<void*>(&*cur)) value_type;  // 默认初始化，而不是值初始化
+        }
+    }
+    catch (...) {
+        tinystl::destroy(first, cur);
+        throw;
+    }
+    return cur;
+}
+
+template <class ForwardIterator, class Size>
+ForwardIterator uninitialized_default_n(ForwardIterator first, Size n) {
+    return tinystl::__uninitialized_default_n(first, n,
+        std::is_trivially_default_constructible<typename iterator_traits<ForwardIterator>::value_type>{});
+}
+
 /*****************************************************************************************/
 // uninitialized_move
 // 把[first, last)上的内容移动到以 result 为起始处的空间，返回移动结束的位置
@@ -239,6 +277,45 @@ ForwardIterator uninitialized_move_n(InputIterator first, Size n,
             std::is_trivially_move_assignable<typename iterator_traits<InputIterator>::value_type>{});
     }
 
+
+/*****************************************************************************************/
+// uninitialized_relocate
+// 把 [first, last) 上的对象重新安置到以 result 为起始处的未初始化空间，返回安置结束的位置
+// 完成后原区间视为未初始化空间，不需要（也不可以）再对其调用析构函数
+/*****************************************************************************************/
+
+/// @brief 按字节搬移 n 个对象，源区间与目标区间可以重叠，仅用于可平凡重定位的类型
+template <class T>
+void relocate_bytes(T* result, const T* first, size_t n) {
+    if (n != 0) {
+        std::memmove(static_cast<void*>(result), static_cast<const void*>(first), n * sizeof(T));
+    }
+}
+
+/// @brief uninitialized_relocate 的可平凡重定位版本
+template <class T>
+T* __uninitialized_relocate(T* first, T* last, T* result, std::true_type) {
+    const size_t n = static_cast<size_t>(last - first);
+    tinystl::relocate_bytes(result, first, n);
+    return result + n;
+}
+
+/// @brief uninitialized_relocate 的一般版本：逐个移动构造并析构原对象
+template <class T>
+T* __uninitialized_relocate(T* first, T* last, T* result, std::false_type) {
+    for (; first != last; ++first, ++result) {
+        tinystl::construct(result, tinystl::move(*first));
+        tinystl::destroy(first);
+    }
+    return result;
+}
+
+template <class T>
+T* uninitialized_relocate(T* first, T* last, T* result) {
+    return tinystl::__uninitialized_relocate(first, last, result,
+        tinystl::is_trivially_relocatable<T>{});
+}
+
 }  // namespace tinystl
  
 #endif  // TINYSTL_UNINITIALIZED_H_
\ No newline at end of file
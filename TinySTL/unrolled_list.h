@@ -0,0 +1,632 @@
+#ifndef TINYSTL_UNROLLED_LIST_H_
+#define TINYSTL_UNROLLED_LIST_H_
+
+// 这个头文件包含一个模板类 unrolled_list
+// unrolled_list : 展开链表，每个节点（块）连续存放多个元素
+
+// notes:
+//
+// list 每个节点只放一个元素，遍历时每个元素一次缓存缺失，另加 16 字节的链接开销。unrolled_list 把元素放在
+// 大小为 ChunkBytes（缺省 UNROLLED_LIST_CHUNK_BYTES，两个缓存行）的块中，块之间用 list_node_base 双向链接：
+//   * 迭代器为 (块, 下标)，接口与 list 的双向迭代器相同，遍历时每个块只有一次缓存缺失
+//   * 在已知位置 insert / erase 只移动所在块内的元素，均摊 O(1)；块满时对半分裂，
+//     块内元素少于一半且能与后继块合并时合并，保证块的平均填充率
+//   * splice 以块为单位用 list_transfer 整体移动，pos 位于块中间时先把该块在 pos 处分裂，O(1)
+//   * 与 list 不同，insert / erase 会使指向同一块（分裂、合并时还包括相邻块）的迭代器失效，
+//     其余块中的迭代器不受影响；splice 不移动元素，x 中元素的指针与引用仍然有效
+//   * 头节点嵌入在对象中，空的 unrolled_list 不分配内存
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "iterator.h"
+#include "memory.h"
+#include "list.h"
+#include "util.h"
+#include "exceptdef.h"
+
+namespace tinystl {
+
+// 每个块（含链接指针与元素个数）的缺省字节数
+#ifndef UNROLLED_LIST_CHUNK_BYTES
+#define UNROLLED_LIST_CHUNK_BYTES 128
+#endif
+
+/// @brief 计算大小为 Bytes 的块能放下的元素个数，至少为 2
+template <class T, size_t Bytes>
+struct unrolled_list_capacity {
+    static constexpr size_t overhead = 2 * sizeof(void*) + sizeof(size_t);
+    static constexpr size_t value = Bytes >= overhead + 2 * sizeof(T) ? (Bytes - overhead) / sizeof(T) : 2;
+};
+
+// ==================================== unrolled_list 块结构 ==================================== //
+
+/// @brief 一个块：链接指针、元素个数与 Cap 个未初始化的元素槽，元素存放在 [0, count)
+template <class T, size_t Cap>
+struct unrolled_list_chunk : public list_node_base<unrolled_list_chunk<T, Cap>> {
+    size_t count;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type slots[Cap];
+
+    T* data() noexcept { return reinterpret_cast<T*>(slots); }
+};
+
+// ==================================== unrolled_list 迭代器 ==================================== //
+
+template <class T, size_t Cap, class Ref, class Ptr>
+struct unrolled_list_iterator : public tinystl::iterator<tinystl::bidirectional_iterator_tag, T> {
+    typedef T                                                  value_type;
+    typedef Ptr                                                pointer;
+    typedef Ref                                                reference;
+    typedef unrolled_list_chunk<T, Cap>                        chunk_type;
+    typedef chunk_type*                                        chunk_ptr;
+    typedef list_node_base<chunk_type>*                        base_ptr;
+    typedef unrolled_list_iterator<T, Cap, T&, T*>             iterator;
+    typedef unrolled_list_iterator<T, Cap, const T&, const T*> const_iterator;
+    typedef unrolled_list_iterator                             self;
+
+    base_ptr node_;  // 当前块，end() 时为头节点
+    size_t   idx_;   // 元素在块中的下标
+
+    // 构造函数
+
+    unrolled_list_iterator() : node_(nullptr), idx_(0) {}
+    unrolled_list_iterator(base_ptr x, size_t i) : node_(x), idx_(i) {}
+    unrolled_list_iterator(const iterator& rhs) : node_(rhs.node_), idx_(rhs.idx_) {}
+
+    unrolled_list_iterator& operator=(const unrolled_list_iterator&) = default;
+
+    chunk_ptr chunk() const noexcept { return static_cast<chunk_ptr>(node_); }
+
+    // 重载操作符
+
+    reference operator*()  const { return chunk()->data()[idx_]; }
+    pointer   operator->() const { return &(operator*()); }
+
+    self& operator++() {
+        TINYSTL_DEBUG(node_ != nullptr);
+        if (++idx_ == chunk()->count) {
+            node_ = node_->next;
+            idx_ = 0;
+        }
+        return *this;
+    }
+
+    self operator++(int) {
+        self tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    self& operator--() {
+        TINYSTL_DEBUG(node_ != nullptr);
+        if (idx_ == 0) {
+            node_ = node_->prev;
+            idx_ = chunk()->count;
+        }
+        --idx_;
+        return *this;
+    }
+
+    self operator--(int) {
+        self tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    // 重载比较操作符
+    bool operator==(const const_iterator& rhs) const { return node_ == rhs.node_ && idx_ == rhs.idx_; }
+    bool operator!=(const const_iterator& rhs) const { return !(*this == rhs); }
+};
+
+// ==================================== unrolled_list 结构 ==================================== //
+
+/// @brief 展开链表
+/// @tparam T           元素类型
+/// @tparam Alloc       空间配置器，用于分配块
+/// @tparam ChunkBytes  每个块的字节数
+template <class T, class Alloc = alloc, size_t ChunkBytes = UNROLLED_LIST_CHUNK_BYTES>
+class unrolled_list {
+public:
+    static constexpr size_t chunk_capacity = unrolled_list_capacity<T, ChunkBytes>::value;  // 每个块的元素个数
+
+    typedef unrolled_list_chunk<T, chunk_capacity>    chunk_type;
+    typedef chunk_type*                               chunk_ptr;
+    typedef list_node_base<chunk_type>*               base_ptr;
+    typedef simple_alloc<T, Alloc>                    allocator_type;
+    typedef simple_alloc<chunk_type, Alloc>           chunk_allocator;
+
+    typedef T                                         value_type;
+    typedef value_type*                               pointer;
+    typedef const value_type*                         const_pointer;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+    typedef size_t                                    size_type;
+    typedef ptrdiff_t                                 difference_type;
+
+    typedef unrolled_list_iterator<T, chunk_capacity, T&, T*>             iterator;
+    typedef unrolled_list_iterator<T, chunk_capacity, const T&, const T*> const_iterator;
+    typedef tinystl::reverse_iterator<iterator>       reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    allocator_type get_allocator() { return allocator_type(); }
+
+private:
+    list_node_base<chunk_type> node_;  // 嵌入的头节点，end() 为 (头节点, 0)
+    size_type                  size_;  // 元素个数
+
+public:  // 构造、复制、移动、析构函数
+    unrolled_list() noexcept : size_(0) { node_.unlink(); }
+
+    explicit unrolled_list(size_type n) : unrolled_list() { fill_insert(end(), n, value_type()); }
+
+    unrolled_list(size_type n, const T& value) : unrolled_list() { fill_insert(end(), n, value); }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    unrolled_list(Iter first, Iter last) : unrolled_list() { copy_insert(end(), first, last); }
+
+    unrolled_list(std::initializer_list<T> ilist) : unrolled_list() {
+        copy_insert(end(), ilist.begin(), ilist.end());
+    }
+
+    unrolled_list(const unrolled_list& rhs) : unrolled_list() { copy_insert(end(), rhs.begin(), rhs.end()); }
+
+    unrolled_list(unrolled_list&& rhs) noexcept : unrolled_list() { swap(rhs); }
+
+    unrolled_list& operator=(const unrolled_list& rhs) {
+        if (this != &rhs) assign(rhs.begin(), rhs.end());
+        return *this;
+    }
+
+    unrolled_list& operator=(unrolled_list&& rhs) noexcept {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    unrolled_list& operator=(std::initializer_list<T> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    ~unrolled_list() { clear(); }
+
+public:  // 迭代器相关操作
+    iterator               begin()   noexcept        { return iterator(node_.next, 0); }
+    const_iterator         begin()   const noexcept  { return const_iterator(node_.next, 0); }
+    const_iterator         cbegin()  const noexcept  { return begin(); }
+    iterator               end()     noexcept        { return iterator(header(), 0); }
+    const_iterator         end()     const noexcept  { return const_iterator(header(), 0); }
+    const_iterator         cend()    const noexcept  { return end(); }
+
+    reverse_iterator       rbegin()  noexcept        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin()  const noexcept  { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept  { return rbegin(); }
+    reverse_iterator       rend()    noexcept        { return reverse_iterator(begin()); }
+    const_reverse_iterator rend()    const noexcept  { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend()   const noexcept  { return rend(); }
+
+public:  // 容量相关操作
+    bool      empty()    const noexcept { return size_ == 0; }
+    size_type size()     const noexcept { return size_; }
+    size_type max_size() const noexcept { return static_cast<size_type>(-1); }
+
+public:  // 访问元素相关操作
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return *begin();
+    }
+
+    const_reference front() const {
+        TINYSTL_DEBUG(!empty());
+        return *begin();
+    }
+
+    reference back() {
+        TINYSTL_DEBUG(!empty());
+        return *(--end());
+    }
+
+    const_reference back() const {
+        TINYSTL_DEBUG(!empty());
+        return *(--end());
+    }
+
+public:  // 调整容器相关操作
+    void assign(size_type n, const value_type& value) {
+        clear();
+        fill_insert(end(), n, value);
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    void assign(Iter first, Iter last) {
+        clear();
+        copy_insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<value_type> ilist) { assign(ilist.begin(), ilist.end()); }
+
+    template <class ...Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+
+    template <class ...Args>
+    void emplace_front(Args&&... args) { emplace(begin(), tinystl::forward<Args>(args)...); }
+
+    template <class ...Args>
+    void emplace_back(Args&&... args) { emplace(end(), tinystl::forward<Args>(args)...); }
+
+    void push_front(const value_type& value) { emplace(begin(), value); }
+    void push_front(value_type&& value)      { emplace(begin(), tinystl::move(value)); }
+    void push_back(const value_type& value)  { emplace(end(), value); }
+    void push_back(value_type&& value)       { emplace(end(), tinystl::move(value)); }
+
+    iterator insert(const_iterator pos, const value_type& value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, value_type&& value)      { return emplace(pos, tinystl::move(value)); }
+
+    iterator insert(const_iterator pos, size_type n, const value_type& value) {
+        return fill_insert(pos, n, value);
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    iterator insert(const_iterator pos, Iter first, Iter last) {
+        return copy_insert(pos, first, last);
+    }
+
+    void pop_front() {
+        TINYSTL_DEBUG(!empty());
+        erase(begin());
+    }
+
+    void pop_back() {
+        TINYSTL_DEBUG(!empty());
+        erase(--end());
+    }
+
+    iterator erase(const_iterator pos);
+    iterator erase(const_iterator first, const_iterator last);
+
+    void clear() noexcept;
+
+    void swap(unrolled_list& rhs) noexcept {
+        tinystl::list_swap_headers(node_, rhs.node_);
+        tinystl::swap(size_, rhs.size_);
+    }
+
+public:  // list 相关操作
+    void splice(const_iterator pos, unrolled_list& x);
+
+    template <class UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred);
+
+    void remove(const value_type& value) {
+        remove_if([&](const value_type& x) { return x == value; });
+    }
+
+private:  // 辅助函数
+    /// @brief 头节点的指针，const 成员函数也需要它来构造迭代器
+    base_ptr header() const noexcept { return const_cast<base_ptr>(&node_); }
+
+    /// @brief x 不是头节点时返回对应的块，否则返回 nullptr
+    chunk_ptr as_chunk(base_ptr x) const noexcept {
+        return x == header() ? nullptr : static_cast<chunk_ptr>(x);
+    }
+
+    /// @brief 规范化迭代器：下标等于块内元素个数时指向下一块的开头
+    static iterator make_iter(chunk_ptr c, size_type i) noexcept {
+        return i == c->count ? iterator(c->next, 0) : iterator(c, i);
+    }
+
+    chunk_ptr create_chunk_before(base_ptr pos);
+    void      destroy_chunk(chunk_ptr c) noexcept;
+    chunk_ptr split_chunk(chunk_ptr c, size_type i);
+
+    iterator erase_to_end(const_iterator first) noexcept;
+
+    iterator fill_insert(const_iterator pos, size_type n, const value_type& value);
+
+    template <class Iter>
+    iterator copy_insert(const_iterator pos, Iter first, Iter last);
+};
+
+template <class T, class Alloc, size_t ChunkBytes>
+constexpr size_t unrolled_list<T, Alloc, ChunkBytes>::chunk_capacity;
+
+// ==================================== 函数实现 ==================================== //
+
+/// @brief 在 pos 之前就地构造一个元素，返回指向它的迭代器
+/// @note  pos 在块的开头且前一块未满时追加到前一块末尾；所在块已满时先对半分裂，
+///        新元素在分裂之前构造，所以 args 可以引用本容器中的元素
+template <class T, class Alloc, size_t ChunkBytes>
+template <class ...Args>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::emplace(const_iterator pos, Args&&... args) {
+    THROW_LENGTH_ERROR_IF(size_ > max_size() - 1, "unrolled_list<T>'s size too big");
+    // 先构造新元素：args 可能引用本容器中的元素，块分裂会移走并析构它们
+    value_type tmp(tinystl::forward<Args>(args)...);
+    chunk_ptr c = as_chunk(pos.node_);
+    size_type i = pos.idx_;
+    if (i == 0) {
+        chunk_ptr p = as_chunk(pos.node_->prev);
+        if (p != nullptr && p->count < chunk_capacity) {
+            c = p;
+            i = p->count;
+        }
+    }
+    bool fresh = false;  // c 是否为刚创建的空块
+    if (c == nullptr) {
+        c = create_chunk_before(pos.node_);
+        i = 0;
+        fresh = true;
+    }
+    else if (c->count == chunk_capacity) {
+        chunk_ptr n = split_chunk(c, chunk_capacity / 2);
+        if (i > c->count) {
+            i -= c->count;
+            c = n;
+        }
+    }
+
+    T* d = c->data();
+    if (i == c->count) {
+        try {
+            tinystl::construct(d + i, tinystl::move(tmp));
+        }
+        catch (...) {
+            // 空块不能留在链表中，否则 begin() != end() 而 size() == 0
+            if (fresh) {
+                tinystl::list_unlink_nodes<chunk_type>(c, c);
+                destroy_chunk(c);
+            }
+            throw;
+        }
+    }
+    else {
+        // 把 [i, count) 后移一位，再放入新元素
+        tinystl::construct(d + c->count, tinystl::move(d[c->count - 1]));
+        tinystl::move_backward(d + i, d + c->count - 1, d + c->count);
+        d[i] = tinystl::move(tmp);
+    }
+    ++c->count;
+    ++size_;
+    return iterator(c, i);
+}
+
+/// @brief 删除 pos 处的元素，返回指向下一个元素的迭代器
+/// @note  块变空时释放；块内元素少于一半且能容纳后继块的元素时合并后继块
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::erase(const_iterator pos) {
+    TINYSTL_DEBUG(pos != cend());
+    chunk_ptr c = pos.chunk();
+    size_type i = pos.idx_;
+    T* d = c->data();
+    tinystl::move(d + i + 1, d + c->count, d + i);
+    tinystl::destroy(d + c->count - 1);
+    --c->count;
+    --size_;
+
+    if (c->count == 0) {
+        base_ptr next = c->next;
+        tinystl::list_unlink_nodes<chunk_type>(c, c);
+        destroy_chunk(c);
+        return iterator(next, 0);
+    }
+    chunk_ptr n = as_chunk(c->next);
+    if (c->count < chunk_capacity / 2 && n != nullptr && c->count + n->count <= chunk_capacity) {
+        T* nd = n->data();
+        const size_type old = c->count;
+        try {
+            for (size_type k = 0; k < n->count; ++k) {
+                tinystl::construct(d + c->count, tinystl::move(nd[k]));
+                ++c->count;
+            }
+        }
+        catch (...) {
+            // 撤销已搬来的元素，两块保持原样，否则遍历会重复经过 n 中的元素
+            tinystl::destroy(d + old, d + c->count);
+            c->count = old;
+            throw;
+        }
+        tinystl::list_unlink_nodes<chunk_type>(n, n);
+        destroy_chunk(n);
+    }
+    return make_iter(c, i);
+}
+
+/// @brief 删除 [first, last) 内的元素
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::erase(const_iterator first, const_iterator last) {
+    if (last == cend()) return erase_to_end(first);
+    // erase 会移动同一块中的元素，last 可能失效，因此按个数删除
+    auto n = tinystl::distance(first, last);
+    iterator it(first.node_, first.idx_);
+    for (; n > 0; --n) it = erase(it);
+    return it;
+}
+
+/// @brief 删除 [first, end()) 内的元素，整块释放
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::erase_to_end(const_iterator first) noexcept {
+    if (first == cend()) return end();
+    chunk_ptr c = first.chunk();
+    base_ptr cur = c->next;
+    if (first.idx_ == 0) {
+        cur = c;
+    }
+    else {
+        tinystl::destroy(c->data() + first.idx_, c->data() + c->count);
+        size_ -= c->count - first.idx_;
+        c->count = first.idx_;
+    }
+    while (cur != header()) {
+        chunk_ptr d = static_cast<chunk_ptr>(cur);
+        cur = cur->next;
+        size_ -= d->count;
+        tinystl::list_unlink_nodes<chunk_type>(d, d);
+        destroy_chunk(d);
+    }
+    return end();
+}
+
+/// @brief 清空容器，释放全部块
+template <class T, class Alloc, size_t ChunkBytes>
+void unrolled_list<T, Alloc, ChunkBytes>::clear() noexcept {
+    base_ptr cur = node_.next;
+    while (cur != header()) {
+        chunk_ptr c = static_cast<chunk_ptr>(cur);
+        cur = cur->next;
+        destroy_chunk(c);
+    }
+    node_.unlink();
+    size_ = 0;
+}
+
+/// @brief 将 x 的全部元素移动到 pos 之前：整块转移，pos 位于块中间时先在 pos 处分裂
+template <class T, class Alloc, size_t ChunkBytes>
+void unrolled_list<T, Alloc, ChunkBytes>::splice(const_iterator pos, unrolled_list& x) {
+    TINYSTL_DEBUG(this != &x);
+    if (x.empty()) return;
+    THROW_LENGTH_ERROR_IF(size_ > max_size() - x.size_, "unrolled_list<T>'s size too big");
+    base_ptr p = pos.node_;
+    if (pos.idx_ != 0) p = split_chunk(pos.chunk(), pos.idx_);
+    tinystl::list_transfer(p, x.node_.next, x.header());
+    size_ += x.size_;
+    x.size_ = 0;
+}
+
+/// @brief 删除所有满足 pred 的元素，一次遍历把保留的元素前移，再整块释放尾部，返回删除的个数
+template <class T, class Alloc, size_t ChunkBytes>
+template <class UnaryPredicate>
+typename unrolled_list<T, Alloc, ChunkBytes>::size_type
+unrolled_list<T, Alloc, ChunkBytes>::remove_if(UnaryPredicate pred) {
+    iterator w = begin();
+    iterator e = end();
+    for (iterator r = begin(); r != e; ++r) {
+        if (!pred(*r)) {
+            if (w != r) *w = tinystl::move(*r);
+            ++w;
+        }
+    }
+    const size_type old = size_;
+    erase_to_end(w);
+    return old - size_;
+}
+
+/// @brief 在 pos 之前链入一个空块
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::chunk_ptr
+unrolled_list<T, Alloc, ChunkBytes>::create_chunk_before(base_ptr pos) {
+    chunk_ptr c = chunk_allocator::allocate(1);
+    c->count = 0;
+    tinystl::list_link_nodes<chunk_type>(pos, c, c);
+    return c;
+}
+
+/// @brief 析构块中的元素并释放块，调用前块须已从链表中摘下（或整个链表一起丢弃）
+template <class T, class Alloc, size_t ChunkBytes>
+void unrolled_list<T, Alloc, ChunkBytes>::destroy_chunk(chunk_ptr c) noexcept {
+    tinystl::destroy(c->data(), c->data() + c->count);
+    chunk_allocator::deallocate(c, 1);
+}
+
+/// @brief 把块 c 中 [i, count) 的元素移到紧随其后的新块中，返回新块
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::chunk_ptr
+unrolled_list<T, Alloc, ChunkBytes>::split_chunk(chunk_ptr c, size_type i) {
+    chunk_ptr n = create_chunk_before(c->next);
+    T* d = c->data();
+    T* nd = n->data();
+    try {
+        for (size_type k = i; k < c->count; ++k) {
+            tinystl::construct(nd + n->count, tinystl::move(d[k]));
+            ++n->count;
+        }
+    }
+    catch (...) {
+        // 释放新块及其中已构造的元素，c 保持原样
+        tinystl::list_unlink_nodes<chunk_type>(n, n);
+        destroy_chunk(n);
+        throw;
+    }
+    tinystl::destroy(d + i, d + c->count);
+    c->count = i;
+    return n;
+}
+
+/// @brief 在 pos 之前插入 n 个 value，返回指向第一个新元素的迭代器
+template <class T, class Alloc, size_t ChunkBytes>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::fill_insert(const_iterator pos, size_type n, const value_type& value) {
+    if (n == 0) return iterator(pos.node_, pos.idx_);
+    // value 可能引用本容器中的元素，之后的块分裂会移走它，所以先复制一份
+    const value_type copy(value);
+    // 依次插入到上一个新元素之后，新元素按顺序排列；块分裂可能移动先插入的元素，最后从末尾退回第一个新元素
+    iterator it = emplace(pos, copy);
+    for (size_type k = 1; k < n; ++k) {
+        it = emplace(++it, copy);
+    }
+    tinystl::advance(it, -static_cast<difference_type>(n - 1));
+    return it;
+}
+
+/// @brief 在 pos 之前插入 [first, last) 内的元素，返回指向第一个新元素的迭代器
+template <class T, class Alloc, size_t ChunkBytes>
+template <class Iter>
+typename unrolled_list<T, Alloc, ChunkBytes>::iterator
+unrolled_list<T, Alloc, ChunkBytes>::copy_insert(const_iterator pos, Iter first, Iter last) {
+    if (first == last) return iterator(pos.node_, pos.idx_);
+    iterator it = emplace(pos, *first);
+    size_type n = 1;
+    for (++first; first != last; ++first, ++n) {
+        it = emplace(++it, *first);
+    }
+    tinystl::advance(it, -static_cast<difference_type>(n - 1));
+    return it;
+}
+
+// ==================================== 重载比较操作符 ==================================== //
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator==(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return lhs.size() == rhs.size() && tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator<(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator!=(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator>(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator<=(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T, class Alloc, size_t ChunkBytes>
+bool operator>=(const unrolled_list<T, Alloc, ChunkBytes>& lhs, const unrolled_list<T, Alloc, ChunkBytes>& rhs) {
+    return !(lhs < rhs);
+}
+
+// ==================================== 重载 swap ==================================== //
+
+template <class T, class Alloc, size_t ChunkBytes>
+void swap(unrolled_list<T, Alloc, ChunkBytes>& lhs, unrolled_list<T, Alloc, ChunkBytes>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_UNROLLED_LIST_H_
@@ -68,6 +68,15 @@ void swap(Tp(&lhs)[N], Tp(&rhs)[N]) {
     tinystl::swap_range(lhs, lhs + N, rhs);
 }
 
+// default_init: 标签，表示新元素只做默认初始化
+// 对 int、char 等平凡类型来说即不做任何初始化，例如 vector<char> buf(n, tinystl::default_init)
+
+struct default_init_t {
+    explicit default_init_t() = default;
+};
+
+constexpr default_init_t default_init{};
+
 
 // ========================== pair ========================== //
 // pair: 一个模板结构体，用于存储一对值
@@ -9,6 +9,7 @@
 #include "exceptdef.h"
 #include "algo.h"
 #include "alloc.h"
+#include "growth_policy.h"
 
 namespace tinystl {
 
@@ -23,8 +24,11 @@ namespace tinystl {
 #undef min
 #endif // min
 
-// 模板类 vector
-template <class T, class Alloc = alloc>
+/// @brief 模板类 vector
+/// @tparam T  元素类型
+/// @tparam Alloc  空间配置器
+/// @tparam Growth  增长策略，见 growth_policy.h，缺省为 1.5 倍增长
+template <class T, class Alloc = alloc, class Growth = growth_1_5x>
 class vector {
 
 // 静态断言，用于在编译期间判断 T 是否为 bool 类型
@@ -74,6 +78,9 @@ public:
     explicit vector(size_type n) { fill_init(n, value_type()); }  // explicit 防止隐式转换
     
     vector(size_type n, const value_type& value) { fill_init(n, value); }
+
+    /// @brief 构造 n 个默认初始化的元素，平凡类型的元素不做初始化，适合随后会被整体覆盖的缓冲区
+    vector(size_type n, tinystl::default_init_t) { default_fill_init(n); }
     
     // 这里使用 std::enable_if 来确保只有当迭代器类型满足输入迭代器的要求时，该函数模板才会被实例化。
     template <class Iter, typename std::enable_if<
@@ -160,9 +167,20 @@ public:
     size_type capacity() const noexcept 
         { return static_cast<size_type>(cap_ - begin_); }       
     
-    // 重新分配空间
+    // 配置器为 n 个元素实际交付的容量，不小于 n
+    size_type usable_capacity(size_type n) const noexcept
+        { return tinystl::round_to_size_class<T, Alloc>(n); }
+
+    // 当前空间在配置器中实际占用的容量，不小于 capacity()
+    size_type usable_capacity() const noexcept
+        { return usable_capacity(capacity()); }
+
+    // 重新分配空间，容量至少为 n，并补满配置器实际交付的区块
     void reserve(size_type n);  
 
+    // 重新分配空间，容量恰好为 n
+    void reserve_exact(size_type n);
+
     // 释放多余空间                                
     void shrink_to_fit();                                       
 
@@ -286,6 +304,12 @@ public:
     void resize(size_type new_size) { return resize(new_size, value_type()); }
     void resize(size_type new_size, const value_type& value);
 
+    // 新增的元素只做默认初始化，平凡类型的元素的值不确定
+    void resize_default_init(size_type new_size);
+
+    template <class Operation>
+    void resize_and_overwrite(size_type n, Operation op);
+
     void reverse() { tinystl::reverse(begin(), end()); }
 
     // swap
@@ -300,6 +324,7 @@ private:
     void init_space(size_type size, size_type cap);
 
     void fill_init(size_type n, const value_type& value);
+    void default_fill_init(size_type n);
 
     template <class Iter>
     void range_init(Iter first, Iter last);
@@ -323,6 +348,23 @@ private:
     void reallocate_emplace(iterator pos, Args&& ...args);
     void reallocate_insert(iterator pos, const value_type& value);
 
+    // relocate，仅用于可平凡重定位的元素，以 memcpy / memmove 代替逐个移动构造与析构
+    static constexpr bool relocatable = tinystl::is_trivially_relocatable<T>::value;
+
+    void relocate_around(iterator pos, size_type n, pointer new_begin, size_type new_cap);
+
+    /// @brief 将 [pos, end_) 整体后移 n 个位置，在 pos 处留出 n 个未初始化的位置，要求剩余容量足够
+    void open_gap(iterator pos, size_type n) {
+        tinystl::relocate_bytes(pos + n, pos, static_cast<size_type>(end_ - pos));
+        end_ += n;
+    }
+
+    /// @brief open_gap 的逆操作，[pos, pos + n) 上的元素须已析构或从未构造
+    void close_gap(iterator pos, size_type n) {
+        tinystl::relocate_bytes(pos, pos + n, static_cast<size_type>(end_ - pos) - n);
+        end_ -= n;
+    }
+
     // insert
     iterator fill_insert(iterator pos, size_type n, const value_type& value);
     template <class Iter>
@@ -336,8 +378,8 @@ private:
 // =========================  函数实现  ====================== //
 
 // 复制赋值操作符
-template <class T, class Alloc>
-vector<T, Alloc>& vector<T, Alloc>::operator=(const vector& rhs) {
+template <class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>& vector<T, Alloc, Growth>::operator=(const vector& rhs) {
     if (this != &rhs) {
         const auto len = rhs.size();
         // 如果 rhs 比当前容量大，则重新分配内存
@@ -356,15 +398,15 @@ vector<T, Alloc>& vector<T, Alloc>::operator=(const vector& rhs) {
         else {
             tinystl::copy(rhs.begin(), rhs.begin() + size(), begin_);
             tinystl::uninitialized_copy(rhs.begin() + size(), rhs.end(), end_);
-            cap_ = end_ = begin_ + len;
+            end_ = begin_ + len;
         }
     }
     return *this;
 }
 
 // 移动赋值操作符
-template <class T, class Alloc>
-vector<T, Alloc>& vector<T, Alloc>::operator=(vector&& rhs) noexcept {
+template <class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>& vector<T, Alloc, Growth>::operator=(vector&& rhs) noexcept {
     destroy_and_recover(begin_, end_, cap_ - begin_);  // 回收内存
     begin_ = rhs.begin_;  // 移动资源
     end_ = rhs.end_;
@@ -378,15 +420,33 @@ vector<T, Alloc>& vector<T, Alloc>::operator=(vector&& rhs) noexcept {
 /// @brief 重新分配空间
 /// @tparam T  元素类型
 /// @param n  新的空间大小
-template <class T, class Alloc>
-void vector<T, Alloc>::reserve(size_type n) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::reserve(size_type n) {
     if (capacity() < n) {
         THROW_LENGTH_ERROR_IF(n > max_size(), 
             "n can not larger than max_size() in vector<T>::reserve(n)");
+        reserve_exact(tinystl::min(usable_capacity(n), max_size()));
+    }
+}
+
+/// @brief 重新分配空间，容量恰好为 n，不做任何取整
+/// @param n  新的空间大小
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::reserve_exact(size_type n) {
+    if (capacity() < n) {
+        THROW_LENGTH_ERROR_IF(n > max_size(), 
+            "n can not larger than max_size() in vector<T>::reserve_exact(n)");
         const auto old_size = size();
         auto tmp = data_allocator::allocate(n);  // 重新分配内存
-        tinystl::uninitialized_move(begin_, end_, tmp);  // 移动元素
-        destroy_and_recover(begin_, end_, cap_ - begin_);  // 回收内存
+        if (relocatable) {
+            // 可平凡重定位的元素直接按字节搬移，旧空间上的对象无需析构
+            tinystl::relocate_bytes(tmp, begin_, old_size);
+            data_allocator::deallocate(begin_, cap_ - begin_);
+        }
+        else {
+            tinystl::uninitialized_move(begin_, end_, tmp);  // 移动元素
+            destroy_and_recover(begin_, end_, cap_ - begin_);  // 回收内存
+        }
         // 重新设置迭代器
         begin_ = tmp;
         end_ = tmp + old_size;
@@ -396,8 +456,8 @@ void vector<T, Alloc>::reserve(size_type n) {
 
 /// @brief 释放多余空间
 /// @tparam T 元素类型 
-template <class T, class Alloc>
-void vector<T, Alloc>::shrink_to_fit() {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::shrink_to_fit() {
     if (end_ < cap_) {
         reinsert(size());
     }
@@ -409,9 +469,9 @@ void vector<T, Alloc>::shrink_to_fit() {
 /// @param pos  插入位置
 /// @param ...args  元素的构造参数
 /// @return  返回指向新构造元素的迭代器
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class... Args>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::emplace(
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::emplace(
     const_iterator pos, Args&& ...args) {
     TINYSTL_DEBUG(pos >= begin() && pos <= end());
     iterator xpos = const_cast<iterator>(pos);
@@ -423,6 +483,18 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::emplace(
         tinystl::construct(tinystl::address_of(*end_), tinystl::forward<Args>(args)...);
         ++end_;
     }
+    // 构造位置不为 end_，可平凡重定位的元素整体按字节后移一位
+    else if (end_ != cap_ && relocatable) {
+        value_type tmp(tinystl::forward<Args>(args)...);  // 先构造，参数可能引用容器内的元素
+        open_gap(xpos, 1);
+        try {
+            tinystl::construct(xpos, tinystl::move(tmp));
+        }
+        catch (...) {
+            close_gap(xpos, 1);
+            throw;
+        }
+    }
     // 构造位置不为 end_，则需要移动元素
     else if (end_ != cap_) {
         auto new_end = end_;
@@ -443,9 +515,9 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::emplace(
 /// @brief 在尾部就地构造元素
 /// @tparam T  元素类型
 /// @param ...args  元素的构造参数
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class ...Args>
-void vector<T, Alloc>::emplace_back(Args&& ...args) {
+void vector<T, Alloc, Growth>::emplace_back(Args&& ...args) {
     if (end_ < cap_) {
         // tinystl::construct(tinystl::address_of(*end_), tinystl::forward<Args>(args)...);
         tinystl::construct(tinystl::address_of(*end_), tinystl::forward<Args>(args)...);
@@ -459,8 +531,8 @@ void vector<T, Alloc>::emplace_back(Args&& ...args) {
 /// @brief 在尾部插入元素
 /// @tparam T  元素类型
 /// @param value  元素的值
-template <class T, class Alloc>
-void vector<T, Alloc>::push_back(const value_type& value) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::push_back(const value_type& value) {
     // 如果空间足够就直接构造元素
     if (end_ != cap_) {
         tinystl::construct(tinystl::address_of(*end_), value);
@@ -474,8 +546,8 @@ void vector<T, Alloc>::push_back(const value_type& value) {
 
 /// @brief 弹出尾部元素
 /// @tparam T  元素类型
-template <class T, class Alloc>
-void vector<T, Alloc>::pop_back() {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::pop_back() {
     TINYSTL_DEBUG(!empty());
     // data_allocator::destroy(end_ - 1);
     tinystl::destroy(end_ - 1);
@@ -487,8 +559,8 @@ void vector<T, Alloc>::pop_back() {
 /// @param pos  插入位置
 /// @param value  元素的值
 /// @return  返回指向新构造元素的迭代器
-template <class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(const_iterator pos, const value_type& value) {
+template <class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(const_iterator pos, const value_type& value) {
     // 确保 pos 在 [begin(), end()) 内
     TINYSTL_DEBUG(pos >= begin() && pos <= end());
     iterator xpos = const_cast<iterator>(pos);
@@ -498,6 +570,18 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(const_iterator pos,
         tinystl::construct(tinystl::address_of(*end_), value);
         ++end_;
     }
+    // 构造位置不为 end_，可平凡重定位的元素整体按字节后移一位
+    else if (end_ != cap_ && relocatable) {
+        auto value_copy = value;  // value 可能是容器内的元素，搬移之前先复制
+        open_gap(xpos, 1);
+        try {
+            tinystl::construct(xpos, tinystl::move(value_copy));
+        }
+        catch (...) {
+            close_gap(xpos, 1);
+            throw;
+        }
+    }
     // 构造位置不为 end_，则需要移动元素
     else if (end_ != cap_) {
         auto new_end = end_;
@@ -523,11 +607,17 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(const_iterator pos,
 /// @tparam T  元素类型
 /// @param pos  删除位置
 /// @return  返回指向被删除元素的下一个元素的迭代器
-template <class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(const_iterator pos) {
+template <class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(const_iterator pos) {
     // 确保 pos 在 [begin(), end()) 内
     TINYSTL_DEBUG(pos >= begin() && pos < end());
     iterator xpos = begin_ + (pos - begin());
+    if (relocatable) {
+        // 析构被删除的元素，其后的元素按字节前移一位
+        tinystl::destroy(xpos);
+        close_gap(xpos, 1);
+        return xpos;
+    }
     // 将 [xpos + 1, end_) 的元素向前移动一位
     tinystl::move(xpos + 1, end_, xpos);
     // 销毁 end_ - 1处的元素
@@ -543,12 +633,17 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(const_iterator pos)
 /// @param first  删除区间的起始位置
 /// @param last  删除区间的终止位置
 /// @return  返回指向被删除元素（区间）的下一个元素的迭代器
-template <class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(const_iterator first, const_iterator last) {
+template <class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(const_iterator first, const_iterator last) {
     // 确保 first 和 last 在 [begin(), end()) 内，且 first 不大于 last
     TINYSTL_DEBUG(first >= begin() && first <= end() && !(last < first));
     const auto n = first - begin();
     iterator r = begin_ + (first - begin());
+    if (relocatable) {
+        tinystl::destroy(r, r + (last - first));
+        close_gap(r, static_cast<size_type>(last - first));
+        return begin_ + n;
+    }
     // tinystl::move(r + (last - first), end_, r) 将被删除区间后面的元素向前移动，返回移动后的尾部位置
     // destroy(pos, end_) 销毁 [pos, end_) 区间上的元素
     // data_allocator::destroy(tinystl::move(r + (last - first), end_, r), end_);
@@ -562,8 +657,8 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(const_iterator first
 /// @tparam T  元素类型
 /// @param new_size  新的容器大小
 /// @param value  新增元素的值
-template <class T, class Alloc>
-void vector<T, Alloc>::resize(size_type new_size, const value_type& value) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::resize(size_type new_size, const value_type& value) {
     if (new_size < size()) {
         erase(begin() + new_size, end());
     }
@@ -572,11 +667,40 @@ void vector<T, Alloc>::resize(size_type new_size, const value_type& value) {
     }
 }
 
+/// @brief 重置容器大小，新增的元素只做默认初始化
+//  对 vector<char>、vector<uint32_t> 等作为读缓冲区的容器，省去一次无用的清零
+/// @param new_size  新的大小
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::resize_default_init(size_type new_size) {
+    if (new_size <= size()) {
+        erase(begin() + new_size, end());
+        return;
+    }
+    if (new_size > capacity()) {
+        reserve(get_new_cap(new_size - size()));
+    }
+    end_ = tinystl::uninitialized_default_n(end_, new_size - size());
+}
+
+/// @brief 把大小调整为 n（新增元素只做默认初始化），交给 op 填写，再截断为 op 的返回值
+//  op 的形式为 size_type op(pointer p, size_type n)，在 [p, p + n) 上写入数据并返回实际写入的个数 r，
+//  要求 r <= n。调用结束后 size() == r，前 min(n, 原 size()) 个元素在调用 op 前保持原值
+/// @param n  op 可以写入的最大元素个数
+/// @param op  写入数据的操作
+template <class T, class Alloc, class Growth>
+template <class Operation>
+void vector<T, Alloc, Growth>::resize_and_overwrite(size_type n, Operation op) {
+    resize_default_init(n);
+    const auto r = static_cast<size_type>(op(begin_, n));
+    TINYSTL_DEBUG(r <= n);
+    erase(begin_ + r, end_);
+}
+
 /// @brief 交换两个 vector
 /// @tparam T  元素类型
 /// @param rhs  交换的另一个 vector
-template <class T, class Alloc>
-void vector<T, Alloc>::swap(vector<T, Alloc>& rhs) noexcept {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::swap(vector<T, Alloc, Growth>& rhs) noexcept {
     if (this != &rhs) {
         tinystl::swap(begin_, rhs.begin_);
         tinystl::swap(end_, rhs.end_);
@@ -588,12 +712,13 @@ void vector<T, Alloc>::swap(vector<T, Alloc>& rhs) noexcept {
 
 /// @brief 初始化 vector, 具有 commit or rollback 机制
 /// @tparam T  元素类型
-template <class T, class Alloc>
-void vector<T, Alloc>::try_init() noexcept {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::try_init() noexcept {
     try {
-        begin_ = data_allocator::allocate(16);
+        const size_type init_size = Growth::template next_capacity<T, Alloc>(0, 0);
+        begin_ = data_allocator::allocate(init_size);
         end_ = begin_;
-        cap_ = begin_ + 16;
+        cap_ = begin_ + init_size;
     }
     catch (...) {
         begin_ = nullptr;
@@ -606,8 +731,8 @@ void vector<T, Alloc>::try_init() noexcept {
 /// @tparam T 元素类型
 /// @param size  元素个数
 /// @param cap  容量
-template <class T, class Alloc>
-void vector<T, Alloc>::init_space(size_type size, size_type cap) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::init_space(size_type size, size_type cap) {
     try {
         begin_ = data_allocator::allocate(cap);
         end_ = begin_ + size;
@@ -625,22 +750,37 @@ void vector<T, Alloc>::init_space(size_type size, size_type cap) {
 /// @tparam T  元素类型
 /// @param n  元素个数
 /// @param value  元素的值
-template <class T, class Alloc>
-void vector<T, Alloc>::fill_init(size_type n, const value_type& value) {
-    const size_type init_size = tinystl::max(static_cast<size_type>(16), n);
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::fill_init(size_type n, const value_type& value) {
+    const size_type init_size = Growth::template next_capacity<T, Alloc>(0, n);
     init_space(n, init_size);
     tinystl::uninitialized_fill_n(begin_, n, value);
 }
 
+/// @brief 构造 n 个默认初始化的元素
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::default_fill_init(size_type n) {
+    const size_type init_size = Growth::template next_capacity<T, Alloc>(0, n);
+    init_space(n, init_size);
+    try {
+        tinystl::uninitialized_default_n(begin_, n);
+    }
+    catch (...) {
+        data_allocator::deallocate(begin_, init_size);
+        begin_ = end_ = cap_ = nullptr;
+        throw;
+    }
+}
+
 /// @brief 以 [first, last) 区间初始化 vector
 /// @tparam T  元素类型
 /// @param first  区间起始位置
 /// @param last  区间终止位置
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class Iter>
-void vector<T, Alloc>::range_init(Iter first, Iter last) {
+void vector<T, Alloc, Growth>::range_init(Iter first, Iter last) {
     const size_type len = tinystl::distance(first, last);
-    const size_type init_size = tinystl::max(static_cast<size_type>(16), len);
+    const size_type init_size = Growth::template next_capacity<T, Alloc>(0, len);
     init_space(len, init_size);
     tinystl::uninitialized_copy(first, last, begin_);
 }
@@ -650,8 +790,8 @@ void vector<T, Alloc>::range_init(Iter first, Iter last) {
 /// @param first  区间起始位置
 /// @param last  区间终止位置
 /// @param n  区间长度
-template <class T, class Alloc>
-void vector<T, Alloc>::destroy_and_recover(iterator first, iterator last, size_type n) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::destroy_and_recover(iterator first, iterator last, size_type n) {
     // data_allocator::destroy(first, last);
     // data_allocator::deallocate(first, n);
     tinystl::destroy(first, last);
@@ -662,8 +802,8 @@ void vector<T, Alloc>::destroy_and_recover(iterator first, iterator last, size_t
 /// @tparam T  元素类型
 /// @param add_size  增加的大小
 /// @return  返回新的容量大小
-template <class T, class Alloc>
-typename vector<T, Alloc>::size_type vector<T, Alloc>::get_new_cap(size_type add_size) {
+template <class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::size_type vector<T, Alloc, Growth>::get_new_cap(size_type add_size) {
     const auto old_size = capacity();
     THROW_LENGTH_ERROR_IF(old_size > max_size() - add_size, 
         "vector<T>'s size too big");
@@ -671,19 +811,18 @@ typename vector<T, Alloc>::size_type vector<T, Alloc>::get_new_cap(size_type add
         return old_size + add_size > max_size() - 16 ? 
             old_size + add_size : old_size + add_size + 16;
     }
-    // 每一次默认增加 1.5 倍
-    const auto new_size = old_size == 0 ? 
-        tinystl::max(add_size, static_cast<size_type>(16)) : 
-        tinystl::max(old_size + old_size / 2, old_size + add_size);
-    return new_size;
+    // 由增长策略决定，缺省每次增加 1.5 倍
+    const auto new_size = Growth::template next_capacity<T, Alloc>(old_size, old_size + add_size);
+    TINYSTL_DEBUG(new_size >= old_size + add_size);
+    return tinystl::min(new_size, max_size());
 }
 
 /// @brief 以 n 个 value 赋值 vector
 /// @tparam T  元素类型
 /// @param n  元素个数
 /// @param value  元素的值
-template <class T, class Alloc>
-void vector<T, Alloc>::fill_assign(size_type n, const value_type& value) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::fill_assign(size_type n, const value_type& value) {
     if (n > capacity()) {
         vector tmp(n, value);
         swap(tmp);
@@ -702,9 +841,9 @@ void vector<T, Alloc>::fill_assign(size_type n, const value_type& value) {
 /// @param first  区间起始位置
 /// @param last  区间终止位置
 /// @param   区间长度
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class Iter>
-void vector<T, Alloc>::copy_assign(Iter first, Iter last, tinystl::input_iterator_tag) {
+void vector<T, Alloc, Growth>::copy_assign(Iter first, Iter last, tinystl::input_iterator_tag) {
     auto cur = begin_;
     for (; first != last && cur != end_; ++first, ++cur) {
         *cur = *first;
@@ -717,9 +856,9 @@ void vector<T, Alloc>::copy_assign(Iter first, Iter last, tinystl::input_iterato
     }
 }
 
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class Iter>
-void vector<T, Alloc>::copy_assign(Iter first, Iter last, tinystl::forward_iterator_tag) {
+void vector<T, Alloc, Growth>::copy_assign(Iter first, Iter last, tinystl::forward_iterator_tag) {
     const auto len = tinystl::distance(first, last);
     if (len > capacity()) {
         vector tmp(first, last);
@@ -744,11 +883,23 @@ void vector<T, Alloc>::copy_assign(Iter first, Iter last, tinystl::forward_itera
 /// @tparam T  元素类型
 /// @param pos  构造位置
 /// @param ...args  元素的构造参数
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class... Args>
-void vector<T, Alloc>::reallocate_emplace(iterator pos, Args&& ...args) {
+void vector<T, Alloc, Growth>::reallocate_emplace(iterator pos, Args&& ...args) {
     const auto new_size = get_new_cap(1);
     auto new_begin = data_allocator::allocate(new_size);
+    if (relocatable) {
+        // 先在新空间中构造新元素（参数可能引用旧元素），再把旧元素按字节搬到它的两侧
+        try {
+            tinystl::construct(new_begin + (pos - begin_), tinystl::forward<Args>(args)...);
+        }
+        catch (...) {
+            data_allocator::deallocate(new_begin, new_size);
+            throw;
+        }
+        relocate_around(pos, 1, new_begin, new_size);
+        return;
+    }
     auto new_end = new_begin;
     try {
         new_end = tinystl::uninitialized_move(begin_, pos, new_begin);
@@ -771,10 +922,21 @@ void vector<T, Alloc>::reallocate_emplace(iterator pos, Args&& ...args) {
 /// @tparam T  元素类型
 /// @param pos  插入位置
 /// @param value  元素的值
-template <class T, class Alloc>
-void vector<T, Alloc>::reallocate_insert(iterator pos, const value_type& value) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::reallocate_insert(iterator pos, const value_type& value) {
     const auto new_size = get_new_cap(1);
     auto new_begin = data_allocator::allocate(new_size);
+    if (relocatable) {
+        try {
+            tinystl::construct(new_begin + (pos - begin_), value);
+        }
+        catch (...) {
+            data_allocator::deallocate(new_begin, new_size);
+            throw;
+        }
+        relocate_around(pos, 1, new_begin, new_size);
+        return;
+    }
     auto new_end = new_begin;
     const value_type& value_copy = value;
     try {
@@ -804,15 +966,26 @@ void vector<T, Alloc>::reallocate_insert(iterator pos, const value_type& value)
 /// @param n  插入元素个数
 /// @param value  元素的值
 /// @return  返回指向新构造元素的迭代器
-template <class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::fill_insert(
+template <class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::fill_insert(
     iterator pos, size_type n, const value_type& value) {
     if (n == 0) return pos;
     const size_type xpos = pos - begin_;
     const value_type value_copy = value;  // 避免被覆盖
 
+    // 剩余空间足够，可平凡重定位的元素整体按字节后移 n 位
+    if (static_cast<size_type>(cap_ - end_) >= n && relocatable) {
+        open_gap(pos, n);
+        try {
+            tinystl::uninitialized_fill_n(pos, n, value_copy);
+        }
+        catch (...) {
+            close_gap(pos, n);
+            throw;
+        }
+    }
     // 剩余空间大于等于新增元素个数
-    if (static_cast<size_type>(cap_ - end_) >= n) {
+    else if (static_cast<size_type>(cap_ - end_) >= n) {
         const size_type after_elems = end_ - pos;
         auto old_end = end_;
         if (after_elems > n) {
@@ -827,6 +1000,19 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::fill_insert(
             tinystl::uninitialized_fill_n(pos, after_elems, value_copy);
         }
     }
+    // 剩余空间不足，可平凡重定位的元素先构造新元素，再按字节搬移旧元素
+    else if (relocatable) {
+        const auto new_size = get_new_cap(n);
+        auto new_begin = data_allocator::allocate(new_size);
+        try {
+            tinystl::uninitialized_fill_n(new_begin + xpos, n, value_copy);
+        }
+        catch (...) {
+            data_allocator::deallocate(new_begin, new_size);
+            throw;
+        }
+        relocate_around(pos, n, new_begin, new_size);
+    }
     // 剩余空间不足
     else {
         const auto new_size = get_new_cap(n);
@@ -854,13 +1040,24 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::fill_insert(
 /// @param pos  插入位置
 /// @param first  区间起始位置
 /// @param last  区间终止位置
-template <class T, class Alloc>
+template <class T, class Alloc, class Growth>
 template <class Iter>
-void vector<T, Alloc>::copy_insert(iterator pos, Iter first, Iter last) {
+void vector<T, Alloc, Growth>::copy_insert(iterator pos, Iter first, Iter last) {
     if (first == last) return;
     const auto n = tinystl::distance(first, last);
+    // 剩余空间足够，可平凡重定位的元素整体按字节后移 n 位
+    if (static_cast<size_type>(cap_ - end_) >= n && relocatable) {
+        open_gap(pos, n);
+        try {
+            tinystl::uninitialized_copy(first, last, pos);
+        }
+        catch (...) {
+            close_gap(pos, n);
+            throw;
+        }
+    }
     // 剩余空间大于等于新增元素个数
-    if (static_cast<size_type>(cap_ - end_) >= n) {
+    else if (static_cast<size_type>(cap_ - end_) >= n) {
         const auto after_elems = end_ - pos;
         auto old_end = end_;
         if (after_elems > n) {
@@ -876,6 +1073,19 @@ void vector<T, Alloc>::copy_insert(iterator pos, Iter first, Iter last) {
             tinystl::uninitialized_copy(first, mid, pos);
         }
     }
+    // 剩余空间不足，可平凡重定位的元素先构造新元素，再按字节搬移旧元素
+    else if (relocatable) {
+        const auto new_size = get_new_cap(n);
+        auto new_begin = data_allocator::allocate(new_size);
+        try {
+            tinystl::uninitialized_copy(first, last, new_begin + (pos - begin_));
+        }
+        catch (...) {
+            data_allocator::deallocate(new_begin, new_size);
+            throw;
+        }
+        relocate_around(pos, n, new_begin, new_size);
+    }
     // 剩余空间不足
     else {
         const auto new_size = get_new_cap(n);
@@ -900,15 +1110,21 @@ void vector<T, Alloc>::copy_insert(iterator pos, Iter first, Iter last) {
 /// @brief 重新分配内存
 /// @tparam T  元素类型
 /// @param size  新的内存大小
-template <class T, class Alloc>
-void vector<T, Alloc>::reinsert(size_type size) {
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::reinsert(size_type size) {
     auto new_begin = data_allocator::allocate(size);
-    try {
-        tinystl::uninitialized_move(begin_, end_, new_begin);
+    if (relocatable) {
+        tinystl::relocate_bytes(new_begin, begin_, size);
     }
-    catch (...) {
-        data_allocator::deallocate(new_begin, size);
-        throw;
+    else {
+        try {
+            tinystl::uninitialized_move(begin_, end_, new_begin);
+        }
+        catch (...) {
+            data_allocator::deallocate(new_begin, size);
+            throw;
+        }
+        tinystl::destroy(begin_, end_);
     }
     data_allocator::deallocate(begin_, cap_ - begin_);
     begin_ = new_begin;
@@ -916,43 +1132,57 @@ void vector<T, Alloc>::reinsert(size_type size) {
     cap_ = begin_ + size;
 }
 
+/// @brief 扩容时搬移旧元素：新元素已构造在 new_begin 中与 pos 对应的 n 个位置上，
+//  把 [begin_, pos) 和 [pos, end_) 按字节搬到它们的两侧，然后释放旧空间
+template <class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::relocate_around(iterator pos, size_type n, pointer new_begin, size_type new_cap) {
+    const size_type before = static_cast<size_type>(pos - begin_);
+    const size_type after = static_cast<size_type>(end_ - pos);
+    tinystl::relocate_bytes(new_begin, begin_, before);
+    tinystl::relocate_bytes(new_begin + before + n, pos, after);
+    data_allocator::deallocate(begin_, cap_ - begin_);
+    begin_ = new_begin;
+    end_ = new_begin + before + n + after;
+    cap_ = new_begin + new_cap;
+}
+
 // =========================  比较操作符  ====================== //
 
-template <class T, class Alloc>
-bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return lhs.size() == rhs.size() && 
         tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class T, class Alloc>
-bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class T, class Alloc>
-bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class T, class Alloc>
-bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return rhs < lhs;
 }
 
-template <class T, class Alloc>
-bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return !(rhs < lhs);
 }
 
-template <class T, class Alloc>
-bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
     return !(lhs < rhs);
 }
 
 // =========================  重载 swap  ====================== //
 
-template <class T, class Alloc>
-void swap(vector<T, Alloc>& lhs, vector<T, Alloc>& rhs) noexcept {
+template <class T, class Alloc, class Growth>
+void swap(vector<T, Alloc, Growth>& lhs, vector<T, Alloc, Growth>& rhs) noexcept {
     lhs.swap(rhs);  // 可以方便的交换两个 vector
 }
 
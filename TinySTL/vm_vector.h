@@ -0,0 +1,529 @@
+#ifndef TINYSTL_VM_VECTOR_H_
+#define TINYSTL_VM_VECTOR_H_
+
+// 这个头文件包含一个模板类 vm_vector
+// vm_vector : 预留一段虚拟地址空间、按需提交物理页的 vector，增长时元素从不搬移
+
+// notes:
+//
+// vector 容量不足时申请一块更大的空间并把全部元素搬过去，元素很多时这既是一次延迟尖峰，
+// 搬移期间新旧两块空间同时存在，峰值内存也翻倍。vm_vector 换一种做法：
+//   * 第一次插入时用 mmap(PROT_NONE)（Windows 下为 VirtualAlloc(MEM_RESERVE)）预留 max_size() 个元素的
+//     虚拟地址空间，此时不占用物理内存
+//   * 容量不足时只把预留区间中紧接着的一段改为可读写（mprotect / MEM_COMMIT），已有元素原地不动，
+//     因此指向元素的指针、引用、迭代器在 push_back / emplace_back / resize 后依然有效
+//   * 每次提交的大小按 1 倍增长，但单次最多 VM_VECTOR_MAX_COMMIT_STEP 字节；已提交但尚未写入的页
+//     同样不占用物理内存
+//   * shrink_to_fit 把尾部多余的页退还给系统，地址区间仍然保留
+//
+// 预留的大小在构造时确定（缺省为 VM_VECTOR_DEFAULT_RESERVE 字节），超出时抛出 std::length_error。
+// 只支持在尾部增删元素，适合只追加的日志、事件序列等场景；需要在中间插入时请使用 vector。
+//
+// 异常保证：
+// emplace_back / push_back 满足强异常安全保证，提交页失败时抛出 std::bad_alloc。
+
+#include <new>               // std::bad_alloc
+#include <cstddef>           // size_t
+#include <initializer_list>  // std::initializer_list
+#include <type_traits>       // std::is_same
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX             // windows.h 的 min / max 宏会与 tinystl::min / max 冲突
+#endif
+#include <windows.h>         // VirtualAlloc, VirtualFree
+#else
+#include <sys/mman.h>        // mmap, mprotect, munmap
+#include <unistd.h>          // sysconf
+#endif
+
+#include "iterator.h"
+#include "memory.h"
+#include "util.h"
+#include "exceptdef.h"
+#include "algo.h"
+
+namespace tinystl {
+
+// 缺省预留的虚拟地址空间：64 位平台为 4GB，32 位平台为 256MB
+constexpr size_t VM_VECTOR_DEFAULT_RESERVE =
+    sizeof(void*) >= 8 ? static_cast<size_t>(1) << 32 : static_cast<size_t>(1) << 28;
+constexpr size_t VM_VECTOR_MIN_COMMIT = 64 * 1024;          // 第一次提交的最小字节数
+constexpr size_t VM_VECTOR_MAX_COMMIT_STEP = 64 * 1024 * 1024;  // 单次最多提交的字节数
+
+/// @brief 预留大小标签，用于 vm_vector(tinystl::vm_reserve, n)，与 vm_vector(n) 构造 n 个元素相区分
+struct vm_reserve_t { explicit vm_reserve_t() = default; };
+constexpr vm_reserve_t vm_reserve{};
+
+// ===================================== 虚拟内存操作 ===================================== //
+
+inline size_t vm_page_size() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/// @brief 预留 bytes 字节的地址空间，不可访问，也不占用物理内存
+inline void* vm_reserve_range(size_t bytes) {
+#if defined(_WIN32)
+    void* p = VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+    if (p == nullptr) throw std::bad_alloc();
+#else
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+#endif
+    void* p = mmap(nullptr, bytes, PROT_NONE, flags, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+#endif
+    return p;
+}
+
+/// @brief 把预留区间中的 [p, p + bytes) 改为可读写
+inline void vm_commit(void* p, size_t bytes) {
+#if defined(_WIN32)
+    if (VirtualAlloc(p, bytes, MEM_COMMIT, PAGE_READWRITE) == nullptr) throw std::bad_alloc();
+#else
+    if (mprotect(p, bytes, PROT_READ | PROT_WRITE) != 0) throw std::bad_alloc();
+#endif
+}
+
+/// @brief 退还 [p, p + bytes) 的物理页，区间恢复为预留状态
+inline void vm_decommit(void* p, size_t bytes) noexcept {
+#if defined(_WIN32)
+    VirtualFree(p, bytes, MEM_DECOMMIT);
+#else
+    // 以 MAP_FIXED 重新映射一段 PROT_NONE 的匿名页，旧页随之释放，比 madvise 更可移植
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+#if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+#endif
+    mmap(p, bytes, PROT_NONE, flags, -1, 0);
+#endif
+}
+
+inline void vm_release(void* p, size_t bytes) noexcept {
+#if defined(_WIN32)
+    (void)bytes;
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    munmap(p, bytes);
+#endif
+}
+
+// ========================================= vm_vector ========================================= //
+
+/// @brief 模板类 vm_vector
+/// @tparam T  元素类型
+template <class T>
+class vm_vector {
+
+static_assert(!std::is_same<bool, T>::value, "vm_vector<bool> is abandoned in tinystl");
+
+public:
+    // vm_vector 的嵌套型别定义
+    typedef T                  value_type;
+    typedef value_type*        pointer;
+    typedef const value_type*  const_pointer;
+    typedef value_type&        reference;
+    typedef const value_type&  const_reference;
+    typedef size_t             size_type;
+    typedef ptrdiff_t          difference_type;
+
+    typedef value_type*                                   iterator;
+    typedef const value_type*                             const_iterator;
+    typedef tinystl::reverse_iterator<iterator>           reverse_iterator;
+    typedef tinystl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+private:
+    iterator  begin_;       // 表示目前使用空间的头，即预留区间的起始位置，尚未预留时为空
+    iterator  end_;         // 表示目前使用空间的尾
+    iterator  cap_;         // 表示已提交空间的尾
+    size_type reserved_;    // 预留的字节数，按页取整
+    size_type committed_;   // 已提交的字节数，按页取整
+
+public:
+
+    // =========================  构造函数  ========================= //
+
+    vm_vector() noexcept
+        : begin_(nullptr), end_(nullptr), cap_(nullptr),
+          reserved_(VM_VECTOR_DEFAULT_RESERVE), committed_(0) {}
+
+    /// @brief 最多容纳 max_elems 个元素，地址空间在第一次插入时才预留
+    vm_vector(vm_reserve_t, size_type max_elems)
+        : begin_(nullptr), end_(nullptr), cap_(nullptr),
+          reserved_(reserve_bytes(max_elems)), committed_(0) {}
+
+    explicit vm_vector(size_type n) : vm_vector() {
+        guarded_init([&] { resize(n); });
+    }
+
+    vm_vector(size_type n, const value_type& value) : vm_vector() {
+        guarded_init([&] { resize(n, value); });
+    }
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    vm_vector(Iter first, Iter last) : vm_vector() {
+        guarded_init([&] { append(first, last); });
+    }
+
+    vm_vector(std::initializer_list<value_type> ilist) : vm_vector() {
+        guarded_init([&] { append(ilist.begin(), ilist.end()); });
+    }
+
+    // 拷贝得到的容器预留同样大小的地址空间
+    vm_vector(const vm_vector& rhs)
+        : begin_(nullptr), end_(nullptr), cap_(nullptr),
+          reserved_(rhs.reserved_), committed_(0) {
+        guarded_init([&] { append(rhs.begin_, rhs.end_); });
+    }
+
+    vm_vector(vm_vector&& rhs) noexcept
+        : begin_(rhs.begin_), end_(rhs.end_), cap_(rhs.cap_),
+          reserved_(rhs.reserved_), committed_(rhs.committed_) {
+        rhs.reset();
+    }
+
+    // =========================  赋值运算符  ========================= //
+
+    vm_vector& operator=(const vm_vector& rhs) {
+        if (this != &rhs) {
+            THROW_LENGTH_ERROR_IF(rhs.size() > max_size(),
+                "rhs.size() can not larger than max_size() in vm_vector<T>::operator=");
+            clear();
+            append(rhs.begin_, rhs.end_);
+        }
+        return *this;
+    }
+
+    vm_vector& operator=(vm_vector&& rhs) noexcept {
+        if (this != &rhs) {
+            release();
+            begin_ = rhs.begin_;
+            end_ = rhs.end_;
+            cap_ = rhs.cap_;
+            reserved_ = rhs.reserved_;
+            committed_ = rhs.committed_;
+            rhs.reset();
+        }
+        return *this;
+    }
+
+    vm_vector& operator=(std::initializer_list<value_type> ilist) {
+        clear();
+        append(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    // =========================  析构函数  ========================= //
+
+    ~vm_vector() { release(); }
+
+public:
+    // =========================  迭代器相关操作  ====================== //
+
+    iterator begin() noexcept { return begin_; }
+    const_iterator begin() const noexcept { return begin_; }
+    iterator end() noexcept { return end_; }
+    const_iterator end() const noexcept { return end_; }
+
+    reverse_iterator rbegin() noexcept
+        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept
+        { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept
+        { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept
+        { return const_reverse_iterator(begin()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator crbegin() const noexcept
+        { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept
+        { return const_reverse_iterator(begin()); }
+
+    // =========================  容量相关操作  ====================== //
+
+    bool empty() const noexcept { return begin_ == end_; }
+
+    size_type size() const noexcept
+        { return static_cast<size_type>(end_ - begin_); }
+
+    // 预留的地址空间最多能容纳的元素个数
+    size_type max_size() const noexcept
+        { return reserved_ / sizeof(T); }
+
+    // 已提交的空间能容纳的元素个数
+    size_type capacity() const noexcept
+        { return committed_ / sizeof(T); }
+
+    // 预提交至少 n 个元素的空间，不会使迭代器失效
+    void reserve(size_type n) {
+        if (capacity() < n) {
+            THROW_LENGTH_ERROR_IF(n > max_size(),
+                "n can not larger than max_size() in vm_vector<T>::reserve(n)");
+            commit(n * sizeof(T));
+        }
+    }
+
+    void shrink_to_fit() noexcept;
+
+    // =========================  元素访问相关操作  ====================== //
+
+    reference operator[](size_type n) {
+        TINYSTL_DEBUG(n < size());
+        return *(begin_ + n);
+    }
+
+    const_reference operator[](size_type n) const {
+        TINYSTL_DEBUG(n < size());
+        return *(begin_ + n);
+    }
+
+    reference at(size_type n) {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "vm_vector<T>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    const_reference at(size_type n) const {
+        THROW_OUT_OF_RANGE_IF(!(n < size()), "vm_vector<T>::at() subscript out of range");
+        return (*this)[n];
+    }
+
+    reference front() {
+        TINYSTL_DEBUG(!empty());
+        return *begin_;
+    }
+
+    const_reference front() const {
+        TINYSTL_DEBUG(!empty());
+        return *begin_;
+    }
+
+    reference back() {
+        TINYSTL_DEBUG(!empty());
+        return *(end_ - 1);
+    }
+
+    const_reference back() const {
+        TINYSTL_DEBUG(!empty());
+        return *(end_ - 1);
+    }
+
+    pointer data() noexcept { return begin_; }
+    const_pointer data() const noexcept { return begin_; }
+
+    // =========================  修改容器相关操作  ====================== //
+
+    // emplace_back / push_back / pop_back
+
+    template <class... Args>
+    void emplace_back(Args&&... args) {
+        if (end_ == cap_) {
+            grow(size() + 1);
+        }
+        tinystl::construct(end_, tinystl::forward<Args>(args)...);
+        ++end_;
+    }
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(tinystl::move(value)); }
+
+    void pop_back() {
+        TINYSTL_DEBUG(!empty());
+        --end_;
+        tinystl::destroy(end_);
+    }
+
+    // append，在尾部依次构造 [first, last) 中的元素
+
+    template <class Iter, typename std::enable_if<
+        tinystl::is_input_iterator<Iter>::value, int>::type = 0>
+    void append(Iter first, Iter last) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // resize / clear
+
+    void resize(size_type new_size) {
+        if (new_size < size()) {
+            erase_to(begin_ + new_size);
+        }
+        else {
+            if (new_size > capacity()) grow(new_size);
+            for (size_type n = new_size - size(); n > 0; --n) {
+                tinystl::construct(end_);
+                ++end_;
+            }
+        }
+    }
+
+    void resize(size_type new_size, const value_type& value) {
+        if (new_size < size()) {
+            erase_to(begin_ + new_size);
+        }
+        else {
+            if (new_size > capacity()) grow(new_size);
+            for (size_type n = new_size - size(); n > 0; --n) {
+                tinystl::construct(end_, value);
+                ++end_;
+            }
+        }
+    }
+
+    void clear() noexcept { erase_to(begin_); }
+
+    // swap
+
+    void swap(vm_vector& rhs) noexcept {
+        if (this != &rhs) {
+            tinystl::swap(begin_, rhs.begin_);
+            tinystl::swap(end_, rhs.end_);
+            tinystl::swap(cap_, rhs.cap_);
+            tinystl::swap(reserved_, rhs.reserved_);
+            tinystl::swap(committed_, rhs.committed_);
+        }
+    }
+
+private:
+    // =========================  辅助函数  ====================== //
+
+    static size_type round_to_page(size_type bytes) {
+        const size_type page = vm_page_size();
+        return (bytes + page - 1) / page * page;
+    }
+
+    static size_type reserve_bytes(size_type max_elems) {
+        THROW_LENGTH_ERROR_IF(max_elems > (static_cast<size_type>(-1) - vm_page_size()) / sizeof(T),
+            "max_elems too large in vm_vector<T>::vm_vector(vm_reserve, max_elems)");
+        return round_to_page(max_elems * sizeof(T));
+    }
+
+    // 构造函数中途抛出异常时析构函数不会被调用，需要自行析构已构造的元素并归还地址空间
+    template <class F>
+    void guarded_init(F f) {
+        try {
+            f();
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    // 回到尚未预留的状态，保留预留大小，之后插入元素时重新预留
+    void reset() noexcept {
+        begin_ = end_ = cap_ = nullptr;
+        committed_ = 0;
+    }
+
+    // 析构全部元素并归还地址空间
+    void release() noexcept {
+        if (begin_ != nullptr) {
+            tinystl::destroy(begin_, end_);
+            vm_release(begin_, reserved_);
+        }
+        reset();
+    }
+
+    void erase_to(iterator pos) noexcept {
+        tinystl::destroy(pos, end_);
+        end_ = pos;
+    }
+
+    void grow(size_type required);
+    void commit(size_type bytes);
+
+};  // class vm_vector
+
+// =========================  函数实现  ====================== //
+
+/// @brief 退还 size() 之后的整页，地址区间仍然保留，之后增长时重新提交
+template <class T>
+void vm_vector<T>::shrink_to_fit() noexcept {
+    if (begin_ == nullptr) return;
+    const size_type keep = round_to_page(size() * sizeof(T));
+    if (keep < committed_) {
+        vm_decommit(reinterpret_cast<char*>(begin_) + keep, committed_ - keep);
+        committed_ = keep;
+        cap_ = begin_ + committed_ / sizeof(T);
+    }
+}
+
+/// @brief 容量不足以容纳 required 个元素时，按 1 倍提交更多的页，单次最多 VM_VECTOR_MAX_COMMIT_STEP 字节
+template <class T>
+void vm_vector<T>::grow(size_type required) {
+    THROW_LENGTH_ERROR_IF(required > max_size(), "vm_vector<T>'s size too big");
+    size_type step = committed_ < VM_VECTOR_MAX_COMMIT_STEP ? committed_ : VM_VECTOR_MAX_COMMIT_STEP;
+    if (step < VM_VECTOR_MIN_COMMIT) step = VM_VECTOR_MIN_COMMIT;
+    size_type bytes = required * sizeof(T);
+    if (bytes < committed_ + step) {
+        bytes = committed_ + step < reserved_ ? committed_ + step : reserved_;
+    }
+    commit(bytes);
+}
+
+/// @brief 提交预留区间的前 bytes 字节（按页取整），必要时先预留地址空间；已有元素不会移动
+template <class T>
+void vm_vector<T>::commit(size_type bytes) {
+    if (begin_ == nullptr) {
+        begin_ = end_ = cap_ = static_cast<pointer>(vm_reserve_range(reserved_));
+    }
+    bytes = round_to_page(bytes);
+    if (bytes > reserved_) bytes = reserved_;
+    if (bytes <= committed_) return;
+    vm_commit(reinterpret_cast<char*>(begin_) + committed_, bytes - committed_);
+    committed_ = bytes;
+    cap_ = begin_ + committed_ / sizeof(T);
+}
+
+// =========================  重载比较操作符  ====================== //
+
+template <class T>
+bool operator==(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return lhs.size() == rhs.size() &&
+        tinystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class T>
+bool operator!=(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T>
+bool operator<(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return tinystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class T>
+bool operator>(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return rhs < lhs;
+}
+
+template <class T>
+bool operator<=(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <class T>
+bool operator>=(const vm_vector<T>& lhs, const vm_vector<T>& rhs) {
+    return !(lhs < rhs);
+}
+
+// 重载 tinystl 的 swap
+template <class T>
+void swap(vm_vector<T>& lhs, vm_vector<T>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}  // namespace tinystl
+
+#endif  // !TINYSTL_VM_VECTOR_H_